@@ -0,0 +1,86 @@
+// Compares the construction time and the throughput of `first_intersection()`
+// between the default AABB tree and the SAH wide trees.
+
+#include <CGAL/Exact_predicates_inexact_constructions_kernel.h>
+#include <CGAL/Surface_mesh.h>
+#include <CGAL/AABB_tree.h>
+#include <CGAL/AABB_traits_3.h>
+#include <CGAL/AABB_face_graph_triangle_primitive.h>
+#include <CGAL/point_generators_3.h>
+#include <CGAL/Random.h>
+#include <CGAL/Real_timer.h>
+
+#include <algorithm>
+#include <fstream>
+#include <iostream>
+#include <iterator>
+#include <string>
+#include <vector>
+
+typedef CGAL::Epick K;
+typedef K::Point_3 Point;
+typedef K::Vector_3 Vector;
+typedef K::Ray_3 Ray;
+typedef CGAL::Surface_mesh<Point> Mesh;
+typedef CGAL::AABB_face_graph_triangle_primitive<Mesh> Primitive;
+typedef CGAL::AABB_traits_3<K, Primitive> Traits;
+
+template <class Tree>
+void run(const std::string& name, const Mesh& mesh, const std::vector<Ray>& rays)
+{
+  CGAL::Real_timer timer;
+  timer.start();
+  Tree tree(faces(mesh).first, faces(mesh).second, mesh);
+  tree.build();
+  timer.stop();
+  const double build_time = timer.time();
+
+  timer.reset();
+  timer.start();
+  std::size_t nb_hits = 0;
+  for(const Ray& r : rays)
+    if(tree.first_intersection(r))
+      ++nb_hits;
+  timer.stop();
+
+  std::cout << name << "\n"
+            << "  build time: " << build_time << " s\n"
+            << "  " << nb_hits << " hits for " << rays.size() << " rays in " << timer.time() << " s"
+            << " (" << double(rays.size()) / timer.time() / 1e6 << " Mrays/s)" << std::endl;
+}
+
+int main(int argc, char** argv)
+{
+  const std::string filename = (argc > 1) ? argv[1] : CGAL::data_file_path("meshes/bunny00.off");
+  const std::size_t nb_rays = (argc > 2) ? std::stoul(argv[2]) : 1000000;
+
+  Mesh mesh;
+  std::ifstream in(filename);
+  if(!in || !(in >> mesh))
+  {
+    std::cerr << "Error: cannot read " << filename << std::endl;
+    return EXIT_FAILURE;
+  }
+  std::cout << num_faces(mesh) << " faces, " << nb_rays << " rays" << std::endl;
+
+  // rays from a sphere around the mesh towards its inside
+  const CGAL::Bbox_3 bb = CGAL::bbox_3(mesh.points().begin(), mesh.points().end());
+  const Vector center(0.5 * (bb.xmin() + bb.xmax()),
+                      0.5 * (bb.ymin() + bb.ymax()),
+                      0.5 * (bb.zmin() + bb.zmax()));
+  const double radius = (std::max)({bb.x_span(), bb.y_span(), bb.z_span()});
+
+  CGAL::Random rand(0);
+  CGAL::Random_points_on_sphere_3<Point> sources(radius, rand);
+  CGAL::Random_points_in_sphere_3<Point> targets(radius / 4, rand);
+  std::vector<Ray> rays;
+  rays.reserve(nb_rays);
+  for(std::size_t i=0; i<nb_rays; ++i)
+    rays.emplace_back(*sources++ + center, *targets++ + center);
+
+  run<CGAL::AABB_tree<Traits> >("Median split binary tree", mesh, rays);
+  run<CGAL::AABB_tree<Traits, CGAL::AABB_SAH_wide_tree_tag<4> > >("SAH 4-wide tree", mesh, rays);
+  run<CGAL::AABB_tree<Traits, CGAL::AABB_SAH_wide_tree_tag<8> > >("SAH 8-wide tree", mesh, rays);
+
+  return EXIT_SUCCESS;
+}
@@ -21,6 +21,7 @@
 #include <CGAL/Bbox_2.h>
 #include <CGAL/Default.h>
 #include <CGAL/intersections.h>
+#include <CGAL/AABB_tree_build_tags.h>
 #include <CGAL/AABB_tree/internal/AABB_traits_base.h>
 #include <CGAL/AABB_tree/internal/Has_nested_type_Shared_data.h>
 #include <CGAL/AABB_tree/internal/Is_ray_intersection_geomtraits.h>
@@ -28,6 +29,7 @@
 #include <CGAL/AABB_tree/internal/Remove_optional.h>
 #include <CGAL/Kernel_23/internal/Has_boolean_tags.h>
 #include <CGAL/Search_traits_2.h>
+#include <algorithm>
 #include <optional>
 
 /// \file AABB_traits_2.h
@@ -125,10 +127,6 @@ public:
 /// \addtogroup PkgAABBTreeRef
 /// @{
 
-// forward declaration
-template< typename AABBTraits>
-class AABB_tree;
-
 
 /// This traits class handles any type of 2D geometric
 /// primitives provided that the proper intersection tests and
@@ -393,25 +391,15 @@ public:
       typedef typename AT::FT FT;
       typedef typename AT::Primitive Primitive;
   public:
-      CGAL::Comparison_result operator()(const Point& p, const Bounding_box& bb, const Point& bound, Tag_true) const
-      {
-          return GeomTraits().do_intersect_2_object()
-          (GeomTraits().construct_circle_2_object()
-           (p, GeomTraits().compute_squared_distance_2_object()(p, bound)), bb,true)?
-          CGAL::SMALLER : CGAL::LARGER;
-      }
-
-      CGAL::Comparison_result operator()(const Point& p, const Bounding_box& bb, const Point& bound, Tag_false) const
-      {
-          return GeomTraits().do_intersect_2_object()
-          (GeomTraits().construct_circle_2_object()
-           (p, GeomTraits().compute_squared_distance_2_object()(p, bound)), bb)?
-          CGAL::SMALLER : CGAL::LARGER;
-      }
-
+      // `Circle_2` is a curve for `Do_intersect_2`, so a box inside the circle would
+      // be reported as not intersected: the point of `bb` closest to `p` is used instead.
       CGAL::Comparison_result operator()(const Point& p, const Bounding_box& bb, const Point& bound) const
       {
-        return (*this)(p, bb, bound, Boolean_tag<internal::Has_static_filters<GeomTraits>::value>());
+          GeomTraits gt;
+          const FT x = (std::clamp)(gt.compute_x_2_object()(p), FT(bb.xmin()), FT(bb.xmax()));
+          const FT y = (std::clamp)(gt.compute_y_2_object()(p), FT(bb.ymin()), FT(bb.ymax()));
+          return gt.compare_distance_2_object()(p, gt.construct_point_2_object()(x, y), bound) == CGAL::LARGER ?
+          CGAL::LARGER : CGAL::SMALLER;
       }
 
       // The following functions seem unused...?
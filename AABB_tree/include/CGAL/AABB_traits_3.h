@@ -21,6 +21,7 @@
 #include <CGAL/Bbox_3.h>
 #include <CGAL/Default.h>
 #include <CGAL/intersections.h>
+#include <CGAL/AABB_tree_build_tags.h>
 #include <CGAL/AABB_tree/internal/AABB_traits_base.h>
 #include <CGAL/AABB_tree/internal/Has_nested_type_Shared_data.h>
 #include <CGAL/AABB_tree/internal/Is_ray_intersection_geomtraits.h>
@@ -129,10 +130,6 @@ public:
 /// \addtogroup PkgAABBTreeRef
 /// @{
 
-// forward declaration
-template< typename AABBTraits>
-class AABB_tree;
-
 
 /// This traits class handles any type of 3D geometric
 /// primitives provided that the proper intersection tests and
@@ -21,9 +21,12 @@
 
 #include <vector>
 #include <iterator>
+#include <CGAL/AABB_tree_build_tags.h>
+#include <CGAL/tags.h>
 #include <CGAL/AABB_tree/internal/AABB_traversal_traits.h>
 #include <CGAL/AABB_tree/internal/AABB_node.h>
 #include <CGAL/AABB_tree/internal/AABB_search_tree.h>
+#include <CGAL/AABB_tree/internal/AABB_batch_queries.h>
 #include <CGAL/AABB_tree/internal/Has_nested_type_Shared_data.h>
 #include <CGAL/AABB_tree/internal/Primitive_helper.h>
 #include <optional>
@@ -32,6 +35,13 @@
 #include <CGAL/mutex.h>
 #endif
 
+#ifdef CGAL_LINKED_WITH_TBB
+#include <tbb/blocked_range.h>
+#include <tbb/parallel_for.h>
+#include <tbb/parallel_invoke.h>
+#include <tbb/parallel_reduce.h>
+#endif
+
 /// \file AABB_tree.h
 
 namespace CGAL {
@@ -48,12 +58,25 @@ namespace CGAL {
    * implemented in the traits class AABBTraits.
    * An instance of the class `AABBTraits` is internally stored.
    *
+   * \tparam AABBTraits must be a model of `AABBTraits`.
+   * \tparam BuildTag selects the construction and the layout of the hierarchy:
+   * either `AABB_median_split_tag` (the default) or `AABB_SAH_wide_tree_tag`.
+   * The documentation below describes the default tree. With `AABB_SAH_wide_tree_tag`,
+   * the same creation, intersection and distance query functions are provided,
+   * but the functions related to the internal KD-tree used to accelerate distance queries
+   * and `custom_build()` are not.
+   *
    * \sa `AABBTraits`
    * \sa `AABBPrimitive`
    *
    */
-  template <typename AABBTraits>
+#ifdef DOXYGEN_RUNNING
+  template <typename AABBTraits, typename BuildTag = AABB_median_split_tag>
   class AABB_tree
+#else
+  template <typename AABBTraits>
+  class AABB_tree<AABBTraits, AABB_median_split_tag>
+#endif
   {
   private:
     // internal KD-tree used to accelerate the distance queries
@@ -145,15 +168,52 @@ namespace CGAL {
     /// primitives of the tree.
     template<typename ... T>
     void build(T&& ...);
+
+    /// triggers the (re)construction of the internal tree structure, similarly to `build()`.
+    /// With `Parallel_tag`, the two halves of the primitives obtained by each split are processed
+    /// in parallel, and so are the bounding box computations of large sets of primitives.
+    /// The resulting tree is identical to the one obtained with `build()`.
+    /// If the internal KD-tree is used to accelerate the distance queries,
+    /// it is also (re)constructed, using the same concurrency tag.
+    ///
+    /// \note `Parallel_tag` can only be used if \tbb is available and linked.
+    void build(Parallel_tag);
+
+    /// is equivalent to calling `build()` and then `accelerate_distance_queries()` if the internal KD-tree is used.
+    void build(Sequential_tag);
+
+    /// updates the bounding boxes of the nodes of the tree after the geometry of some
+    /// primitives has changed (for example the positions of the vertices of a deformed mesh),
+    /// without changing the structure of the tree nor the set of primitives.
+    /// The bounding boxes are recomputed bottom-up, which has a complexity of \cgalBigO{n},
+    /// where \f$n\f$ is the number of primitives of the tree.
+    /// The tree remains valid whatever the displacement of the primitives, but the efficiency
+    /// of the queries degrades if primitives that are close in the tree move far from each other,
+    /// in which case `build()` should be called instead.
+    ///
+    /// If primitives were inserted since the last construction of the tree, `build()` is called instead.
+    /// If the internal KD-tree was built from the reference points of the primitives,
+    /// it is cleared and will be rebuilt by the next distance query that does not provide a hint.
+    /// A KD-tree given through `accelerate_distance_queries(first, beyond)` is kept as is.
+    ///
+    /// \tparam ConcurrencyTag enables sequential versus parallel update of the bounding boxes.
+    ///                        Possible values are `Sequential_tag`, `Parallel_tag`, and `Parallel_if_available_tag`.
+    ///                        `Parallel_tag` can only be used if \tbb is available and linked.
+    ///
+    /// \pre The primitives must return their updated datum, which is the case for primitives
+    /// computing their datum on the fly from a property map, such as `AABB_face_graph_triangle_primitive`.
+    template <typename ConcurrencyTag = Sequential_tag>
+    void refit();
 #ifndef DOXYGEN_RUNNING
     void build();
 
     /// triggers the (re)construction of the tree similarly to a call to `build()`
     /// but the traits functors `Compute_bbox` and `Split_primitives` are ignored
     /// and `compute_bbox` and `split_primitives` are used instead.
-    template <class ComputeBbox, class SplitPrimitives>
+    template <class ComputeBbox, class SplitPrimitives, class ConcurrencyTag = Sequential_tag>
     void custom_build(const ComputeBbox& compute_bbox,
-                      const SplitPrimitives& split_primitives);
+                      const SplitPrimitives& split_primitives,
+                      const ConcurrencyTag& tag = ConcurrencyTag());
 #endif
     ///@}
 
@@ -228,8 +288,9 @@ namespace CGAL {
       set_primitive_data_impl(CGAL::Boolean_tag<internal::Has_nested_type_Shared_data<Primitive>::value>(),std::forward<T>(t)...);
     }
 
+    template <typename ConcurrencyTag = Sequential_tag>
     bool build_kd_tree();
-    template<typename ConstPointIterator>
+    template<typename ConstPointIterator, typename ConcurrencyTag = Sequential_tag>
     bool build_kd_tree(ConstPointIterator first, ConstPointIterator beyond);
 public:
 
@@ -377,6 +438,56 @@ public:
     Point_and_primitive_id closest_point_and_primitive(const Point& query) const;
 
 
+    ///@}
+
+    /// \name Batch Queries
+    /// The following functions answer a range of queries at once. The queries are
+    /// first sorted along a Hilbert curve, so that consecutive queries visit the same
+    /// nodes of the tree. The sorted queries are then split into batches
+    /// processed in parallel if `ConcurrencyTag` is `Parallel_tag`. Within a batch of distance
+    /// queries, the closest point of a query is used as hint for the next one
+    /// (see `closest_point_and_primitive(const Point&, const Point_and_primitive_id&) const`).
+    /// The results are written to the output iterator in the order of the input queries.
+    ///
+    /// \tparam ConcurrencyTag enables sequential versus parallel processing of the queries.
+    ///                        Possible values are `Sequential_tag`, `Parallel_tag`, and `Parallel_if_available_tag`.
+    ///                        `Parallel_tag` can only be used if \tbb is available and linked.
+    ///@{
+
+    /// computes `closest_point_and_primitive(q)` for each point `q` of `queries`.
+    /// \tparam PointRange a model of `ConstRange` with value type `Point`
+    /// \tparam OutputIterator an output iterator accepting `Point_and_primitive_id` objects
+    /// \pre `!empty()` or `queries` is empty
+    template <typename ConcurrencyTag = Sequential_tag, typename PointRange, typename OutputIterator>
+    OutputIterator closest_points_and_primitives(const PointRange& queries, OutputIterator out) const
+    {
+      return internal::AABB_tree::closest_points_and_primitives<ConcurrencyTag>(*this, queries, out);
+    }
+
+    /// computes `squared_distance(q)` for each point `q` of `queries`.
+    /// \tparam PointRange a model of `ConstRange` with value type `Point`
+    /// \tparam OutputIterator an output iterator accepting `FT` objects
+    /// \pre `!empty()` or `queries` is empty
+    template <typename ConcurrencyTag = Sequential_tag, typename PointRange, typename OutputIterator>
+    OutputIterator squared_distances(const PointRange& queries, OutputIterator out) const
+    {
+      return internal::AABB_tree::squared_distances<ConcurrencyTag>(*this, queries, out);
+    }
+
+    /// computes `first_intersection(r)` for each ray `r` of `queries`.
+    /// The rays are sorted according to their source points.
+    /// \tparam RayRange a model of `ConstRange` with value type `AABBTraits::Ray`
+    /// \tparam OutputIterator an output iterator accepting
+    ///         `std::optional<Intersection_and_primitive_id<AABBTraits::Ray>::%Type>` objects
+    ///
+    /// `AABBTraits` must be a model of `AABBRayIntersectionTraits` to
+    /// call this member function.
+    template <typename ConcurrencyTag = Sequential_tag, typename RayRange, typename OutputIterator>
+    OutputIterator first_intersections(const RayRange& queries, OutputIterator out) const
+    {
+      return internal::AABB_tree::first_intersections<ConcurrencyTag>(*this, queries, out);
+    }
+
     ///@}
 
     /// \name Accelerating the Distance Queries
@@ -440,6 +551,15 @@ public:
     /// a point set taken on the internal primitives
     /// returns `true` iff successful memory allocation
     bool accelerate_distance_queries();
+
+    /// same as `accelerate_distance_queries()`, but the reference points are
+    /// computed and the internal KD-tree is built in parallel if `Parallel_tag` is used.
+    ///
+    /// \note `Parallel_tag` can only be used if \tbb is available and linked.
+    bool accelerate_distance_queries(Parallel_tag);
+
+    /// same as `accelerate_distance_queries()`.
+    bool accelerate_distance_queries(Sequential_tag);
     /// turns off the usage of the internal search tree and clears it if it was already constructed.
     void do_not_accelerate_distance_queries();
 
@@ -560,7 +680,7 @@ public:
 
     /**
      * @brief Builds the tree by recursive expansion.
-     * @param node the root node of the subtree to generate
+     * @param node_id the index of the root node of the subtree to generate
      * @param first the first primitive to insert
      * @param beyond the last primitive to insert
      * @param range the number of primitive of the range
@@ -568,14 +688,46 @@ public:
      * @param split_primitives a functor
      *
      * [first,beyond[ is the range of primitives to be added to the tree.
+     * The subtree of a range of `n` primitives uses the `n-1` nodes starting at `node_id`
+     * in depth-first order, so that the subtrees can be built independently.
      */
     template<typename ConstPrimitiveIterator, typename ComputeBbox, typename SplitPrimitives>
-    void expand(Node& node,
+    void expand(const std::size_t node_id,
                 ConstPrimitiveIterator first,
                 ConstPrimitiveIterator beyond,
                 const std::size_t range,
                 const ComputeBbox& compute_bbox,
-                const SplitPrimitives& split_primitives);
+                const SplitPrimitives& split_primitives,
+                const Sequential_tag&);
+
+#ifdef CGAL_LINKED_WITH_TBB
+    template<typename ConstPrimitiveIterator, typename ComputeBbox, typename SplitPrimitives>
+    void expand(const std::size_t node_id,
+                ConstPrimitiveIterator first,
+                ConstPrimitiveIterator beyond,
+                const std::size_t range,
+                const ComputeBbox& compute_bbox,
+                const SplitPrimitives& split_primitives,
+                const Parallel_tag&);
+#endif
+
+    // recomputes the bounding boxes of the subtree of the node `node_id`, which contains
+    // the `range` primitives starting at `first`, see `expand()`
+    template<typename ConstPrimitiveIterator, typename ComputeBbox>
+    void refit_node(const std::size_t node_id,
+                    ConstPrimitiveIterator first,
+                    const std::size_t range,
+                    const ComputeBbox& compute_bbox,
+                    const Sequential_tag&);
+
+#ifdef CGAL_LINKED_WITH_TBB
+    template<typename ConstPrimitiveIterator, typename ComputeBbox>
+    void refit_node(const std::size_t node_id,
+                    ConstPrimitiveIterator first,
+                    const std::size_t range,
+                    const ComputeBbox& compute_bbox,
+                    const Parallel_tag&);
+#endif
 
   public:
     // returns a point which must be on one primitive
@@ -786,13 +938,15 @@ public:
   template<typename Tr>
   template<typename ConstPrimitiveIterator, typename ComputeBbox, typename SplitPrimitives>
   void
-  AABB_tree<Tr>::expand(Node& node,
+  AABB_tree<Tr>::expand(const std::size_t node_id,
                         ConstPrimitiveIterator first,
                         ConstPrimitiveIterator beyond,
                         const std::size_t range,
                         const ComputeBbox& compute_bbox,
-                        const SplitPrimitives& split_primitives)
+                        const SplitPrimitives& split_primitives,
+                        const Sequential_tag& tag)
   {
+    Node& node = m_nodes[node_id];
     node.set_bbox(compute_bbox(first, beyond));
 
     // sort primitives along longest axis aabb
@@ -804,17 +958,134 @@ public:
       node.set_children(*first, *(first+1));
       break;
     case 3:
-      node.set_children(*first, new_node());
-      expand(node.right_child(), first+1, beyond, 2, compute_bbox, split_primitives);
+      node.set_children(*first, m_nodes[node_id+1]);
+      expand(node_id+1, first+1, beyond, 2, compute_bbox, split_primitives, tag);
       break;
     default:
       const std::size_t new_range = range/2;
-      node.set_children(new_node(), new_node());
-      expand(node.left_child(), first, first + new_range, new_range, compute_bbox, split_primitives);
-      expand(node.right_child(), first + new_range, beyond, range - new_range, compute_bbox, split_primitives);
+      // the left subtree uses `new_range-1` nodes
+      node.set_children(m_nodes[node_id+1], m_nodes[node_id+new_range]);
+      expand(node_id+1, first, first + new_range, new_range, compute_bbox, split_primitives, tag);
+      expand(node_id+new_range, first + new_range, beyond, range - new_range, compute_bbox, split_primitives, tag);
     }
   }
 
+#ifdef CGAL_LINKED_WITH_TBB
+  template<typename Tr>
+  template<typename ConstPrimitiveIterator, typename ComputeBbox, typename SplitPrimitives>
+  void
+  AABB_tree<Tr>::expand(const std::size_t node_id,
+                        ConstPrimitiveIterator first,
+                        ConstPrimitiveIterator beyond,
+                        const std::size_t range,
+                        const ComputeBbox& compute_bbox,
+                        const SplitPrimitives& split_primitives,
+                        const Parallel_tag& tag)
+  {
+    // below this number of primitives, spawning tasks is not worth it
+    const std::size_t parallel_threshold = 4096;
+    if(range < parallel_threshold)
+      return expand(node_id, first, beyond, range, compute_bbox, split_primitives, Sequential_tag());
+
+    // union of the boxes of chunks of primitives
+    const std::size_t grain_size = parallel_threshold / 2;
+    Node& node = m_nodes[node_id];
+    node.set_bbox(tbb::parallel_reduce(
+      tbb::blocked_range<std::size_t>(0, range, grain_size),
+      compute_bbox(first, first+1),
+      [&](const tbb::blocked_range<std::size_t>& r, Bounding_box bbox)
+      {
+        return bbox + compute_bbox(first + r.begin(), first + r.end());
+      },
+      [](const Bounding_box& b1, const Bounding_box& b2) { return b1 + b2; }));
+
+    // sort primitives along longest axis aabb
+    split_primitives(first, beyond, node.bbox());
+
+    const std::size_t new_range = range/2;
+    node.set_children(m_nodes[node_id+1], m_nodes[node_id+new_range]);
+    tbb::parallel_invoke(
+      [&]{ expand(node_id+1, first, first + new_range, new_range, compute_bbox, split_primitives, tag); },
+      [&]{ expand(node_id+new_range, first + new_range, beyond, range - new_range, compute_bbox, split_primitives, tag); });
+  }
+#endif
+
+
+  template<typename Tr>
+  template<typename ConstPrimitiveIterator, typename ComputeBbox>
+  void
+  AABB_tree<Tr>::refit_node(const std::size_t node_id,
+                            ConstPrimitiveIterator first,
+                            const std::size_t range,
+                            const ComputeBbox& compute_bbox,
+                            const Sequential_tag& tag)
+  {
+    Node& node = m_nodes[node_id];
+    switch(range)
+    {
+    case 2:
+      node.set_bbox(compute_bbox(first, first+2));
+      break;
+    case 3:
+      refit_node(node_id+1, first+1, 2, compute_bbox, tag);
+      node.set_bbox(compute_bbox(first, first+1) + m_nodes[node_id+1].bbox());
+      break;
+    default:
+      const std::size_t new_range = range/2;
+      refit_node(node_id+1, first, new_range, compute_bbox, tag);
+      refit_node(node_id+new_range, first + new_range, range - new_range, compute_bbox, tag);
+      node.set_bbox(m_nodes[node_id+1].bbox() + m_nodes[node_id+new_range].bbox());
+    }
+  }
+
+#ifdef CGAL_LINKED_WITH_TBB
+  template<typename Tr>
+  template<typename ConstPrimitiveIterator, typename ComputeBbox>
+  void
+  AABB_tree<Tr>::refit_node(const std::size_t node_id,
+                            ConstPrimitiveIterator first,
+                            const std::size_t range,
+                            const ComputeBbox& compute_bbox,
+                            const Parallel_tag& tag)
+  {
+    // below this number of primitives, spawning tasks is not worth it
+    const std::size_t parallel_threshold = 4096;
+    if(range < parallel_threshold)
+      return refit_node(node_id, first, range, compute_bbox, Sequential_tag());
+
+    const std::size_t new_range = range/2;
+    tbb::parallel_invoke(
+      [&]{ refit_node(node_id+1, first, new_range, compute_bbox, tag); },
+      [&]{ refit_node(node_id+new_range, first + new_range, range - new_range, compute_bbox, tag); });
+    m_nodes[node_id].set_bbox(m_nodes[node_id+1].bbox() + m_nodes[node_id+new_range].bbox());
+  }
+#endif
+
+  template<typename Tr>
+  template<typename ConcurrencyTag>
+  void AABB_tree<Tr>::refit()
+  {
+#ifndef CGAL_LINKED_WITH_TBB
+    static_assert (!(std::is_convertible<ConcurrencyTag, Parallel_tag>::value),
+                   "Parallel_tag is enabled but TBB is unavailable.");
+#endif
+
+#ifdef CGAL_HAS_THREADS
+    bool m_need_build = m_atomic_need_build.load(std::memory_order_acquire);
+#endif
+    if(m_need_build)
+      return custom_build(m_traits.compute_bbox_object(),
+                          m_traits.split_primitives_object(),
+                          ConcurrencyTag());
+
+    if(m_primitives.size() > 1)
+      refit_node(0, m_primitives.cbegin(), m_primitives.size(),
+                 m_traits.compute_bbox_object(), ConcurrencyTag());
+
+    // the reference points stored in the KD-tree are no longer on the primitives
+    if(m_use_default_search_tree)
+      clear_search_tree();
+  }
 
   // Build the data structure, after calls to insert(..)
   template<typename Tr>
@@ -823,27 +1094,57 @@ public:
     custom_build(m_traits.compute_bbox_object(),
                  m_traits.split_primitives_object());
   }
+
+  template<typename Tr>
+  void AABB_tree<Tr>::build(Sequential_tag)
+  {
+    build();
+    if(m_use_default_search_tree && !m_primitives.empty())
+      build_kd_tree<Sequential_tag>();
+  }
+
+  template<typename Tr>
+  void AABB_tree<Tr>::build(Parallel_tag)
+  {
+#ifndef CGAL_LINKED_WITH_TBB
+    static_assert (!std::is_same<Tr, Tr>::value, "Parallel_tag is enabled but TBB is unavailable.");
+#else
+    custom_build(m_traits.compute_bbox_object(),
+                 m_traits.split_primitives_object(),
+                 Parallel_tag());
+    if(m_use_default_search_tree && !m_primitives.empty())
+      build_kd_tree<Parallel_tag>();
+#endif
+  }
+
 #ifndef DOXYGEN_RUNNING
   // Build the data structure, after calls to insert(..)
   template<typename Tr>
-  template <class ComputeBbox, class SplitPrimitives>
+  template <class ComputeBbox, class SplitPrimitives, class ConcurrencyTag>
   void AABB_tree<Tr>::custom_build(
     const ComputeBbox& compute_bbox,
-    const SplitPrimitives& split_primitives)
+    const SplitPrimitives& split_primitives,
+    const ConcurrencyTag& tag)
   {
+#ifndef CGAL_LINKED_WITH_TBB
+    static_assert (!(std::is_convertible<ConcurrencyTag, Parallel_tag>::value),
+                   "Parallel_tag is enabled but TBB is unavailable.");
+#endif
+
     clear_nodes();
 
     if(m_primitives.size() > 1) {
 
       // allocates tree nodes
-      m_nodes.reserve(m_primitives.size()-1);
+      m_nodes.resize(m_primitives.size()-1);
 
       // constructs the tree
-      expand(new_node(),
+      expand(0,
              m_primitives.begin(), m_primitives.end(),
              m_primitives.size(),
              compute_bbox,
-             split_primitives);
+             split_primitives,
+             tag);
     }
 #ifdef CGAL_HAS_THREADS
     m_atomic_need_build.store(false, std::memory_order_release); // in case build() is triggered by a call to root_node()
@@ -855,27 +1156,44 @@ public:
   // constructs the search KD tree from given points
   // to accelerate the distance queries
   template<typename Tr>
+  template<typename ConcurrencyTag>
   bool AABB_tree<Tr>::build_kd_tree()
   {
     // iterate over primitives to get reference points on them
     std::vector<Point_and_primitive_id> points;
-    points.reserve(m_primitives.size());
-    for(const Primitive& p : m_primitives)
-      points.push_back( Point_and_primitive_id( Helper::get_reference_point(p, m_traits), p.id() ) );
+#ifdef CGAL_LINKED_WITH_TBB
+    if(std::is_convertible<ConcurrencyTag, Parallel_tag>::value)
+    {
+      points.resize(m_primitives.size());
+      tbb::parallel_for(tbb::blocked_range<std::size_t>(0, m_primitives.size()),
+                        [&](const tbb::blocked_range<std::size_t>& r)
+                        {
+                          for(std::size_t i=r.begin(); i!=r.end(); ++i)
+                            points[i] = Point_and_primitive_id( Helper::get_reference_point(m_primitives[i], m_traits),
+                                                                m_primitives[i].id() );
+                        });
+    }
+    else
+#endif
+    {
+      points.reserve(m_primitives.size());
+      for(const Primitive& p : m_primitives)
+        points.push_back( Point_and_primitive_id( Helper::get_reference_point(p, m_traits), p.id() ) );
+    }
 
     // clears current KD tree
-    return build_kd_tree(points.begin(), points.end());
+    return build_kd_tree<typename std::vector<Point_and_primitive_id>::iterator, ConcurrencyTag>(points.begin(), points.end());
   }
 
   // constructs the search KD tree from given points
   // to accelerate the distance queries
   template<typename Tr>
-  template<typename ConstPointIterator>
+  template<typename ConstPointIterator, typename ConcurrencyTag>
   bool AABB_tree<Tr>::build_kd_tree(ConstPointIterator first,
                                     ConstPointIterator beyond)
   {
     clear_search_tree();
-    m_p_search_tree = std::make_unique<const Search_tree>(first, beyond);
+    m_p_search_tree = std::make_unique<const Search_tree>(first, beyond, ConcurrencyTag());
 #ifdef CGAL_HAS_THREADS
       m_atomic_search_tree_constructed.store(true, std::memory_order_release); // in case build_kd_tree() is triggered by a call to best_hint()
 #else
@@ -900,6 +1218,25 @@ public:
     return build_kd_tree();
   }
 
+  template<typename Tr>
+  bool AABB_tree<Tr>::accelerate_distance_queries(Sequential_tag)
+  {
+    return accelerate_distance_queries();
+  }
+
+  template<typename Tr>
+  bool AABB_tree<Tr>::accelerate_distance_queries(Parallel_tag)
+  {
+#ifndef CGAL_LINKED_WITH_TBB
+    static_assert (!std::is_same<Tr, Tr>::value, "Parallel_tag is enabled but TBB is unavailable.");
+    return false;
+#else
+    m_use_default_search_tree = true;
+    if(m_primitives.empty()) return true;
+    return build_kd_tree<Parallel_tag>();
+#endif
+  }
+
   template<typename Tr>
   template<typename Query>
   bool
@@ -1057,6 +1394,7 @@ public:
 } // end namespace CGAL
 
 #include <CGAL/AABB_tree/internal/AABB_ray_intersection.h>
+#include <CGAL/AABB_tree/internal/AABB_SAH_wide_tree.h>
 
 #include <CGAL/enable_warnings.h>
 
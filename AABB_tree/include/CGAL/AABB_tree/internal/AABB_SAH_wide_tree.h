@@ -0,0 +1,1121 @@
+// Copyright (c) 2026 GeometryFactory (France).
+// All rights reserved.
+//
+// This file is part of CGAL (www.cgal.org).
+//
+// $URL$
+// $Id$
+// SPDX-License-Identifier: GPL-3.0-or-later OR LicenseRef-Commercial
+//
+//
+// Author(s) : GeometryFactory
+//
+
+#ifndef CGAL_AABB_SAH_WIDE_TREE_H
+#define CGAL_AABB_SAH_WIDE_TREE_H
+
+#include <CGAL/license/AABB_tree.h>
+
+#include <CGAL/AABB_tree_build_tags.h>
+#include <CGAL/AABB_tree/internal/AABB_batch_queries.h>
+#include <CGAL/AABB_tree/internal/AABB_node.h>
+#include <CGAL/AABB_tree/internal/AABB_traversal_traits.h>
+#include <CGAL/AABB_tree/internal/AABB_ray_intersection.h>
+#include <CGAL/AABB_tree/internal/Has_nested_type_Shared_data.h>
+#include <CGAL/AABB_tree/internal/Primitive_helper.h>
+#include <CGAL/Bbox_3.h>
+#include <CGAL/assertions.h>
+
+#ifdef CGAL_HAS_THREADS
+#include <CGAL/mutex.h>
+#include <atomic>
+#endif
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <numeric>
+#include <optional>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace CGAL {
+namespace internal {
+namespace AABB_tree {
+
+// sorts the `n` child indices of `children` by increasing `keys`. The number of
+// children is at most the arity of a node, for which an insertion sort is the fastest.
+inline void sort_children(unsigned int* children, const unsigned int n, const double* keys)
+{
+  for(unsigned int i=1; i<n; ++i)
+  {
+    const unsigned int c = children[i];
+    unsigned int j = i;
+    for(; j>0 && keys[c] < keys[children[j-1]]; --j)
+      children[j] = children[j-1];
+    children[j] = c;
+  }
+}
+
+// A node of the SAH wide tree. The bounding boxes of the children are stored
+// coordinate by coordinate so that a query can be tested against all of them
+// in a single loop. A child is either an inner node (`m_size == 0`),
+// a leaf referring to `m_size` consecutive primitives starting at `m_child`,
+// or an empty slot (`m_child == invalid`) whose bounding box is empty.
+template <unsigned int Arity>
+struct alignas(64) SAH_wide_node
+{
+  static constexpr std::uint32_t invalid = (std::numeric_limits<std::uint32_t>::max)();
+
+  double m_min[3][Arity];
+  double m_max[3][Arity];
+  std::uint32_t m_child[Arity];
+  std::uint32_t m_size[Arity];
+
+  SAH_wide_node()
+  {
+    for(unsigned int i=0; i<Arity; ++i)
+    {
+      for(int d=0; d<3; ++d)
+      {
+        m_min[d][i] = std::numeric_limits<double>::infinity();
+        m_max[d][i] = - std::numeric_limits<double>::infinity();
+      }
+      m_child[i] = invalid;
+      m_size[i] = 0;
+    }
+  }
+
+  bool is_empty(unsigned int i) const { return m_child[i] == invalid; }
+  bool is_leaf(unsigned int i) const { return m_size[i] != 0; }
+
+  Bbox_3 bbox(unsigned int i) const
+  {
+    return Bbox_3(m_min[0][i], m_min[1][i], m_min[2][i],
+                  m_max[0][i], m_max[1][i], m_max[2][i]);
+  }
+
+  // union of the bounding boxes of the children
+  Bbox_3 bbox() const
+  {
+    Bbox_3 bb;
+    for(unsigned int i=0; i<Arity; ++i)
+      if(!is_empty(i))
+        bb += bbox(i);
+    return bb;
+  }
+
+  void set_bbox(unsigned int i, const Bbox_3& bb)
+  {
+    for(int d=0; d<3; ++d)
+    {
+      m_min[d][i] = bb.min_coord(d);
+      m_max[d][i] = bb.max_coord(d);
+    }
+  }
+
+  // squared distance between `p` and the bounding box of each child
+  void squared_distances(const std::array<double, 3>& p, double* sd) const
+  {
+    for(unsigned int i=0; i<Arity; ++i)
+    {
+      double r = 0;
+      for(int d=0; d<3; ++d)
+      {
+        const double lo = m_min[d][i] - p[d];
+        const double hi = p[d] - m_max[d][i];
+        const double v = (std::max)((std::max)(lo, hi), 0.);
+        r += v * v;
+      }
+      // empty slots have infinite bounds and thus `r` is either inf or nan
+      sd[i] = is_empty(i) ? std::numeric_limits<double>::infinity() : r;
+    }
+  }
+};
+
+// Precomputed data of a ray used for the slab tests against the boxes of the nodes.
+struct SAH_wide_ray
+{
+  std::array<double, 3> m_origin;
+  std::array<double, 3> m_inv_dir;
+  std::array<int, 3> m_sign;
+
+  SAH_wide_ray(const std::array<double, 3>& origin, const std::array<double, 3>& dir)
+    : m_origin(origin)
+  {
+    for(int d=0; d<3; ++d)
+    {
+      m_inv_dir[d] = 1. / dir[d];
+      m_sign[d] = std::signbit(m_inv_dir[d]) ? 1 : 0;
+    }
+  }
+
+  // Sets the bits of the children of `n` hit by the ray before `t_max` and fills
+  // `t_near` with the entry parameters. The computation is made robust
+  // to rounding errors by enlarging the exit parameter as in
+  // [Ize, Robust BVH Ray Traversal, JCGT 2013], so that a box intersected
+  // by the ray is never missed. When the ray is parallel to a slab, the
+  // product `0 * inf` is a NaN, and is ignored by the comparisons below,
+  // which keeps the test conservative.
+  template <unsigned int Arity>
+  unsigned int intersect(const SAH_wide_node<Arity>& n, double t_max, double* t_near) const
+  {
+    constexpr double robust = 1. + 4. * std::numeric_limits<double>::epsilon();
+    unsigned int mask = 0;
+    for(unsigned int i=0; i<Arity; ++i)
+    {
+      double t0 = 0., t1 = t_max;
+      for(int d=0; d<3; ++d)
+      {
+        const double near_c = m_sign[d] ? n.m_max[d][i] : n.m_min[d][i];
+        const double far_c = m_sign[d] ? n.m_min[d][i] : n.m_max[d][i];
+        const double tn = (near_c - m_origin[d]) * m_inv_dir[d];
+        const double tf = (far_c - m_origin[d]) * m_inv_dir[d];
+        t0 = tn > t0 ? tn : t0;
+        t1 = tf < t1 ? tf : t1;
+      }
+      t_near[i] = t0;
+      mask |= (t0 <= t1 * robust ? 1u : 0u) << i;
+    }
+    return mask;
+  }
+};
+
+// Top-down construction of the wide tree with a binned surface area
+// heuristic. Instead of building a binary tree and then collapsing it,
+// each node is created by repeatedly splitting the child range with the
+// largest surface area until `Arity` children are obtained, which results
+// in the same hierarchy without storing the intermediate binary tree.
+template <unsigned int Arity>
+class SAH_wide_tree_builder
+{
+public:
+  typedef SAH_wide_node<Arity> Node;
+
+  // maximal number of primitives in a leaf
+  static constexpr std::size_t max_leaf_size = 4;
+  // number of bins per axis used to evaluate the candidate splits
+  static constexpr std::size_t nb_bins = 16;
+  // cost of traversing a node, relatively to the cost of intersecting a primitive
+  static constexpr double traversal_cost = 0.125;
+  // after that many consecutive splits, the object median is used to bound the depth
+  static constexpr std::size_t max_sah_depth = 64;
+
+private:
+  struct Range
+  {
+    std::size_t first, beyond;
+    Bbox_3 bbox;
+    std::size_t depth;
+    bool is_leaf;
+
+    std::size_t size() const { return beyond - first; }
+  };
+
+public:
+  SAH_wide_tree_builder(const std::vector<Bbox_3>& boxes)
+    : m_boxes(boxes)
+  {
+    m_order.resize(boxes.size());
+    std::iota(m_order.begin(), m_order.end(), std::size_t(0));
+    m_centroids.reserve(boxes.size());
+    for(const Bbox_3& bb : boxes)
+      m_centroids.push_back({ 0.5 * (bb.xmin() + bb.xmax()),
+                              0.5 * (bb.ymin() + bb.ymax()),
+                              0.5 * (bb.zmin() + bb.zmax()) });
+  }
+
+  // fills `nodes` in depth-first order, the root being the first node,
+  // and returns the order in which the primitives must be stored.
+  const std::vector<std::size_t>& build(std::vector<Node>& nodes)
+  {
+    CGAL_precondition(!m_boxes.empty());
+    nodes.clear();
+    nodes.reserve(2 * m_boxes.size() / (max_leaf_size * (Arity - 1)) + 1);
+
+    Range root { 0, m_boxes.size(), Bbox_3(), 0, false };
+    root.bbox = range_bbox(root.first, root.beyond);
+    build_node(root, nodes);
+    return m_order;
+  }
+
+private:
+  static double half_area(const Bbox_3& bb)
+  {
+    const double dx = bb.x_span(), dy = bb.y_span(), dz = bb.z_span();
+    return dx * dy + dy * dz + dz * dx;
+  }
+
+  Bbox_3 range_bbox(std::size_t first, std::size_t beyond) const
+  {
+    Bbox_3 bb;
+    for(std::size_t i=first; i<beyond; ++i)
+      bb += m_boxes[m_order[i]];
+    return bb;
+  }
+
+  std::uint32_t build_node(const Range& range, std::vector<Node>& nodes)
+  {
+    const std::uint32_t node_id = static_cast<std::uint32_t>(nodes.size());
+    nodes.emplace_back();
+
+    std::array<Range, Arity> children;
+    unsigned int nb_children = 1;
+    children[0] = range;
+    children[0].is_leaf = !split_possible(range);
+
+    // split the child with the largest area until the node is full
+    while(nb_children < Arity)
+    {
+      int best = -1;
+      double best_area = -1;
+      for(unsigned int i=0; i<nb_children; ++i)
+      {
+        if(children[i].is_leaf)
+          continue;
+        const double a = half_area(children[i].bbox);
+        if(a > best_area)
+        {
+          best_area = a;
+          best = static_cast<int>(i);
+        }
+      }
+      if(best == -1)
+        break;
+
+      Range left, right;
+      if(!split(children[best], left, right))
+      {
+        children[best].is_leaf = true;
+        continue;
+      }
+      left.is_leaf = !split_possible(left);
+      right.is_leaf = !split_possible(right);
+      children[best] = left;
+      children[nb_children++] = right;
+    }
+
+    for(unsigned int i=0; i<nb_children; ++i)
+    {
+      const Range& c = children[i];
+      bool make_leaf = c.is_leaf;
+      if(!make_leaf && c.size() <= max_leaf_size)
+      {
+        // check whether splitting this small range is worth a node
+        Range left, right;
+        make_leaf = !split(c, left, right);
+      }
+
+      nodes[node_id].set_bbox(i, c.bbox);
+      if(make_leaf)
+      {
+        nodes[node_id].m_child[i] = static_cast<std::uint32_t>(c.first);
+        nodes[node_id].m_size[i] = static_cast<std::uint32_t>(c.size());
+      }
+      else
+      {
+        const std::uint32_t child_id = build_node(c, nodes);
+        nodes[node_id].m_child[i] = child_id;
+        nodes[node_id].m_size[i] = 0;
+      }
+    }
+    return node_id;
+  }
+
+  bool split_possible(const Range& range) const
+  {
+    return range.size() > 1;
+  }
+
+  // splits `range` into `left` and `right`, and returns `false` if
+  // the range should rather be a leaf.
+  bool split(const Range& range, Range& left, Range& right)
+  {
+    const std::size_t n = range.size();
+    if(n <= 1)
+      return false;
+
+    Bbox_3 cbox;
+    for(std::size_t i=range.first; i<range.beyond; ++i)
+    {
+      const std::array<double, 3>& c = m_centroids[m_order[i]];
+      cbox += Bbox_3(c[0], c[1], c[2], c[0], c[1], c[2]);
+    }
+
+    std::size_t mid = range.first;
+    if(range.depth >= max_sah_depth)
+    {
+      mid = median_split(range, cbox);
+    }
+    else
+    {
+      int best_axis = -1;
+      std::size_t best_bin = 0;
+      double best_cost = (std::numeric_limits<double>::max)();
+
+      for(int axis=0; axis<3; ++axis)
+      {
+        const double lo = cbox.min_coord(axis), extent = cbox.max_coord(axis) - lo;
+        if(!(extent > 0))
+          continue;
+        const double scale = double(nb_bins) / extent;
+
+        std::array<std::size_t, nb_bins> counts;
+        std::array<Bbox_3, nb_bins> bins;
+        counts.fill(0);
+        for(std::size_t i=range.first; i<range.beyond; ++i)
+        {
+          const std::size_t b = bin_index(m_centroids[m_order[i]][axis], lo, scale);
+          ++counts[b];
+          bins[b] += m_boxes[m_order[i]];
+        }
+
+        // sweep from the right to get the areas of the right sides
+        std::array<double, nb_bins> right_area;
+        std::array<std::size_t, nb_bins> right_count;
+        Bbox_3 acc;
+        std::size_t cnt = 0;
+        for(std::size_t b=nb_bins-1; b>0; --b)
+        {
+          if(counts[b] != 0)
+            acc += bins[b];
+          cnt += counts[b];
+          right_area[b] = cnt == 0 ? 0. : half_area(acc);
+          right_count[b] = cnt;
+        }
+
+        // sweep from the left and evaluate the cost of splitting after bin `b`
+        acc = Bbox_3();
+        cnt = 0;
+        for(std::size_t b=0; b+1<nb_bins; ++b)
+        {
+          if(counts[b] != 0)
+            acc += bins[b];
+          cnt += counts[b];
+          if(cnt == 0 || right_count[b+1] == 0)
+            continue;
+          const double cost = half_area(acc) * double(cnt) + right_area[b+1] * double(right_count[b+1]);
+          if(cost < best_cost)
+          {
+            best_cost = cost;
+            best_axis = axis;
+            best_bin = b;
+          }
+        }
+      }
+
+      if(best_axis == -1)
+      {
+        // all centroids are identical: nothing to gain by splitting
+        if(n <= max_leaf_size)
+          return false;
+        mid = range.first + n / 2;
+      }
+      else
+      {
+        const double area = half_area(range.bbox);
+        const double split_cost = area > 0 ? traversal_cost + best_cost / area : traversal_cost + double(n);
+        if(n <= max_leaf_size && split_cost >= double(n))
+          return false;
+
+        const double lo = cbox.min_coord(best_axis);
+        const double scale = double(nb_bins) / (cbox.max_coord(best_axis) - lo);
+        auto it = std::partition(m_order.begin() + range.first, m_order.begin() + range.beyond,
+                                 [&](std::size_t p)
+                                 {
+                                   return bin_index(m_centroids[p][best_axis], lo, scale) <= best_bin;
+                                 });
+        mid = static_cast<std::size_t>(it - m_order.begin());
+        if(mid == range.first || mid == range.beyond)
+          mid = median_split(range, cbox);
+      }
+    }
+
+    left = Range { range.first, mid, range_bbox(range.first, mid), range.depth + 1, false };
+    right = Range { mid, range.beyond, range_bbox(mid, range.beyond), range.depth + 1, false };
+    return true;
+  }
+
+  static std::size_t bin_index(double c, double lo, double scale)
+  {
+    const double b = (c - lo) * scale;
+    return b <= 0 ? 0 : (std::min)(static_cast<std::size_t>(b), nb_bins - 1);
+  }
+
+  std::size_t median_split(const Range& range, const Bbox_3& cbox)
+  {
+    const int axis = cbox.x_span() >= cbox.y_span() ? (cbox.x_span() >= cbox.z_span() ? 0 : 2)
+                                                    : (cbox.y_span() >= cbox.z_span() ? 1 : 2);
+    const std::size_t mid = range.first + range.size() / 2;
+    std::nth_element(m_order.begin() + range.first, m_order.begin() + mid, m_order.begin() + range.beyond,
+                     [&](std::size_t a, std::size_t b)
+                     {
+                       return m_centroids[a][axis] < m_centroids[b][axis];
+                     });
+    return mid;
+  }
+
+private:
+  const std::vector<Bbox_3>& m_boxes;
+  std::vector<std::array<double, 3> > m_centroids;
+  std::vector<std::size_t> m_order;
+};
+
+} } // end namespace internal::AABB_tree
+
+/// \cond SKIP_IN_MANUAL
+
+// AABB tree built with the surface area heuristic and stored as a flat
+// array of `Arity`-wide nodes, see `AABB_SAH_wide_tree_tag`.
+template <typename AABBTraits, unsigned int Arity>
+class AABB_tree<AABBTraits, AABB_SAH_wide_tree_tag<Arity> >
+{
+  static_assert(std::is_same<typename AABBTraits::Bounding_box, Bbox_3>::value,
+                "AABB_SAH_wide_tree_tag requires a traits class with Bbox_3 as bounding box type");
+
+private:
+  typedef std::vector<typename AABBTraits::Primitive> Primitives;
+  typedef internal::Primitive_helper<AABBTraits> Helper;
+  typedef AABB_tree<AABBTraits, AABB_SAH_wide_tree_tag<Arity> > Self;
+
+  typedef internal::AABB_tree::SAH_wide_node<Arity> Wide_node;
+  typedef internal::AABB_tree::SAH_wide_tree_builder<Arity> Builder;
+  typedef internal::AABB_tree::SAH_wide_ray Wide_ray;
+
+public:
+  typedef AABBTraits AABB_traits;
+
+  typedef typename AABBTraits::FT FT;
+  typedef typename AABBTraits::Point Point;
+  typedef typename AABBTraits::Primitive Primitive;
+  typedef typename Primitive::Id Primitive_id;
+  typedef typename Primitives::size_type size_type;
+  typedef typename AABBTraits::Bounding_box Bounding_box;
+  typedef typename AABBTraits::Point_and_primitive_id Point_and_primitive_id;
+  typedef typename AABBTraits::Object_and_primitive_id Object_and_primitive_id;
+
+  template<typename Query>
+  struct Intersection_and_primitive_id {
+    typedef typename AABBTraits::template Intersection_and_primitive_id<Query>::Type Type;
+  };
+
+  // type of the node passed to the traversal traits
+  typedef AABB_node<AABBTraits> Node;
+
+public:
+  AABB_tree(const AABBTraits& traits = AABBTraits())
+    : m_traits(traits)
+#ifdef CGAL_HAS_THREADS
+    , m_atomic_need_build(false)
+#endif
+  {}
+
+  template<typename InputIterator, typename ... T>
+  AABB_tree(InputIterator first, InputIterator beyond, T&& ... t)
+#ifdef CGAL_HAS_THREADS
+    : m_atomic_need_build(false)
+#endif
+  {
+    insert(first, beyond, std::forward<T>(t)...);
+  }
+
+  AABB_tree(Self&& tree) noexcept
+  {
+    *this = std::move(tree);
+  }
+
+  Self& operator=(Self&& tree) noexcept
+  {
+    m_traits = std::move(tree.m_traits);
+    m_primitives = std::move(tree.m_primitives);
+    m_nodes = std::move(tree.m_nodes);
+#ifdef CGAL_HAS_THREADS
+    m_atomic_need_build = tree.m_atomic_need_build.load(std::memory_order_relaxed);
+#else
+    m_need_build = std::exchange(tree.m_need_build, false);
+#endif
+    return *this;
+  }
+
+  AABB_tree(const Self&) = delete;
+  Self& operator=(const Self&) = delete;
+
+  template<typename ... T>
+  void build(T&& ... t)
+  {
+    set_shared_data(std::forward<T>(t)...);
+    build();
+  }
+
+  void build();
+
+  template <typename ConcurrencyTag = Sequential_tag>
+  void refit();
+
+  template<typename ConstPrimitiveIterator, typename ... T>
+  void rebuild(ConstPrimitiveIterator first, ConstPrimitiveIterator beyond, T&& ... t)
+  {
+    clear();
+    insert(first, beyond, std::forward<T>(t)...);
+    build();
+  }
+
+  template<typename InputIterator, typename ... T>
+  void insert(InputIterator first, InputIterator beyond, T&& ... t)
+  {
+    set_shared_data(std::forward<T>(t)...);
+    while(first != beyond)
+    {
+      m_primitives.push_back(Primitive(first, std::forward<T>(t)...));
+      ++first;
+    }
+    set_need_build(true);
+  }
+
+  void insert(const Primitive& p)
+  {
+    m_primitives.push_back(p);
+    set_need_build(true);
+  }
+
+  ~AABB_tree()
+  {
+    clear();
+  }
+
+  const AABBTraits& traits() const { return m_traits; }
+
+  void clear()
+  {
+    m_nodes.clear();
+    m_primitives.clear();
+  }
+
+  const Bounding_box bbox() const
+  {
+    CGAL_precondition(!empty());
+    const Wide_node& r = root();
+    Bounding_box bb;
+    for(unsigned int i=0; i<Arity; ++i)
+      if(!r.is_empty(i))
+        bb += r.bbox(i);
+    return bb;
+  }
+
+  size_type size() const { return m_primitives.size(); }
+  bool empty() const { return m_primitives.empty(); }
+
+  // Intersection tests
+
+  template<typename Query>
+  bool do_intersect(const Query& query) const
+  {
+    internal::AABB_tree::Do_intersect_traits<AABBTraits, Query> traversal_traits(m_traits);
+    this->traversal(query, traversal_traits);
+    return traversal_traits.is_intersection_found();
+  }
+
+  template<typename Query>
+  size_type number_of_intersected_primitives(const Query& query) const
+  {
+    typedef internal::AABB_tree::Counting_output_iterator<Primitive_id, size_type> Counting_iterator;
+    size_type counter = 0;
+    Counting_iterator out(&counter);
+    internal::AABB_tree::Listing_primitive_traits<AABBTraits, Query, Counting_iterator> traversal_traits(out, m_traits);
+    this->traversal(query, traversal_traits);
+    return counter;
+  }
+
+  template<typename Query, typename OutputIterator>
+  OutputIterator all_intersected_primitives(const Query& query, OutputIterator out) const
+  {
+    internal::AABB_tree::Listing_primitive_traits<AABBTraits, Query, OutputIterator> traversal_traits(out, m_traits);
+    this->traversal(query, traversal_traits);
+    return out;
+  }
+
+  template <typename Query>
+  std::optional<Primitive_id> any_intersected_primitive(const Query& query) const
+  {
+    internal::AABB_tree::First_primitive_traits<AABBTraits, Query> traversal_traits(m_traits);
+    this->traversal(query, traversal_traits);
+    return traversal_traits.result();
+  }
+
+  // Intersections
+
+  template<typename Query, typename OutputIterator>
+  OutputIterator all_intersections(const Query& query, OutputIterator out) const
+  {
+    internal::AABB_tree::Listing_intersection_traits<AABBTraits, Query, OutputIterator> traversal_traits(out, m_traits);
+    this->traversal(query, traversal_traits);
+    return out;
+  }
+
+  template <typename Query>
+  std::optional< typename Intersection_and_primitive_id<Query>::Type >
+  any_intersection(const Query& query) const
+  {
+    internal::AABB_tree::First_intersection_traits<AABBTraits, Query> traversal_traits(m_traits);
+    this->traversal(query, traversal_traits);
+    return traversal_traits.result();
+  }
+
+  template<typename Ray, typename SkipFunctor>
+  std::optional< typename Intersection_and_primitive_id<Ray>::Type >
+  first_intersection(const Ray& query, const SkipFunctor& skip) const;
+
+  template<typename Ray>
+  std::optional< typename Intersection_and_primitive_id<Ray>::Type >
+  first_intersection(const Ray& query) const
+  {
+    return first_intersection(query, [](Primitive_id){ return false; });
+  }
+
+  template<typename Ray, typename SkipFunctor>
+  std::optional<Primitive_id>
+  first_intersected_primitive(const Ray& query, const SkipFunctor& skip) const
+  {
+    auto res = first_intersection(query, skip);
+    if(res)
+      return std::make_optional(res->second);
+    return std::nullopt;
+  }
+
+  template<typename Ray>
+  std::optional<Primitive_id>
+  first_intersected_primitive(const Ray& query) const
+  {
+    return first_intersected_primitive(query, [](Primitive_id){ return false; });
+  }
+
+  // Distance queries: the hint is obtained by a greedy descent in the tree,
+  // there is no secondary search tree.
+
+  FT squared_distance(const Point& query) const
+  {
+    CGAL_precondition(!empty());
+    return m_traits.squared_distance_object()(query, closest_point(query));
+  }
+
+  Point closest_point(const Point& query) const
+  {
+    CGAL_precondition(!empty());
+    return closest_point_and_primitive(query, best_hint(query)).first;
+  }
+
+  Point_and_primitive_id closest_point_and_primitive(const Point& query) const
+  {
+    CGAL_precondition(!empty());
+    return closest_point_and_primitive(query, best_hint(query));
+  }
+
+  FT squared_distance(const Point& query, const Point& hint) const
+  {
+    CGAL_precondition(!empty());
+    return m_traits.squared_distance_object()(query, closest_point(query, hint));
+  }
+
+  Point closest_point(const Point& query, const Point& hint) const
+  {
+    CGAL_precondition(!empty());
+    return closest_point_and_primitive(query, Point_and_primitive_id(hint, m_primitives[0].id())).first;
+  }
+
+  Point_and_primitive_id closest_point_and_primitive(const Point& query, const Point_and_primitive_id& hint) const
+  {
+    CGAL_precondition(!empty());
+    internal::AABB_tree::Projection_traits<AABBTraits> projection_traits(hint.first, hint.second, m_traits);
+    this->traversal_nearest_first(query, projection_traits);
+    return projection_traits.closest_point_and_primitive();
+  }
+
+  // Batch queries, see the default tree
+
+  template <typename ConcurrencyTag = Sequential_tag, typename PointRange, typename OutputIterator>
+  OutputIterator closest_points_and_primitives(const PointRange& queries, OutputIterator out) const
+  {
+    return internal::AABB_tree::closest_points_and_primitives<ConcurrencyTag>(*this, queries, out);
+  }
+
+  template <typename ConcurrencyTag = Sequential_tag, typename PointRange, typename OutputIterator>
+  OutputIterator squared_distances(const PointRange& queries, OutputIterator out) const
+  {
+    return internal::AABB_tree::squared_distances<ConcurrencyTag>(*this, queries, out);
+  }
+
+  template <typename ConcurrencyTag = Sequential_tag, typename RayRange, typename OutputIterator>
+  OutputIterator first_intersections(const RayRange& queries, OutputIterator out) const
+  {
+    return internal::AABB_tree::first_intersections<ConcurrencyTag>(*this, queries, out);
+  }
+
+  // returns the reference point of a primitive in the leaf reached by
+  // descending in the child whose box is the closest to `query`
+  Point_and_primitive_id best_hint(const Point& query) const
+  {
+    CGAL_precondition(!empty());
+    const std::array<double, 3> q = to_double_array(query);
+    const Wide_node* n = &root();
+    for(;;)
+    {
+      double sd[Arity];
+      n->squared_distances(q, sd);
+      const unsigned int i = static_cast<unsigned int>(std::min_element(sd, sd + Arity) - sd);
+      CGAL_assertion(!n->is_empty(i));
+      if(n->is_leaf(i))
+      {
+        const Primitive& p = m_primitives[n->m_child[i]];
+        return Point_and_primitive_id(Helper::get_reference_point(p, m_traits), p.id());
+      }
+      n = &m_nodes[n->m_child[i]];
+    }
+  }
+
+  Point_and_primitive_id any_reference_point_and_id() const
+  {
+    CGAL_assertion(!empty());
+    return Point_and_primitive_id(Helper::get_reference_point(m_primitives[0], m_traits), m_primitives[0].id());
+  }
+
+  typename Helper::Datum_type datum(Primitive& p) const
+  {
+    return Helper::get_datum(p, this->traits());
+  }
+
+  // Generic traversal: `Traversal_traits` is given an `AABB_node` whose
+  // bounding box is the one of the child being visited.
+  template <class Query, class Traversal_traits>
+  void traversal(const Query& query, Traversal_traits& traits) const
+  {
+    if(empty())
+      return;
+
+    Node proxy;
+    std::vector<std::uint32_t> stack;
+    stack.reserve(64);
+    stack.push_back(0);
+    const Wide_node* nodes = root_ptr();
+    while(!stack.empty())
+    {
+      const Wide_node& n = nodes[stack.back()];
+      stack.pop_back();
+
+      // children are pushed in reverse order to visit them in order
+      for(unsigned int j=Arity; j>0; --j)
+      {
+        const unsigned int i = j - 1;
+        if(n.is_empty(i) || n.is_leaf(i))
+          continue;
+        proxy.set_bbox(n.bbox(i));
+        if(traits.do_intersect(query, proxy))
+          stack.push_back(n.m_child[i]);
+      }
+
+      for(unsigned int i=0; i<Arity; ++i)
+      {
+        if(n.is_empty(i) || !n.is_leaf(i))
+          continue;
+        proxy.set_bbox(n.bbox(i));
+        if(!traits.do_intersect(query, proxy))
+          continue;
+        for(std::uint32_t k=n.m_child[i], end=n.m_child[i]+n.m_size[i]; k<end; ++k)
+        {
+          traits.intersection(query, m_primitives[k]);
+          if(!traits.go_further())
+            return;
+        }
+      }
+    }
+  }
+
+  // Same as `traversal()` but the children of a node are visited by
+  // increasing distance of their bounding boxes to `query`.
+  template <class Traversal_traits>
+  void traversal_nearest_first(const Point& query, Traversal_traits& traits) const
+  {
+    if(empty())
+      return;
+
+    const std::array<double, 3> q = to_double_array(query);
+    Node proxy;
+    std::vector<std::uint32_t> stack;
+    stack.reserve(64);
+    stack.push_back(0);
+    const Wide_node* nodes = root_ptr();
+    while(!stack.empty())
+    {
+      const Wide_node& n = nodes[stack.back()];
+      stack.pop_back();
+
+      double sd[Arity];
+      n.squared_distances(q, sd);
+      unsigned int order[Arity];
+      std::iota(order, order + Arity, 0u);
+      internal::AABB_tree::sort_children(order, Arity, sd);
+
+      // leaves first, nearest first, then inner nodes, nearest on top of the stack
+      for(unsigned int i : order)
+      {
+        if(n.is_empty(i) || !n.is_leaf(i))
+          continue;
+        proxy.set_bbox(n.bbox(i));
+        if(!traits.do_intersect(query, proxy))
+          continue;
+        for(std::uint32_t k=n.m_child[i], end=n.m_child[i]+n.m_size[i]; k<end; ++k)
+        {
+          traits.intersection(query, m_primitives[k]);
+          if(!traits.go_further())
+            return;
+        }
+      }
+      for(unsigned int j=Arity; j>0; --j)
+      {
+        const unsigned int i = order[j - 1];
+        if(n.is_empty(i) || n.is_leaf(i))
+          continue;
+        proxy.set_bbox(n.bbox(i));
+        if(traits.do_intersect(query, proxy))
+          stack.push_back(n.m_child[i]);
+      }
+    }
+  }
+
+  // returns the number of nodes of the tree
+  std::size_t number_of_nodes() const
+  {
+    if(!empty())
+      root();
+    return m_nodes.size();
+  }
+
+private:
+  template <typename ... T>
+  void set_primitive_data_impl(CGAL::Boolean_tag<false>, T ... ) {}
+  template <typename ... T>
+  void set_primitive_data_impl(CGAL::Boolean_tag<true>, T&& ... t)
+  { m_traits.set_shared_data(std::forward<T>(t)...); }
+
+  template <typename ... T>
+  void set_shared_data(T&& ... t)
+  {
+    set_primitive_data_impl(CGAL::Boolean_tag<internal::Has_nested_type_Shared_data<Primitive>::value>(), std::forward<T>(t)...);
+  }
+
+  void set_need_build(bool b)
+  {
+#ifdef CGAL_HAS_THREADS
+    m_atomic_need_build.store(b, std::memory_order_release);
+#else
+    m_need_build = b;
+#endif
+  }
+
+  static std::array<double, 3> to_double_array(const Point& p)
+  {
+    return {{ CGAL::to_double(p.x()), CGAL::to_double(p.y()), CGAL::to_double(p.z()) }};
+  }
+
+  const Wide_node* root_ptr() const
+  {
+    return std::addressof(root());
+  }
+
+  const Wide_node& root() const
+  {
+    CGAL_assertion(!empty());
+#ifdef CGAL_HAS_THREADS
+    bool m_need_build = m_atomic_need_build.load(std::memory_order_acquire);
+#endif
+    if(m_need_build)
+    {
+#ifdef CGAL_HAS_THREADS
+      // this ensures that build() will be called once
+      CGAL_SCOPED_LOCK(build_mutex);
+      m_need_build = m_atomic_need_build.load(std::memory_order_relaxed);
+      if(m_need_build)
+#endif
+      const_cast<Self*>(this)->build();
+    }
+    return m_nodes[0];
+  }
+
+private:
+  AABBTraits m_traits;
+  // primitives, sorted in the order of the leaves of the tree after `build()`
+  Primitives m_primitives;
+  // tree nodes in depth-first order, the first node is the root node
+  std::vector<Wide_node> m_nodes;
+#ifdef CGAL_HAS_THREADS
+  mutable CGAL_MUTEX build_mutex;
+  std::atomic<bool> m_atomic_need_build;
+#else
+  bool m_need_build = false;
+#endif
+};
+
+template <typename AABBTraits, unsigned int Arity>
+void
+AABB_tree<AABBTraits, AABB_SAH_wide_tree_tag<Arity> >::build()
+{
+  m_nodes.clear();
+
+  if(!m_primitives.empty())
+  {
+    CGAL_precondition(m_primitives.size() < std::size_t(Wide_node::invalid));
+
+    std::vector<Bbox_3> boxes;
+    boxes.reserve(m_primitives.size());
+    typename AABBTraits::Compute_bbox compute_bbox = m_traits.compute_bbox_object();
+    for(auto it=m_primitives.begin(); it!=m_primitives.end(); ++it)
+      boxes.push_back(compute_bbox(it, std::next(it)));
+
+    Builder builder(boxes);
+    const std::vector<std::size_t>& order = builder.build(m_nodes);
+
+    // store the primitives in the order of the leaves
+    Primitives sorted_primitives;
+    sorted_primitives.reserve(m_primitives.size());
+    for(std::size_t i : order)
+      sorted_primitives.push_back(m_primitives[i]);
+    m_primitives.swap(sorted_primitives);
+  }
+
+  set_need_build(false);
+}
+
+template <typename AABBTraits, unsigned int Arity>
+template <typename ConcurrencyTag>
+void
+AABB_tree<AABBTraits, AABB_SAH_wide_tree_tag<Arity> >::refit()
+{
+#ifdef CGAL_HAS_THREADS
+  bool m_need_build = m_atomic_need_build.load(std::memory_order_acquire);
+#endif
+  if(m_need_build)
+    return build();
+
+  // boxes of the leaves, which do not depend on other nodes
+  typename AABBTraits::Compute_bbox compute_bbox = m_traits.compute_bbox_object();
+  internal::AABB_tree::for_each_batch<ConcurrencyTag>(m_nodes.size(),
+    [&](const std::size_t first, const std::size_t beyond)
+    {
+      for(std::size_t n=first; n<beyond; ++n)
+      {
+        Wide_node& node = m_nodes[n];
+        for(unsigned int i=0; i<Arity; ++i)
+        {
+          if(node.is_empty(i) || !node.is_leaf(i))
+            continue;
+          const auto leaf_begin = m_primitives.cbegin() + node.m_child[i];
+          node.set_bbox(i, compute_bbox(leaf_begin, leaf_begin + node.m_size[i]));
+        }
+      }
+    });
+
+  // boxes of the inner children, bottom-up as the children of a node are stored after it
+  for(std::size_t n=m_nodes.size(); n-- > 0; )
+  {
+    Wide_node& node = m_nodes[n];
+    for(unsigned int i=0; i<Arity; ++i)
+      if(!node.is_empty(i) && !node.is_leaf(i))
+        node.set_bbox(i, m_nodes[node.m_child[i]].bbox());
+  }
+}
+
+template <typename AABBTraits, unsigned int Arity>
+template <typename Ray, typename SkipFunctor>
+std::optional< typename AABB_tree<AABBTraits, AABB_SAH_wide_tree_tag<Arity> >::template Intersection_and_primitive_id<Ray>::Type >
+AABB_tree<AABBTraits, AABB_SAH_wide_tree_tag<Arity> >::first_intersection(const Ray& query,
+                                                                         const SkipFunctor& skip) const
+{
+  static_assert(std::is_same<Ray, typename AABBTraits::Ray>::value,
+                "Ray and AABBTraits::Ray must be the same type");
+
+  typedef std::optional< typename Intersection_and_primitive_id<Ray>::Type > Result;
+  if(empty())
+    return std::nullopt;
+
+  const typename AABBTraits::Vector v = AABBTraits().construct_vector_object()(query);
+  const Wide_ray ray(to_double_array(AABBTraits().construct_source_object()(query)),
+                     {{ CGAL::to_double(v[0]), CGAL::to_double(v[1]), CGAL::to_double(v[2]) }});
+
+  typename AABBTraits::Intersection intersection_obj = m_traits.intersection_object();
+  internal::AABB_tree::As_ray_param_visitor<AABBTraits> param_visitor(&query);
+
+  Result result;
+  FT t_best = 0;
+  double t_max = std::numeric_limits<double>::infinity();
+
+  // stack of nodes with the ray parameter at which the ray enters them
+  std::vector<std::pair<std::uint32_t, double> > stack;
+  stack.reserve(64);
+  stack.emplace_back(0, 0.);
+  const Wide_node* nodes = root_ptr();
+
+  constexpr double robust = 1. + 4. * std::numeric_limits<double>::epsilon();
+  while(!stack.empty())
+  {
+    const std::pair<std::uint32_t, double> current = stack.back();
+    stack.pop_back();
+    if(current.second > t_max * robust)
+      continue;
+
+    const Wide_node& n = nodes[current.first];
+    double t_near[Arity];
+    unsigned int mask = ray.intersect(n, t_max, t_near);
+    if(mask == 0)
+      continue;
+
+    // sort hit children by entry parameter
+    unsigned int hits[Arity];
+    unsigned int nb_hits = 0;
+    for(unsigned int i=0; i<Arity; ++i)
+      if(mask & (1u << i))
+        hits[nb_hits++] = i;
+    internal::AABB_tree::sort_children(hits, nb_hits, t_near);
+
+    // intersect the primitives of the leaves, nearest first
+    for(unsigned int h=0; h<nb_hits; ++h)
+    {
+      const unsigned int i = hits[h];
+      if(!n.is_leaf(i) || t_near[i] > t_max * robust)
+        continue;
+      for(std::uint32_t k=n.m_child[i], end=n.m_child[i]+n.m_size[i]; k<end; ++k)
+      {
+        const Primitive& p = m_primitives[k];
+        if(skip(p.id()))
+          continue;
+        Result intersection = intersection_obj(query, p);
+        if(!intersection)
+          continue;
+        const FT t = std::visit(param_visitor, intersection->first);
+        if(!result || t < t_best)
+        {
+          t_best = t;
+          t_max = CGAL::to_double(t_best);
+          result = intersection;
+        }
+      }
+    }
+
+    // push inner nodes, the nearest being on top of the stack
+    for(unsigned int h=nb_hits; h>0; --h)
+    {
+      const unsigned int i = hits[h - 1];
+      if(!n.is_leaf(i))
+        stack.emplace_back(n.m_child[i], t_near[i]);
+    }
+  }
+
+  return result;
+}
+
+/// \endcond
+
+} // end namespace CGAL
+
+#endif // CGAL_AABB_SAH_WIDE_TREE_H
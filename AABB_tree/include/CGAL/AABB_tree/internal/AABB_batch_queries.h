@@ -0,0 +1,177 @@
+// Copyright (c) 2026 GeometryFactory (France).
+// All rights reserved.
+//
+// This file is part of CGAL (www.cgal.org).
+//
+// $URL$
+// $Id$
+// SPDX-License-Identifier: GPL-3.0-or-later OR LicenseRef-Commercial
+//
+//
+// Author(s) : GeometryFactory
+//
+
+#ifndef CGAL_AABB_TREE_INTERNAL_AABB_BATCH_QUERIES_H
+#define CGAL_AABB_TREE_INTERNAL_AABB_BATCH_QUERIES_H
+
+#include <CGAL/license/AABB_tree.h>
+
+#include <CGAL/Dimension.h>
+#include <CGAL/hilbert_sort.h>
+#include <CGAL/Kernel_traits.h>
+#include <CGAL/property_map.h>
+#include <CGAL/Spatial_sort_traits_adapter_2.h>
+#include <CGAL/Spatial_sort_traits_adapter_3.h>
+#include <CGAL/tags.h>
+
+#ifdef CGAL_LINKED_WITH_TBB
+#include <tbb/blocked_range.h>
+#include <tbb/parallel_for.h>
+#endif
+
+#include <algorithm>
+#include <iterator>
+#include <numeric>
+#include <optional>
+#include <type_traits>
+#include <vector>
+
+namespace CGAL {
+namespace internal {
+namespace AABB_tree {
+
+// Number of consecutive queries handled by a single task. Within a batch,
+// the queries are answered sequentially and, for distance queries, the
+// result of a query is used as hint for the next one.
+constexpr std::size_t batch_size = 256;
+
+// returns the permutation of the indices of `points` sorting them along a Hilbert curve
+template <typename ConcurrencyTag, typename GeomTraits, typename Point>
+std::vector<std::size_t>
+hilbert_order(const std::vector<Point>& points, const GeomTraits& gt)
+{
+  typedef typename Pointer_property_map<Point>::const_type                  Pmap;
+  typedef std::conditional_t<Ambient_dimension<Point>::value == 2,
+                             Spatial_sort_traits_adapter_2<GeomTraits, Pmap>,
+                             Spatial_sort_traits_adapter_3<GeomTraits, Pmap> > Sort_traits;
+
+  std::vector<std::size_t> order(points.size());
+  std::iota(order.begin(), order.end(), std::size_t(0));
+  hilbert_sort<ConcurrencyTag>(order.begin(), order.end(),
+                               Sort_traits(make_property_map(points), gt),
+                               Hilbert_sort_median_policy());
+  return order;
+}
+
+// calls `f(first, beyond)` on consecutive subranges covering `[0, n[`,
+// in parallel if `ConcurrencyTag` is `Parallel_tag`
+template <typename ConcurrencyTag, typename Functor>
+void for_each_batch(const std::size_t n, const Functor& f)
+{
+#ifndef CGAL_LINKED_WITH_TBB
+  static_assert (!std::is_convertible<ConcurrencyTag, Parallel_tag>::value,
+                 "Parallel_tag is enabled but TBB is unavailable.");
+#else
+  if(std::is_convertible<ConcurrencyTag, Parallel_tag>::value)
+  {
+    tbb::parallel_for(tbb::blocked_range<std::size_t>(0, n, batch_size),
+                      [&f](const tbb::blocked_range<std::size_t>& r)
+                      {
+                        f(r.begin(), r.end());
+                      });
+    return;
+  }
+#endif
+  for(std::size_t first=0; first<n; first+=batch_size)
+    f(first, (std::min)(first + batch_size, n));
+}
+
+template <typename ConcurrencyTag, typename AABBTree, typename PointRange, typename OutputIterator>
+OutputIterator
+closest_points_and_primitives(const AABBTree& tree, const PointRange& queries, OutputIterator out)
+{
+  typedef typename AABBTree::AABB_traits                                    AABBTraits;
+  typedef typename AABBTraits::Point                                        Point;
+  typedef typename AABBTraits::Point_and_primitive_id                       Point_and_primitive_id;
+
+  const std::vector<Point> points(std::begin(queries), std::end(queries));
+  if(points.empty())
+    return out;
+  CGAL_precondition(!tree.empty());
+
+  const std::vector<std::size_t> order =
+    hilbert_order<ConcurrencyTag>(points, typename Kernel_traits<Point>::Kernel());
+
+  // the hint of the first query of a batch is given by the tree, the next
+  // ones start from the closest point of the previous query
+  std::vector<Point_and_primitive_id> results(points.size());
+  for_each_batch<ConcurrencyTag>(points.size(),
+                                 [&](const std::size_t first, const std::size_t beyond)
+                                 {
+                                   Point_and_primitive_id hint = tree.best_hint(points[order[first]]);
+                                   for(std::size_t i=first; i<beyond; ++i)
+                                   {
+                                     const std::size_t id = order[i];
+                                     hint = tree.closest_point_and_primitive(points[id], hint);
+                                     results[id] = hint;
+                                   }
+                                 });
+
+  return std::copy(results.begin(), results.end(), out);
+}
+
+template <typename ConcurrencyTag, typename AABBTree, typename PointRange, typename OutputIterator>
+OutputIterator
+squared_distances(const AABBTree& tree, const PointRange& queries, OutputIterator out)
+{
+  typedef typename AABBTree::AABB_traits                                    AABBTraits;
+  typedef typename AABBTraits::Point                                        Point;
+  typedef typename AABBTraits::Point_and_primitive_id                       Point_and_primitive_id;
+
+  std::vector<Point_and_primitive_id> closest_points;
+  closest_points_and_primitives<ConcurrencyTag>(tree, queries, std::back_inserter(closest_points));
+
+  typename AABBTraits::Squared_distance squared_distance = tree.traits().squared_distance_object();
+  std::size_t i = 0;
+  for(const Point& query : queries)
+    *out++ = squared_distance(query, closest_points[i++].first);
+  return out;
+}
+
+template <typename ConcurrencyTag, typename AABBTree, typename RayRange, typename OutputIterator>
+OutputIterator
+first_intersections(const AABBTree& tree, const RayRange& queries, OutputIterator out)
+{
+  typedef typename AABBTree::AABB_traits                                    AABBTraits;
+  typedef typename AABBTraits::Point                                        Point;
+  typedef typename std::iterator_traits<decltype(std::begin(queries))>::value_type Ray;
+  typedef std::optional<typename AABBTree::template Intersection_and_primitive_id<Ray>::Type> Result;
+
+  const std::vector<Ray> rays(std::begin(queries), std::end(queries));
+  if(rays.empty())
+    return out;
+
+  // rays with close sources are likely to traverse the same nodes
+  std::vector<Point> sources;
+  sources.reserve(rays.size());
+  for(const Ray& r : rays)
+    sources.push_back(AABBTraits().construct_source_object()(r));
+  const std::vector<std::size_t> order =
+    hilbert_order<ConcurrencyTag>(sources, typename Kernel_traits<Point>::Kernel());
+
+  std::vector<Result> results(rays.size());
+  for_each_batch<ConcurrencyTag>(rays.size(),
+                                 [&](const std::size_t first, const std::size_t beyond)
+                                 {
+                                   for(std::size_t i=first; i<beyond; ++i)
+                                     results[order[i]] = tree.first_intersection(rays[order[i]]);
+                                 });
+
+  return std::move(results.begin(), results.end(), out);
+}
+
+} // namespace AABB_tree
+} // namespace internal
+} // namespace CGAL
+
+#endif // CGAL_AABB_TREE_INTERNAL_AABB_BATCH_QUERIES_H
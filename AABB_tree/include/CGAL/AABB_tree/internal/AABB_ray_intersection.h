@@ -33,6 +33,53 @@
 
 namespace CGAL {
 
+namespace internal {
+namespace AABB_tree {
+
+// computes the parameter along a ray of (the closest endpoint of) an intersection
+// with this ray, that is the coefficient of the vector of the ray
+template <typename AABBTraits>
+struct As_ray_param_visitor
+{
+  static const int dimension = AABBTraits::Point::Ambient_dimension::value;
+  typedef typename AABBTraits::FT FT;
+  typedef typename AABBTraits::Point Point;
+  typedef typename AABBTraits::Vector Vector;
+  typedef typename AABBTraits::Ray Ray;
+
+  typedef FT result_type;
+  As_ray_param_visitor(const Ray* ray)
+   : ray(ray), max_i(0)
+  {
+    Vector v = AABBTraits().construct_vector_object()(*ray);
+    for (int i=1; i<dimension; ++i)
+      if( CGAL::abs(v[i]) > CGAL::abs(v[max_i]) )
+        max_i = i;
+  }
+
+  template<typename T>
+  FT operator()(const T& s)
+  {
+    // intersection is a segment, returns the min relative distance
+    // of its endpoints
+    FT r1 = this->operator()(s[0]);
+    FT r2 = this->operator()(s[1]);
+    return (std::min)(r1,r2);
+  }
+
+  FT operator()(const Point& point) {
+    Vector x = Vector(AABBTraits().construct_source_object()(*ray), point);
+    Vector v = AABBTraits().construct_vector_object()(*ray);
+
+    return x[max_i] / v[max_i];
+  }
+
+  const Ray* ray;
+  int max_i;
+};
+
+} } // end namespace internal::AABB_tree
+
 template<typename AABBTree, typename SkipFunctor>
 class AABB_ray_intersection {
   typedef typename AABBTree::AABB_traits AABB_traits;
@@ -42,6 +89,7 @@ class AABB_ray_intersection {
 
   typedef typename AABBTree::template Intersection_and_primitive_id<Ray>::Type Ray_intersection_and_primitive_id;
   typedef typename Ray_intersection_and_primitive_id::first_type Ray_intersection;
+  typedef internal::AABB_tree::As_ray_param_visitor<AABB_traits> as_ray_param_visitor;
 
 public:
   AABB_ray_intersection(const AABBTree& tree) : tree_(tree) {}
@@ -164,38 +212,6 @@ private:
     bool operator<(const Node_ptr_with_ft& other) const { return value < other.value; }
     bool operator>(const Node_ptr_with_ft& other) const { return value > other.value; }
   };
-
-  struct as_ray_param_visitor {
-    typedef FT result_type;
-    as_ray_param_visitor(const Ray* ray)
-     : ray(ray), max_i(0)
-    {
-      Vector v = AABB_traits().construct_vector_object()(*ray);
-      for (int i=1; i<dimension; ++i)
-        if( CGAL::abs(v[i]) > CGAL::abs(v[max_i]) )
-          max_i = i;
-    }
-
-    template<typename T>
-    FT operator()(const T& s)
-    {
-      // intersection is a segment, returns the min relative distance
-      // of its endpoints
-      FT r1 = this->operator()(s[0]);
-      FT r2 = this->operator()(s[1]);
-      return (std::min)(r1,r2);
-    }
-
-    FT operator()(const Point& point) {
-      Vector x = Vector(AABB_traits().construct_source_object()(*ray), point);
-      Vector v = AABB_traits().construct_vector_object()(*ray);
-
-      return x[max_i] / v[max_i];
-    }
-
-    const Ray* ray;
-    int max_i;
-  };
 };
 
 template<typename AABBTraits>
@@ -18,6 +18,7 @@
 #include <CGAL/Orthogonal_k_neighbor_search.h>
 #include <CGAL/Search_traits_adapter.h>
 #include <CGAL/property_map.h>
+#include <CGAL/tags.h>
 
 namespace CGAL
 {
@@ -47,8 +48,9 @@ private:
   }
 
 public:
-  template <class ConstPointIterator>
-  AABB_search_tree(ConstPointIterator begin, ConstPointIterator beyond)
+  template <class ConstPointIterator, class ConcurrencyTag = Sequential_tag>
+  AABB_search_tree(ConstPointIterator begin, ConstPointIterator beyond,
+                   const ConcurrencyTag& = ConcurrencyTag())
       : m_tree{}
   {
     std::vector<Point_and_primitive_id> points;
@@ -58,7 +60,7 @@ public:
       ++begin;
     }
     m_tree.insert(points.begin(), points.end());
-    m_tree.build();
+    m_tree.template build<ConcurrencyTag>();
   }
 
   template <typename Point>
@@ -0,0 +1,62 @@
+// Copyright (c) 2026 GeometryFactory (France).
+// All rights reserved.
+//
+// This file is part of CGAL (www.cgal.org).
+//
+// $URL$
+// $Id$
+// SPDX-License-Identifier: GPL-3.0-or-later OR LicenseRef-Commercial
+//
+//
+// Author(s) : GeometryFactory
+//
+
+#ifndef CGAL_AABB_TREE_BUILD_TAGS_H
+#define CGAL_AABB_TREE_BUILD_TAGS_H
+
+#include <CGAL/license/AABB_tree.h>
+
+/// \file AABB_tree_build_tags.h
+
+namespace CGAL {
+
+/// \addtogroup PkgAABBTreeRef
+/// @{
+
+/// Tag selecting the default construction of `AABB_tree`: a binary
+/// hierarchy built by recursively splitting the primitives at the median
+/// along the longest axis of their bounding box. The split can be
+/// customized through the functor `AABBTraits::Split_primitives`.
+struct AABB_median_split_tag {};
+
+/// Tag selecting a construction of `AABB_tree` based on the surface area
+/// heuristic (SAH). The binary SAH hierarchy is collapsed into a
+/// hierarchy with `Arity` children per node, which is stored in a flat
+/// array in depth-first order. The bounding boxes of the children of
+/// a node are stored next to each other coordinate by coordinate
+/// (structure-of-arrays layout), so that they can be tested together.
+///
+/// This construction is typically more expensive than the default one,
+/// but it results in much faster ray queries (`AABB_tree::first_intersection()`).
+///
+/// \tparam Arity the number of children per node, must be either 4 or 8.
+///
+/// \pre The traits class must have `Bbox_3` as `Bounding_box` type.
+template <unsigned int Arity = 4>
+struct AABB_SAH_wide_tree_tag
+{
+  static_assert(Arity == 4 || Arity == 8, "Arity must be either 4 or 8");
+  static constexpr unsigned int arity = Arity;
+};
+
+/// @}
+
+#ifndef DOXYGEN_RUNNING
+// forward declaration
+template <typename AABBTraits, typename BuildTag = AABB_median_split_tag>
+class AABB_tree;
+#endif
+
+} // end namespace CGAL
+
+#endif // CGAL_AABB_TREE_BUILD_TAGS_H
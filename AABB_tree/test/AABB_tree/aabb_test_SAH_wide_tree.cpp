@@ -0,0 +1,179 @@
+#include <CGAL/Exact_predicates_inexact_constructions_kernel.h>
+#include <CGAL/Surface_mesh.h>
+#include <CGAL/AABB_tree.h>
+#include <CGAL/AABB_traits_3.h>
+#include <CGAL/AABB_face_graph_triangle_primitive.h>
+#include <CGAL/point_generators_3.h>
+#include <CGAL/Random.h>
+
+#include <algorithm>
+#include <cassert>
+#include <fstream>
+#include <iostream>
+#include <iterator>
+#include <vector>
+
+typedef CGAL::Epick K;
+typedef K::FT FT;
+typedef K::Point_3 Point;
+typedef K::Vector_3 Vector;
+typedef K::Ray_3 Ray;
+typedef K::Segment_3 Segment;
+typedef CGAL::Surface_mesh<Point> Mesh;
+typedef CGAL::AABB_face_graph_triangle_primitive<Mesh> Primitive;
+typedef CGAL::AABB_traits_3<K, Primitive> Traits;
+typedef CGAL::AABB_tree<Traits> Tree;
+
+// the constructions of the intersection points and of the closest points are
+// not exact, and different traversal orders might report distinct primitives
+// realizing the same distance
+bool close(const FT a, const FT b)
+{
+  return CGAL::abs(a - b) <= 1e-10 * (std::max)(FT(1), (std::max)(CGAL::abs(a), CGAL::abs(b)));
+}
+
+// squared distance from the source of the ray to the first intersection, -1 if none
+template <class AABBTree>
+FT first_hit_distance(const AABBTree& tree, const Ray& ray)
+{
+  auto res = tree.first_intersection(ray);
+  if(!res)
+    return -1;
+  const Point* p = std::get_if<Point>(&(res->first));
+  if(p != nullptr)
+    return CGAL::squared_distance(ray.source(), *p);
+  const Segment* s = std::get_if<Segment>(&(res->first));
+  assert(s != nullptr);
+  return (std::min)(CGAL::squared_distance(ray.source(), s->source()),
+                    CGAL::squared_distance(ray.source(), s->target()));
+}
+
+template <unsigned int Arity>
+void test(const Mesh& mesh,
+          const std::vector<Ray>& rays,
+          const std::vector<Point>& points)
+{
+  typedef CGAL::AABB_tree<Traits, CGAL::AABB_SAH_wide_tree_tag<Arity> > Wide_tree;
+
+  Tree tree(faces(mesh).first, faces(mesh).second, mesh);
+  Wide_tree wide_tree(faces(mesh).first, faces(mesh).second, mesh);
+  wide_tree.build();
+
+  std::cout << "Arity " << Arity << ": " << wide_tree.number_of_nodes() << " nodes for "
+            << wide_tree.size() << " primitives" << std::endl;
+  assert(wide_tree.size() == tree.size());
+  assert(wide_tree.bbox() == tree.bbox());
+
+  std::size_t nb_hits = 0;
+  for(const Ray& r : rays)
+  {
+    const FT d1 = first_hit_distance(tree, r);
+    const FT d2 = first_hit_distance(wide_tree, r);
+    assert(close(d1, d2));
+    if(d1 >= 0)
+      ++nb_hits;
+
+    assert(tree.do_intersect(r) == wide_tree.do_intersect(r));
+    assert(tree.number_of_intersected_primitives(r) == wide_tree.number_of_intersected_primitives(r));
+
+    std::vector<Primitive::Id> ids1, ids2;
+    tree.all_intersected_primitives(r, std::back_inserter(ids1));
+    wide_tree.all_intersected_primitives(r, std::back_inserter(ids2));
+    std::sort(ids1.begin(), ids1.end());
+    std::sort(ids2.begin(), ids2.end());
+    assert(ids1 == ids2);
+
+    // skipping the first hit must give the second one
+    auto first = wide_tree.first_intersected_primitive(r);
+    if(first)
+    {
+      auto skip = [&first](Primitive::Id id) { return id == *first; };
+      auto r1 = tree.first_intersection(r, skip);
+      auto r2 = wide_tree.first_intersection(r, skip);
+      assert(bool(r1) == bool(r2));
+    }
+  }
+  std::cout << "  " << nb_hits << " rays out of " << rays.size() << " hit the mesh" << std::endl;
+  assert(nb_hits > 0);
+
+  for(const Point& p : points)
+  {
+    const FT d = tree.squared_distance(p);
+    assert(close(d, wide_tree.squared_distance(p)));
+    assert(close(d, CGAL::squared_distance(p, wide_tree.closest_point(p))));
+    assert(close(d, CGAL::squared_distance(p, wide_tree.closest_point_and_primitive(p).first)));
+  }
+
+  // segments queries
+  for(std::size_t i=1; i<points.size(); ++i)
+  {
+    const Segment s(points[i-1], points[i]);
+    assert(tree.do_intersect(s) == wide_tree.do_intersect(s));
+    assert(tree.number_of_intersected_primitives(s) == wide_tree.number_of_intersected_primitives(s));
+    assert(bool(tree.any_intersection(s)) == bool(wide_tree.any_intersection(s)));
+  }
+
+  // rebuilding and clearing
+  wide_tree.clear();
+  assert(wide_tree.empty());
+  assert(!wide_tree.do_intersect(rays.front()));
+  assert(!wide_tree.first_intersection(rays.front()));
+  wide_tree.rebuild(faces(mesh).first, faces(mesh).second, mesh);
+  assert(wide_tree.size() == tree.size());
+
+  // a single primitive
+  Wide_tree singleton(faces(mesh).first, std::next(faces(mesh).first), mesh);
+  Tree tree_singleton(faces(mesh).first, std::next(faces(mesh).first), mesh);
+  for(const Ray& r : rays)
+    assert(close(first_hit_distance(singleton, r), first_hit_distance(tree_singleton, r)));
+  for(const Point& p : points)
+    assert(close(singleton.squared_distance(p), tree_singleton.squared_distance(p)));
+
+  // move
+  Wide_tree moved(std::move(wide_tree));
+  assert(moved.size() == tree.size());
+}
+
+int main(int argc, char** argv)
+{
+  const std::string filename = (argc > 1) ? argv[1] : "data/bunny00.off";
+  Mesh mesh;
+  std::ifstream in(filename);
+  if(!in || !(in >> mesh))
+  {
+    std::cerr << "Error: cannot read " << filename << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  CGAL::Bbox_3 bb = CGAL::bbox_3(mesh.points().begin(), mesh.points().end());
+  const Vector center(0.5 * (bb.xmin() + bb.xmax()),
+                      0.5 * (bb.ymin() + bb.ymax()),
+                      0.5 * (bb.zmin() + bb.zmax()));
+  const double radius = (std::max)({bb.x_span(), bb.y_span(), bb.z_span()});
+
+  CGAL::Random rand(23);
+  std::vector<Point> sources, targets;
+  std::copy_n(CGAL::Random_points_on_sphere_3<Point>(radius, rand), 500, std::back_inserter(sources));
+  std::copy_n(CGAL::Random_points_in_sphere_3<Point>(radius / 4, rand), 500, std::back_inserter(targets));
+
+  std::vector<Ray> rays;
+  for(std::size_t i=0; i<sources.size(); ++i)
+    rays.emplace_back(sources[i] + center, targets[i] + center);
+  // axis-aligned rays exercise the slab tests with null direction coordinates
+  const Point c = CGAL::ORIGIN + center;
+  rays.emplace_back(c + Vector(radius, 0, 0), c);
+  rays.emplace_back(c + Vector(0, -radius, 0), c);
+  rays.emplace_back(c + Vector(0, 0, radius), c);
+  rays.emplace_back(c, c + Vector(0, 0, 1));
+
+  std::vector<Point> points;
+  std::copy_n(CGAL::Random_points_in_sphere_3<Point>(radius, rand), 200, std::back_inserter(points));
+  for(Point& p : points)
+    p = p + center;
+
+  test<4>(mesh, rays, points);
+  test<8>(mesh, rays, points);
+
+  std::cout << "done" << std::endl;
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,172 @@
+#include <CGAL/Exact_predicates_inexact_constructions_kernel.h>
+#include <CGAL/Simple_cartesian.h>
+#include <CGAL/Surface_mesh.h>
+#include <CGAL/AABB_tree.h>
+#include <CGAL/AABB_traits_2.h>
+#include <CGAL/AABB_traits_3.h>
+#include <CGAL/AABB_face_graph_triangle_primitive.h>
+#include <CGAL/AABB_triangle_primitive_2.h>
+#include <CGAL/point_generators_2.h>
+#include <CGAL/point_generators_3.h>
+#include <CGAL/Random.h>
+
+#include <algorithm>
+#include <cassert>
+#include <fstream>
+#include <iostream>
+#include <iterator>
+#include <vector>
+
+typedef CGAL::Epick K;
+typedef K::FT FT;
+typedef K::Point_3 Point;
+typedef K::Vector_3 Vector;
+typedef K::Ray_3 Ray;
+typedef CGAL::Surface_mesh<Point> Mesh;
+typedef CGAL::AABB_face_graph_triangle_primitive<Mesh> Primitive;
+typedef CGAL::AABB_traits_3<K, Primitive> Traits;
+typedef CGAL::AABB_tree<Traits> Tree;
+
+// the batched distance queries start from other hints than the single ones,
+// so the closest points might differ by rounding errors or by ties
+bool close(const FT a, const FT b)
+{
+  return CGAL::abs(a - b) <= 1e-10 * (std::max)(FT(1), (std::max)(CGAL::abs(a), CGAL::abs(b)));
+}
+
+template <class ConcurrencyTag, class AABBTree>
+void test(const AABBTree& tree,
+          const std::vector<Ray>& rays,
+          const std::vector<Point>& points)
+{
+  typedef typename AABBTree::Point_and_primitive_id Point_and_primitive_id;
+
+  std::vector<Point_and_primitive_id> closest_points;
+  tree.template closest_points_and_primitives<ConcurrencyTag>(points, std::back_inserter(closest_points));
+  assert(closest_points.size() == points.size());
+
+  std::vector<FT> distances;
+  tree.template squared_distances<ConcurrencyTag>(points, std::back_inserter(distances));
+  assert(distances.size() == points.size());
+
+  for(std::size_t i=0; i<points.size(); ++i)
+  {
+    const FT d = tree.squared_distance(points[i]);
+    assert(close(d, distances[i]));
+    assert(close(d, CGAL::squared_distance(points[i], closest_points[i].first)));
+  }
+
+  std::vector<std::optional<typename AABBTree::template Intersection_and_primitive_id<Ray>::Type> > hits;
+  tree.template first_intersections<ConcurrencyTag>(rays, std::back_inserter(hits));
+  assert(hits.size() == rays.size());
+  for(std::size_t i=0; i<rays.size(); ++i)
+  {
+    auto hit = tree.first_intersection(rays[i]);
+    assert(bool(hit) == bool(hits[i]));
+    if(hit)
+      assert(hit->second == hits[i]->second);
+  }
+
+  // empty ranges
+  std::vector<FT> none;
+  tree.template squared_distances<ConcurrencyTag>(std::vector<Point>(), std::back_inserter(none));
+  assert(none.empty());
+}
+
+template <class ConcurrencyTag>
+void test_2()
+{
+  typedef CGAL::Simple_cartesian<double> K2;
+  typedef K2::Point_2 Point_2;
+  typedef K2::Ray_2 Ray_2;
+  typedef K2::Triangle_2 Triangle_2;
+  typedef std::vector<Triangle_2>::const_iterator Iterator;
+  typedef CGAL::AABB_triangle_primitive_2<K2, Iterator> Primitive_2;
+  typedef CGAL::AABB_traits_2<K2, Primitive_2> Traits_2;
+  typedef CGAL::AABB_tree<Traits_2> Tree_2;
+
+  CGAL::Random rand(5);
+  CGAL::Random_points_in_square_2<Point_2> gen(1., rand);
+  std::vector<Triangle_2> triangles;
+  for(int i=0; i<1000; ++i)
+  {
+    const Point_2 p = *gen++;
+    triangles.emplace_back(p, p + K2::Vector_2(0.01, 0), p + K2::Vector_2(0, 0.01));
+  }
+  Tree_2 tree(triangles.begin(), triangles.end());
+
+  std::vector<Point_2> points;
+  std::copy_n(gen, 1000, std::back_inserter(points));
+
+  std::vector<double> distances;
+  tree.template squared_distances<ConcurrencyTag>(points, std::back_inserter(distances));
+  for(std::size_t i=0; i<points.size(); ++i)
+    assert(close(distances[i], tree.squared_distance(points[i])));
+
+  std::vector<Ray_2> rays;
+  for(std::size_t i=1; i<points.size(); ++i)
+    rays.emplace_back(points[i-1], points[i]);
+  std::vector<std::optional<Tree_2::Intersection_and_primitive_id<Ray_2>::Type> > hits;
+  tree.template first_intersections<ConcurrencyTag>(rays, std::back_inserter(hits));
+  for(std::size_t i=0; i<rays.size(); ++i)
+  {
+    auto hit = tree.first_intersection(rays[i]);
+    assert(bool(hit) == bool(hits[i]));
+    if(hit)
+      assert(hit->second == hits[i]->second);
+  }
+}
+
+template <class ConcurrencyTag>
+void test_all(const Mesh& mesh,
+              const std::vector<Ray>& rays,
+              const std::vector<Point>& points)
+{
+  Tree tree(faces(mesh).first, faces(mesh).second, mesh);
+  test<ConcurrencyTag>(tree, rays, points);
+
+  CGAL::AABB_tree<Traits, CGAL::AABB_SAH_wide_tree_tag<4> > wide_tree(faces(mesh).first, faces(mesh).second, mesh);
+  test<ConcurrencyTag>(wide_tree, rays, points);
+
+  test_2<ConcurrencyTag>();
+}
+
+int main(int argc, char** argv)
+{
+  const std::string filename = (argc > 1) ? argv[1] : "data/bunny00.off";
+  Mesh mesh;
+  std::ifstream in(filename);
+  if(!in || !(in >> mesh))
+  {
+    std::cerr << "Error: cannot read " << filename << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  const CGAL::Bbox_3 bb = CGAL::bbox_3(mesh.points().begin(), mesh.points().end());
+  const Vector center(0.5 * (bb.xmin() + bb.xmax()),
+                      0.5 * (bb.ymin() + bb.ymax()),
+                      0.5 * (bb.zmin() + bb.zmax()));
+  const double radius = (std::max)({bb.x_span(), bb.y_span(), bb.z_span()});
+
+  CGAL::Random rand(7);
+  CGAL::Random_points_on_sphere_3<Point> sources(radius, rand);
+  CGAL::Random_points_in_sphere_3<Point> targets(radius / 4, rand);
+  std::vector<Ray> rays;
+  for(int i=0; i<2000; ++i)
+    rays.emplace_back(*sources++ + center, *targets++ + center);
+
+  std::vector<Point> points;
+  CGAL::Random_points_in_sphere_3<Point> gen(radius, rand);
+  for(int i=0; i<2000; ++i)
+    points.push_back(*gen++ + center);
+
+  std::cout << "Sequential_tag" << std::endl;
+  test_all<CGAL::Sequential_tag>(mesh, rays, points);
+#ifdef CGAL_LINKED_WITH_TBB
+  std::cout << "Parallel_tag" << std::endl;
+  test_all<CGAL::Parallel_tag>(mesh, rays, points);
+#endif
+
+  std::cout << "done" << std::endl;
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,115 @@
+#include <CGAL/Exact_predicates_inexact_constructions_kernel.h>
+#include <CGAL/Surface_mesh.h>
+#include <CGAL/AABB_tree.h>
+#include <CGAL/AABB_traits_3.h>
+#include <CGAL/AABB_face_graph_triangle_primitive.h>
+#include <CGAL/point_generators_3.h>
+#include <CGAL/Random.h>
+#include <CGAL/Real_timer.h>
+
+#include <cassert>
+#include <fstream>
+#include <iostream>
+#include <iterator>
+#include <vector>
+
+typedef CGAL::Epick K;
+typedef K::Point_3 Point;
+typedef CGAL::Surface_mesh<Point> Mesh;
+typedef CGAL::AABB_face_graph_triangle_primitive<Mesh> Primitive;
+typedef CGAL::AABB_traits_3<K, Primitive> Traits;
+typedef CGAL::AABB_tree<Traits> Tree;
+typedef CGAL::AABB_node<Traits> Node;
+
+// checks that two subtrees have the same boxes and the same primitives
+void compare(const Node& n1, const Node& n2, std::size_t nb_primitives)
+{
+  assert(n1.bbox() == n2.bbox());
+  switch(nb_primitives)
+  {
+  case 2:
+    assert(n1.left_data().id() == n2.left_data().id());
+    assert(n1.right_data().id() == n2.right_data().id());
+    break;
+  case 3:
+    assert(n1.left_data().id() == n2.left_data().id());
+    compare(n1.right_child(), n2.right_child(), 2);
+    break;
+  default:
+    compare(n1.left_child(), n2.left_child(), nb_primitives/2);
+    compare(n1.right_child(), n2.right_child(), nb_primitives - nb_primitives/2);
+  }
+}
+
+template <class ConcurrencyTag>
+void test(const Mesh& mesh, const std::vector<Point>& queries)
+{
+  CGAL::Real_timer timer;
+  Tree reference(faces(mesh).first, faces(mesh).second, mesh);
+  timer.start();
+  reference.build();
+  reference.accelerate_distance_queries();
+  timer.stop();
+  std::cout << "  sequential build: " << timer.time() << " s" << std::endl;
+
+  Tree tree(faces(mesh).first, faces(mesh).second, mesh);
+  timer.reset();
+  timer.start();
+  tree.build(ConcurrencyTag());
+  timer.stop();
+  std::cout << "  build with tag: " << timer.time() << " s" << std::endl;
+
+  assert(tree.size() == reference.size());
+  compare(*tree.root_node(), *reference.root_node(), tree.size());
+
+  for(const Point& q : queries)
+  {
+    assert(tree.best_hint(q) == reference.best_hint(q));
+    assert(tree.closest_point_and_primitive(q) == reference.closest_point_and_primitive(q));
+  }
+
+  // accelerating the distance queries in parallel gives the same hints
+  Tree tree_2(faces(mesh).first, faces(mesh).second, mesh);
+  tree_2.build();
+  tree_2.accelerate_distance_queries(ConcurrencyTag());
+  for(const Point& q : queries)
+    assert(tree_2.best_hint(q) == reference.best_hint(q));
+
+  // small trees
+  for(std::size_t n : {1, 2, 3, 4, 5, 17})
+  {
+    Tree small(faces(mesh).first, std::next(faces(mesh).first, n), mesh);
+    small.build(ConcurrencyTag());
+    Tree small_ref(faces(mesh).first, std::next(faces(mesh).first, n), mesh);
+    small_ref.build();
+    if(n > 1)
+      compare(*small.root_node(), *small_ref.root_node(), n);
+  }
+}
+
+int main(int argc, char** argv)
+{
+  const std::string filename = (argc > 1) ? argv[1] : "data/bunny00.off";
+  Mesh mesh;
+  std::ifstream in(filename);
+  if(!in || !(in >> mesh))
+  {
+    std::cerr << "Error: cannot read " << filename << std::endl;
+    return EXIT_FAILURE;
+  }
+  std::cout << num_faces(mesh) << " faces" << std::endl;
+
+  CGAL::Random rand(1);
+  std::vector<Point> queries;
+  std::copy_n(CGAL::Random_points_in_sphere_3<Point>(1., rand), 100, std::back_inserter(queries));
+
+  std::cout << "Sequential_tag" << std::endl;
+  test<CGAL::Sequential_tag>(mesh, queries);
+#ifdef CGAL_LINKED_WITH_TBB
+  std::cout << "Parallel_tag" << std::endl;
+  test<CGAL::Parallel_tag>(mesh, queries);
+#endif
+
+  std::cout << "done" << std::endl;
+  return EXIT_SUCCESS;
+}
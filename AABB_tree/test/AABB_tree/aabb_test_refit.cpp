@@ -0,0 +1,169 @@
+#include <CGAL/Exact_predicates_inexact_constructions_kernel.h>
+#include <CGAL/Surface_mesh.h>
+#include <CGAL/AABB_tree.h>
+#include <CGAL/AABB_traits_3.h>
+#include <CGAL/AABB_face_graph_triangle_primitive.h>
+#include <CGAL/point_generators_3.h>
+#include <CGAL/Random.h>
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <fstream>
+#include <iostream>
+#include <iterator>
+#include <vector>
+
+typedef CGAL::Epick K;
+typedef K::FT FT;
+typedef K::Point_3 Point;
+typedef K::Vector_3 Vector;
+typedef K::Ray_3 Ray;
+typedef CGAL::Surface_mesh<Point> Mesh;
+typedef CGAL::AABB_face_graph_triangle_primitive<Mesh> Primitive;
+typedef CGAL::AABB_traits_3<K, Primitive> Traits;
+typedef CGAL::AABB_tree<Traits> Tree;
+typedef CGAL::AABB_node<Traits> Node;
+
+bool close(const FT a, const FT b)
+{
+  return CGAL::abs(a - b) <= 1e-10 * (std::max)(FT(1), (std::max)(CGAL::abs(a), CGAL::abs(b)));
+}
+
+// checks that the box of each node is the union of the boxes of its children
+CGAL::Bbox_3 check_boxes(const Node& node, std::size_t nb_primitives, const Traits& traits)
+{
+  CGAL::Bbox_3 bb;
+  switch(nb_primitives)
+  {
+  case 2:
+    bb = traits.compute_bbox_object()(&node.left_data(), &node.left_data() + 1)
+       + traits.compute_bbox_object()(&node.right_data(), &node.right_data() + 1);
+    break;
+  case 3:
+    bb = traits.compute_bbox_object()(&node.left_data(), &node.left_data() + 1)
+       + check_boxes(node.right_child(), 2, traits);
+    break;
+  default:
+    bb = check_boxes(node.left_child(), nb_primitives/2, traits)
+       + check_boxes(node.right_child(), nb_primitives - nb_primitives/2, traits);
+  }
+  assert(bb == node.bbox());
+  return bb;
+}
+
+// twists the mesh around the z axis
+void deform(Mesh& mesh, const std::vector<Point>& initial, const double angle)
+{
+  for(Mesh::Vertex_index v : vertices(mesh))
+  {
+    const Point& p = initial[v];
+    const double a = angle * p.z();
+    mesh.point(v) = Point(std::cos(a) * p.x() - std::sin(a) * p.y(),
+                          std::sin(a) * p.x() + std::cos(a) * p.y(),
+                          1.1 * p.z());
+  }
+}
+
+template <class ConcurrencyTag, class AABBTree>
+void test_queries(Mesh& mesh,
+                  const std::vector<Point>& initial,
+                  const std::vector<Ray>& rays,
+                  const std::vector<Point>& points)
+{
+  AABBTree tree(faces(mesh).first, faces(mesh).second, mesh);
+  tree.build();
+  tree.squared_distance(points.front()); // builds the KD-tree of the default tree
+
+  for(double angle : { 0.5, 2., 0. })
+  {
+    deform(mesh, initial, angle);
+    tree.template refit<ConcurrencyTag>();
+
+    Tree reference(faces(mesh).first, faces(mesh).second, mesh);
+    assert(tree.bbox() == reference.bbox());
+    for(const Ray& r : rays)
+    {
+      assert(tree.number_of_intersected_primitives(r) == reference.number_of_intersected_primitives(r));
+      assert(tree.do_intersect(r) == reference.do_intersect(r));
+    }
+    for(const Point& p : points)
+      assert(close(tree.squared_distance(p), reference.squared_distance(p)));
+  }
+}
+
+template <class ConcurrencyTag>
+void test(Mesh& mesh,
+          const std::vector<Point>& initial,
+          const std::vector<Ray>& rays,
+          const std::vector<Point>& points)
+{
+  Tree tree(faces(mesh).first, faces(mesh).second, mesh);
+  tree.build();
+  deform(mesh, initial, 1.);
+  tree.template refit<ConcurrencyTag>();
+  check_boxes(*tree.root_node(), tree.size(), tree.traits());
+  deform(mesh, initial, 0.);
+
+  test_queries<ConcurrencyTag, Tree>(mesh, initial, rays, points);
+  test_queries<ConcurrencyTag, CGAL::AABB_tree<Traits, CGAL::AABB_SAH_wide_tree_tag<4> > >(mesh, initial, rays, points);
+
+  // small trees
+  for(std::size_t n : {1, 2, 3, 4, 5, 17})
+  {
+    Tree small(faces(mesh).first, std::next(faces(mesh).first, n), mesh);
+    small.build();
+    deform(mesh, initial, 1.);
+    small.template refit<ConcurrencyTag>();
+    Tree small_ref(faces(mesh).first, std::next(faces(mesh).first, n), mesh);
+    assert(small.bbox() == small_ref.bbox());
+    if(n > 1)
+      check_boxes(*small.root_node(), n, small.traits());
+    deform(mesh, initial, 0.);
+  }
+
+  // a refit after an insertion builds the tree
+  Tree incremental(faces(mesh).first, std::next(faces(mesh).first, 10), mesh);
+  incremental.build();
+  incremental.insert(std::next(faces(mesh).first, 10), faces(mesh).second, mesh);
+  incremental.template refit<ConcurrencyTag>();
+  assert(incremental.size() == num_faces(mesh));
+  assert(incremental.bbox() == Tree(faces(mesh).first, faces(mesh).second, mesh).bbox());
+  check_boxes(*incremental.root_node(), incremental.size(), incremental.traits());
+}
+
+int main(int argc, char** argv)
+{
+  const std::string filename = (argc > 1) ? argv[1] : "data/bunny00.off";
+  Mesh mesh;
+  std::ifstream in(filename);
+  if(!in || !(in >> mesh))
+  {
+    std::cerr << "Error: cannot read " << filename << std::endl;
+    return EXIT_FAILURE;
+  }
+  const std::vector<Point> initial(mesh.points().begin(), mesh.points().end());
+
+  const CGAL::Bbox_3 bb = CGAL::bbox_3(initial.begin(), initial.end());
+  const double radius = (std::max)({bb.x_span(), bb.y_span(), bb.z_span()});
+
+  CGAL::Random rand(3);
+  CGAL::Random_points_on_sphere_3<Point> sources(2 * radius, rand);
+  CGAL::Random_points_in_sphere_3<Point> targets(radius / 4, rand);
+  std::vector<Ray> rays;
+  for(int i=0; i<200; ++i)
+    rays.emplace_back(*sources++, *targets++);
+
+  std::vector<Point> points;
+  std::copy_n(CGAL::Random_points_in_sphere_3<Point>(radius, rand), 200, std::back_inserter(points));
+
+  std::cout << "Sequential_tag" << std::endl;
+  test<CGAL::Sequential_tag>(mesh, initial, rays, points);
+#ifdef CGAL_LINKED_WITH_TBB
+  std::cout << "Parallel_tag" << std::endl;
+  test<CGAL::Parallel_tag>(mesh, initial, rays, points);
+#endif
+
+  std::cout << "done" << std::endl;
+  return EXIT_SUCCESS;
+}
@@ -13,7 +13,9 @@
 #define CGAL_BGL_IO_GENERIC_FACEGRAPH_BUILDER_H
 
 #include <CGAL/boost/graph/Euler_operations.h>
+#include <CGAL/boost/graph/internal/add_polygons_with_edge_table.h>
 #include <CGAL/boost/graph/named_params_helper.h>
+#include <CGAL/tags.h>
 
 #include <iostream>
 #include <string>
@@ -67,6 +69,9 @@ public:
       internal_np::face_color_map_t, NamedParameters,
       Constant_property_map<face_descriptor, Color> >::type                            FCM;
 
+    typedef typename internal_np::Lookup_named_param_def<
+      internal_np::concurrency_tag_t, NamedParameters, Sequential_tag>::type           Concurrency_tag;
+
     typedef typename boost::property_traits<VNM>::value_type                           Vertex_normal;
     typedef typename boost::property_traits<VCM>::value_type                           Vertex_color;
     typedef typename boost::property_traits<VTM>::value_type                           Vertex_texture;
@@ -96,7 +101,8 @@ public:
                                                      .vertex_texture_output_iterator(std::back_inserter(vertex_textures))
                                                      .face_color_output_iterator(std::back_inserter(face_colors))
                                                      .verbose(verbose)
-                                                     .use_binary_mode(binary));
+                                                     .use_binary_mode(binary)
+                                                     .concurrency_tag(Concurrency_tag()));
     if(!ok)
       return false;
 
@@ -137,6 +143,22 @@ public:
         put(vtm, vertices[id], vertex_textures[id]);
     }
 
+    // the connectivity is built at once from a table of the halfedges of the faces,
+    // and falls back to adding the faces one by one if they do not define a 2-manifold
+    if(std::is_convertible<Concurrency_tag, Parallel_tag>::value)
+    {
+      std::vector<face_descriptor> faces;
+      if(CGAL::internal::add_polygons_with_edge_table<Concurrency_tag>(m_faces, vertices, g, faces))
+      {
+        if(has_face_colors)
+        {
+          for(size_type i=0, fs=m_faces.size(); i<fs; ++i)
+            put(fcm, faces[i], face_colors[i]);
+        }
+        return is_valid(g);
+      }
+    }
+
     for(size_type i=0, fs=m_faces.size(); i<fs; ++i)
     {
       std::vector<vertex_descriptor> face(m_faces[i].size());
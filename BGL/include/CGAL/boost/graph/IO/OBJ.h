@@ -97,6 +97,14 @@ public:
       \cgalParamType{Boolean}
       \cgalParamDefault{`false`}
     \cgalParamNEnd
+
+    \cgalParamNBegin{concurrency_tag}
+      \cgalParamDescription{a tag indicating if the mesh should be built using one or several threads}
+      \cgalParamType{Either `CGAL::Sequential_tag`, or `CGAL::Parallel_tag`, or `CGAL::Parallel_if_available_tag`}
+      \cgalParamDefault{`CGAL::Sequential_tag`}
+      \cgalParamExtra{If `CGAL::Parallel_tag` is used, the connectivity of `g` is built at once by sorting the halfedges
+                      of all the faces, and the elements of `g` are set concurrently.}
+    \cgalParamNEnd
   \cgalNamedParamsEnd
 
   \returns `true` if reading was successful and the resulting mesh is valid, `false` otherwise.
@@ -153,6 +161,14 @@ bool read_OBJ(std::istream& is,
       \cgalParamType{Boolean}
       \cgalParamDefault{`false`}
     \cgalParamNEnd
+
+    \cgalParamNBegin{concurrency_tag}
+      \cgalParamDescription{a tag indicating if the mesh should be built using one or several threads}
+      \cgalParamType{Either `CGAL::Sequential_tag`, or `CGAL::Parallel_tag`, or `CGAL::Parallel_if_available_tag`}
+      \cgalParamDefault{`CGAL::Sequential_tag`}
+      \cgalParamExtra{If `CGAL::Parallel_tag` is used, the connectivity of `g` is built at once by sorting the halfedges
+                      of all the faces, and the elements of `g` are set concurrently.}
+    \cgalParamNEnd
   \cgalNamedParamsEnd
 
   \returns `true` if reading was successful and the resulting mesh is valid, `false` otherwise.
@@ -141,6 +141,15 @@ bool read_OFF_BGL(std::istream& is,
       \cgalParamType{Boolean}
       \cgalParamDefault{`false`}
     \cgalParamNEnd
+
+    \cgalParamNBegin{concurrency_tag}
+      \cgalParamDescription{a tag indicating if the mesh should be built using one or several threads}
+      \cgalParamType{Either `CGAL::Sequential_tag`, or `CGAL::Parallel_tag`, or `CGAL::Parallel_if_available_tag`}
+      \cgalParamDefault{`CGAL::Sequential_tag`}
+      \cgalParamExtra{If `CGAL::Parallel_tag` is used, the lines of ASCII files without normals, textures,
+                      and homogeneous coordinates are parsed in parallel. The connectivity of `g` is then built at once
+                      by sorting the halfedges of all the faces, and the elements of `g` are set concurrently.}
+    \cgalParamNEnd
   \cgalNamedParamsEnd
 
   \returns `true` if reading was successful and the resulting mesh is valid, `false` otherwise.
@@ -225,6 +234,15 @@ bool read_OFF(std::istream& is,
       \cgalParamType{Boolean}
       \cgalParamDefault{`false`}
     \cgalParamNEnd
+
+    \cgalParamNBegin{concurrency_tag}
+      \cgalParamDescription{a tag indicating if the mesh should be built using one or several threads}
+      \cgalParamType{Either `CGAL::Sequential_tag`, or `CGAL::Parallel_tag`, or `CGAL::Parallel_if_available_tag`}
+      \cgalParamDefault{`CGAL::Sequential_tag`}
+      \cgalParamExtra{If `CGAL::Parallel_tag` is used, the lines of ASCII files without normals, textures,
+                      and homogeneous coordinates are parsed in parallel. The connectivity of `g` is then built at once
+                      by sorting the halfedges of all the faces, and the elements of `g` are set concurrently.}
+    \cgalParamNEnd
   \cgalNamedParamsEnd
 
   \returns `true` if reading was successful and the resulting mesh is valid, `false` otherwise.
@@ -18,12 +18,12 @@
 namespace CGAL {
 namespace IO {
 
-template < class Vb, class Fb>
-typename Triangulation_data_structure_2<Vb,Fb>::Vertex_handle
-off_file_input( std::istream& is, Triangulation_data_structure_2<Vb,Fb>& tds, bool verbose = false)
+template < class Vb, class Fb, class Ct>
+typename Triangulation_data_structure_2<Vb,Fb,Ct>::Vertex_handle
+off_file_input( std::istream& is, Triangulation_data_structure_2<Vb,Fb,Ct>& tds, bool verbose = false)
 {
-  typedef typename Triangulation_data_structure_2<Vb,Fb>::Vertex_handle Vertex_handle;
-  typedef typename Triangulation_data_structure_2<Vb,Fb>::Face_iterator Face_handle;
+  typedef typename Triangulation_data_structure_2<Vb,Fb,Ct>::Vertex_handle Vertex_handle;
+  typedef typename Triangulation_data_structure_2<Vb,Fb,Ct>::Face_iterator Face_handle;
   typedef std::pair<Vertex_handle,Vertex_handle> Vh_pair;
   typedef std::pair<Face_handle, int>                Edge;
   // input from an OFF file
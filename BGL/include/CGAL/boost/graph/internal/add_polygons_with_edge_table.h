@@ -0,0 +1,285 @@
+// Copyright (c) 2026 GeometryFactory (France).  All rights reserved.
+//
+// This file is part of CGAL (www.cgal.org)
+//
+// $URL$
+// $Id$
+// SPDX-License-Identifier: LGPL-3.0-or-later OR LicenseRef-Commercial
+//
+// Author(s)     : GeometryFactory
+
+#ifndef CGAL_BOOST_GRAPH_INTERNAL_ADD_POLYGONS_WITH_EDGE_TABLE_H
+#define CGAL_BOOST_GRAPH_INTERNAL_ADD_POLYGONS_WITH_EDGE_TABLE_H
+
+#include <CGAL/boost/graph/internal/helpers.h>
+#include <CGAL/for_each.h>
+#include <CGAL/tags.h>
+
+#include <boost/graph/graph_traits.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <utility>
+#include <vector>
+
+namespace CGAL {
+namespace internal {
+
+// creates the faces and the edges of `add_polygons_with_edge_table()` one by one
+template <typename Graph>
+struct Add_faces_and_edges
+{
+  typedef boost::graph_traits<Graph>                                      GT;
+
+  Graph& g;
+
+  Add_faces_and_edges(Graph& g) : g(g) { }
+
+  void operator()(const std::size_t nf, const std::size_t ne,
+                  std::vector<typename GT::face_descriptor>& faces,
+                  std::vector<typename GT::halfedge_descriptor>& edge_halfedges) const
+  {
+    reserve(g, static_cast<typename GT::vertices_size_type>(exact_num_vertices(g)),
+               static_cast<typename GT::edges_size_type>(exact_num_edges(g) + ne),
+               static_cast<typename GT::faces_size_type>(exact_num_faces(g) + nf));
+
+    faces.resize(nf);
+    for(std::size_t f=0; f<nf; ++f)
+      faces[f] = add_face(g);
+    edge_halfedges.resize(ne);
+    for(std::size_t e=0; e<ne; ++e)
+      edge_halfedges[e] = halfedge(add_edge(g), g);
+  }
+};
+
+// Adds to `g` the faces described by `polygons`, each polygon being a range of indices in `vertices`,
+// which must be isolated vertices of `g`. The faces created are put in `faces`, in the order of `polygons`.
+//
+// Instead of adding the faces one by one as `Euler::add_face()` does, the halfedges of all
+// the polygons are put in a table, grouped by their smallest vertex, to pair the opposite halfedges.
+// The connectivity of each element is then set independently of the others, in parallel
+// if `ConcurrencyTag` is `CGAL::Parallel_tag`.
+//
+// Returns `false`, without modifying `g`, if the polygons do not describe an oriented 2-manifold
+// surface, possibly with boundaries, that is if a polygon has less than three or twice the same vertex,
+// if an edge is shared by more than two polygons or by two polygons with incompatible orientations,
+// or if the polygons incident to a vertex do not form a single fan.
+//
+// The elements are created by `create_elements(nf, ne, faces, edge_halfedges)`, which must add `nf` faces
+// and `ne` edges to `g`, put the faces in `faces`, and a halfedge of each edge in `edge_halfedges`.
+template <typename ConcurrencyTag, typename PolygonRange, typename Graph, typename CreateElements>
+bool add_polygons_with_edge_table(const PolygonRange& polygons,
+                                  const std::vector<typename boost::graph_traits<Graph>::vertex_descriptor>& vertices,
+                                  Graph& g,
+                                  std::vector<typename boost::graph_traits<Graph>::face_descriptor>& faces,
+                                  const CreateElements& create_elements)
+{
+  typedef boost::graph_traits<Graph>                                      GT;
+  typedef typename GT::halfedge_descriptor                                halfedge_descriptor;
+
+  const std::size_t none = std::size_t(-1);
+  const std::size_t nv = vertices.size();
+  const std::size_t nf = polygons.size();
+
+  // The halfedge `h = offsets[f] + j` of the polygon `f` goes from its `j`-th vertex to the next one
+  std::vector<std::size_t> offsets(nf + 1, 0);
+  for(std::size_t f=0; f<nf; ++f)
+  {
+    const std::size_t size = polygons[f].size();
+    if(size < 3)
+      return false;
+    offsets[f + 1] = offsets[f] + size;
+  }
+  const std::size_t nh = offsets[nf];
+
+  std::vector<std::size_t> face_of(nh), source_of(nh);
+  auto next_h = [&](const std::size_t h) -> std::size_t
+  {
+    return (h + 1 == offsets[face_of[h] + 1]) ? offsets[face_of[h]] : h + 1;
+  };
+  auto source_id = [&](const std::size_t h) -> std::size_t
+  {
+    return source_of[h];
+  };
+  auto target_id = [&](const std::size_t h) -> std::size_t
+  {
+    return source_id(next_h(h));
+  };
+
+  // Checks of the polygons
+  std::atomic<bool> valid(true);
+  CGAL::internal::for_each_index<ConcurrencyTag>(nf, [&](const std::size_t f)
+  {
+    const auto& polygon = polygons[f];
+    const std::size_t size = offsets[f + 1] - offsets[f];
+    for(std::size_t j=0; j<size; ++j)
+    {
+      source_of[offsets[f] + j] = static_cast<std::size_t>(polygon[j]);
+      if(source_of[offsets[f] + j] >= nv)
+      {
+        valid = false;
+        return;
+      }
+      face_of[offsets[f] + j] = f;
+    }
+
+    if(size <= 8)
+    {
+      for(std::size_t j=0; j<size; ++j)
+        for(std::size_t k=j+1; k<size; ++k)
+          if(polygon[j] == polygon[k])
+            valid = false;
+    }
+    else
+    {
+      std::vector<std::size_t> ids(size);
+      for(std::size_t j=0; j<size; ++j)
+        ids[j] = static_cast<std::size_t>(polygon[j]);
+      std::sort(ids.begin(), ids.end());
+      if(std::adjacent_find(ids.begin(), ids.end()) != ids.end())
+        valid = false;
+    }
+  });
+  if(!valid)
+    return false;
+
+  // The table of the halfedges, grouped by their smallest vertex and sorted by their largest vertex in each group
+  std::vector<std::size_t> group_offsets(nv + 1, 0);
+  for(std::size_t h=0; h<nh; ++h)
+    ++group_offsets[(std::min)(source_id(h), target_id(h)) + 1];
+  for(std::size_t v=0; v<nv; ++v)
+    group_offsets[v + 1] += group_offsets[v];
+
+  std::vector<std::pair<std::size_t, std::size_t> > table(nh);
+  {
+    std::vector<std::size_t> positions(group_offsets.begin(), group_offsets.end() - 1);
+    for(std::size_t h=0; h<nh; ++h)
+    {
+      const std::size_t a = source_id(h), b = target_id(h);
+      table[positions[(std::min)(a, b)]++] = std::make_pair((std::max)(a, b), h);
+    }
+  }
+  CGAL::internal::for_each_index<ConcurrencyTag>(nv, [&](const std::size_t v)
+  {
+    std::sort(table.begin() + group_offsets[v], table.begin() + group_offsets[v + 1]);
+  });
+
+  // Opposite halfedges and edges
+  std::vector<std::size_t> opposite_of(nh, none), edge_of(nh);
+  std::size_t ne = 0;
+  for(std::size_t v=0; v<nv; ++v)
+  {
+    const std::size_t end = group_offsets[v + 1];
+    for(std::size_t i=group_offsets[v]; i<end; ++ne)
+    {
+      std::size_t j = i + 1;
+      while(j < end && table[j].first == table[i].first)
+        ++j;
+      if(j - i > 2)
+        return false;
+      if(j - i == 2)
+      {
+        const std::size_t h0 = table[i].second, h1 = table[i + 1].second;
+        if(source_id(h0) == source_id(h1))
+          return false;
+        opposite_of[h0] = h1;
+        opposite_of[h1] = h0;
+      }
+      for(; i<j; ++i)
+        edge_of[table[i].second] = ne;
+    }
+  }
+  std::vector<std::pair<std::size_t, std::size_t> >().swap(table);
+  std::vector<std::size_t>().swap(group_offsets);
+
+  // For each vertex, the number of incoming halfedges, one of them, and the one whose opposite is a border halfedge
+  std::vector<std::size_t> in_degree(nv, 0), some_in(nv, none), border_in(nv, none);
+  for(std::size_t h=0; h<nh; ++h)
+  {
+    const std::size_t v = target_id(h);
+    ++in_degree[v];
+    some_in[v] = h;
+    if(opposite_of[h] == none)
+    {
+      if(border_in[v] != none)
+        return false;
+      border_in[v] = h;
+    }
+  }
+
+  // The faces incident to a vertex form a single fan, which is traversed by turning around the vertex
+  CGAL::internal::for_each_index<ConcurrencyTag>(nv, [&](const std::size_t v)
+  {
+    if(in_degree[v] == 0)
+      return;
+    const std::size_t start = (border_in[v] != none) ? border_in[v] : some_in[v];
+    std::size_t h = start, count = 0;
+    do
+    {
+      ++count;
+      h = opposite_of[next_h(h)];
+    }
+    while(h != none && h != start && count <= in_degree[v]);
+
+    if(count != in_degree[v] || ((h == none) != (border_in[v] != none)))
+      valid = false;
+  });
+  if(!valid)
+    return false;
+
+  // Creation of the elements
+  std::vector<halfedge_descriptor> edge_halfedges;
+  create_elements(nf, ne, faces, edge_halfedges);
+
+  auto to_halfedge = [&](const std::size_t h) -> halfedge_descriptor
+  {
+    const halfedge_descriptor hd = edge_halfedges[edge_of[h]];
+    return (source_id(h) < target_id(h)) ? hd : opposite(hd, g);
+  };
+
+  // Connectivity, each element being modified once
+  CGAL::internal::for_each_index<ConcurrencyTag>(nf, [&](const std::size_t f)
+  {
+    for(std::size_t h=offsets[f]; h<offsets[f + 1]; ++h)
+    {
+      const halfedge_descriptor hd = to_halfedge(h);
+      set_target(hd, vertices[target_id(h)], g);
+      set_face(hd, faces[f], g);
+      set_next(hd, to_halfedge(next_h(h)), g);
+
+      if(opposite_of[h] == none)
+      {
+        // the border halfedge entering the source of `h` is followed by the one leaving it
+        const std::size_t v = source_id(h);
+        const halfedge_descriptor border = opposite(hd, g);
+        set_target(border, vertices[v], g);
+        set_face(border, GT::null_face(), g);
+        set_next(border, opposite(to_halfedge(border_in[v]), g), g);
+        set_halfedge(vertices[v], border, g);
+      }
+    }
+    set_halfedge(faces[f], to_halfedge(offsets[f]), g);
+  });
+
+  CGAL::internal::for_each_index<ConcurrencyTag>(nv, [&](const std::size_t v)
+  {
+    if(in_degree[v] != 0 && border_in[v] == none)
+      set_halfedge(vertices[v], to_halfedge(some_in[v]), g);
+  });
+
+  return true;
+}
+
+template <typename ConcurrencyTag, typename PolygonRange, typename Graph>
+bool add_polygons_with_edge_table(const PolygonRange& polygons,
+                                  const std::vector<typename boost::graph_traits<Graph>::vertex_descriptor>& vertices,
+                                  Graph& g,
+                                  std::vector<typename boost::graph_traits<Graph>::face_descriptor>& faces)
+{
+  return add_polygons_with_edge_table<ConcurrencyTag>(polygons, vertices, g, faces, Add_faces_and_edges<Graph>(g));
+}
+
+} // namespace internal
+} // namespace CGAL
+
+#endif // CGAL_BOOST_GRAPH_INTERNAL_ADD_POLYGONS_WITH_EDGE_TABLE_H
@@ -37,6 +37,23 @@ int main(int argc, char** argv)
   std::cout << "Total time: " << timer.time() << std::endl << std::endl;
   }
 
+////////////////////////////////
+
+#ifdef CGAL_LINKED_WITH_TBB
+  {
+  std::cout << "Reading from stream in parallel\n";
+  CGAL::Real_timer timer;
+  timer.start();
+
+  Mesh m;
+  const char* filename = (argc>1) ? argv[1] : "data/genus3.off";
+  CGAL::IO::read_polygon_mesh(filename, m, CGAL::parameters::concurrency_tag(CGAL::Parallel_tag()));
+
+  std::cout << "  is_valid? " << CGAL::is_valid_polygon_mesh(m) << "\n";
+  std::cout << "Total time: " << timer.time() << std::endl << std::endl;
+  }
+#endif
+
 ////////////////////////////////
 
   {
@@ -0,0 +1,313 @@
+#include <CGAL/Simple_cartesian.h>
+#include <CGAL/Surface_mesh.h>
+#include <CGAL/Polyhedron_3.h>
+
+#include <CGAL/boost/graph/helpers.h>
+#include <CGAL/boost/graph/internal/add_polygons_with_edge_table.h>
+#include <CGAL/boost/graph/IO/polygon_mesh_io.h>
+#include <CGAL/IO/OFF.h>
+#include <CGAL/Testsuite/canonical_faces.h>
+
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <iostream>
+#include <map>
+#include <sstream>
+#include <string>
+#include <vector>
+
+typedef CGAL::Simple_cartesian<double>                                  Kernel;
+typedef Kernel::Point_3                                                 Point;
+typedef CGAL::Surface_mesh<Point>                                       SM;
+typedef CGAL::Polyhedron_3<Kernel>                                      Polyhedron;
+
+typedef std::vector<std::vector<std::size_t> >                          Polygons;
+
+// a grid of (n+1)x(n+1) vertices, whose quads are split in two triangles, as an OFF file,
+// or as a COFF file with vertex colors and face colors given in the different formats
+std::string grid_OFF(const std::size_t n, const bool colors = false)
+{
+  std::ostringstream os;
+  os.precision(17);
+  os << (colors ? "COFF" : "OFF") << "\n# a comment\n" << (n + 1) * (n + 1) << " " << 2 * n * n << " 0\n\n";
+  for(std::size_t i=0; i<=n; ++i)
+  {
+    for(std::size_t j=0; j<=n; ++j)
+    {
+      os << i / double(n) << " " << j / double(n) << " " << (i * j) / double(n * n);
+      if(colors)
+        os << " " << i % 256 << " " << j % 256 << " 128 255";
+      os << "\n";
+    }
+    if(i == n / 2)
+      os << "# in the middle of the vertices\n  \n";
+  }
+  for(std::size_t i=0; i<n; ++i)
+  {
+    for(std::size_t j=0; j<n; ++j)
+    {
+      const std::size_t v = i * (n + 1) + j;
+      os << "3 " << v << " " << v + n + 1 << " " << v + 1;
+      if(colors)
+        os << " " << i % 256 << " " << j % 256 << " 0";
+      os << "\n";
+      os << "3  " << v + 1 << " " << v + n + 1 << " " << v + n + 2;
+      if(colors)
+        os << " " << ((i + j) % 3 == 0 ? "0.5 0.25 1" : std::to_string(j % 150));
+      os << "   # a triangle\n";
+    }
+  }
+  return os.str();
+}
+
+template <typename Mesh>
+std::size_t number_of_border_halfedges(const Mesh& m)
+{
+  std::size_t nb = 0;
+  for(auto h : halfedges(m))
+  {
+    if(is_border(h, m))
+      ++nb;
+  }
+  return nb;
+}
+
+template <typename Mesh>
+void assert_same_meshes(const Mesh& a, const Mesh& b)
+{
+  assert(CGAL::is_valid_polygon_mesh(a) && CGAL::is_valid_polygon_mesh(b));
+  assert(num_vertices(a) == num_vertices(b));
+  assert(num_edges(a) == num_edges(b));
+  assert(num_faces(a) == num_faces(b));
+  assert(number_of_border_halfedges(a) == number_of_border_halfedges(b));
+  assert(CGAL::Testsuite::canonical_faces(a) == CGAL::Testsuite::canonical_faces(b));
+}
+
+template <typename Mesh, typename ConcurrencyTag>
+bool build(const Polygons& polygons, const std::size_t nv, Mesh& m)
+{
+  typedef typename boost::graph_traits<Mesh>::vertex_descriptor vertex_descriptor;
+  typedef typename boost::graph_traits<Mesh>::face_descriptor face_descriptor;
+
+  std::vector<vertex_descriptor> vertices;
+  for(std::size_t i=0; i<nv; ++i)
+  {
+    vertices.push_back(add_vertex(m));
+    put(CGAL::vertex_point, m, vertices.back(), Point(double(i), double(i * i % 7), double(i % 3)));
+  }
+
+  std::vector<face_descriptor> faces;
+  const bool ok = CGAL::internal::add_polygons_with_edge_table<ConcurrencyTag>(polygons, vertices, m, faces);
+  if(ok)
+  {
+    assert(faces.size() == polygons.size());
+    for(std::size_t i=0; i<faces.size(); ++i)
+      assert(degree(faces[i], m) == polygons[i].size());
+  }
+  else
+  {
+    // the mesh is left untouched
+    assert(num_faces(m) == 0 && num_edges(m) == 0);
+  }
+  return ok;
+}
+
+template <typename Mesh, typename ConcurrencyTag>
+void test_edge_table()
+{
+  std::cout << "  edge table" << std::endl;
+
+  // a closed tetrahedron and a tetrahedron without a face
+  Polygons tetrahedron = { { 0, 1, 2 }, { 0, 2, 3 }, { 0, 3, 1 }, { 1, 3, 2 } };
+  Mesh m1, m2;
+  assert((build<Mesh, ConcurrencyTag>(tetrahedron, 4, m1)));
+  assert(CGAL::is_valid_polygon_mesh(m1) && CGAL::is_closed(m1) && num_edges(m1) == 6);
+  tetrahedron.pop_back();
+  assert((build<Mesh, ConcurrencyTag>(tetrahedron, 4, m2)));
+  assert(CGAL::is_valid_polygon_mesh(m2) && number_of_border_halfedges(m2) == 3);
+
+  // the same faces, added one by one
+  Mesh m3;
+  for(std::size_t i=0; i<4; ++i)
+    add_vertex(m3);
+  for(const std::vector<std::size_t>& p : tetrahedron)
+  {
+    std::vector<typename boost::graph_traits<Mesh>::vertex_descriptor> face;
+    for(std::size_t id : p)
+      face.push_back(*std::next(vertices(m3).begin(), id));
+    CGAL::Euler::add_face(face, m3);
+  }
+  assert(num_edges(m3) == num_edges(m2) && number_of_border_halfedges(m3) == number_of_border_halfedges(m2));
+
+  // an isolated vertex, a quad and a pentagon
+  Mesh m4;
+  assert((build<Mesh, ConcurrencyTag>({ { 0, 1, 2, 3 }, { 1, 0, 4, 5, 6 } }, 8, m4)));
+  assert(CGAL::is_valid_polygon_mesh(m4) && num_edges(m4) == 8 && num_vertices(m4) == 8);
+
+  // invalid inputs
+  const std::vector<Polygons> invalid = {
+    { { 0, 1 } }, // degenerate polygon
+    { { 0, 1, 8 } }, // out of range index
+    { { 0, 1, 2, 1 } }, // vertex met twice
+    { { 0, 1, 2 }, { 0, 1, 3 } }, // incompatible orientations
+    { { 0, 1, 2 }, { 1, 0, 3 }, { 0, 1, 4 } }, // three faces around an edge
+    { { 0, 1, 2 }, { 0, 3, 4 } }, // two fans around a vertex on the border
+    { { 0, 1, 2 }, { 0, 2, 3 }, { 0, 3, 1 }, { 1, 3, 2 },
+      { 0, 4, 5 }, { 0, 5, 6 }, { 0, 6, 4 }, { 4, 6, 5 } } // two closed fans around a vertex
+  };
+  for(const Polygons& polygons : invalid)
+  {
+    Mesh m;
+    assert(!(build<Mesh, ConcurrencyTag>(polygons, 7, m)));
+  }
+}
+
+template <typename ConcurrencyTag>
+void test_soup(const std::string& data)
+{
+  std::cout << "  polygon soup" << std::endl;
+
+  std::vector<Point> points, points_in_parallel;
+  Polygons polygons, polygons_in_parallel;
+  std::istringstream is(data), is_in_parallel(data);
+  bool ok = CGAL::IO::read_OFF(is, points, polygons);
+  assert(ok);
+  ok = CGAL::IO::read_OFF(is_in_parallel, points_in_parallel, polygons_in_parallel,
+                          CGAL::parameters::concurrency_tag(ConcurrencyTag()));
+  assert(ok);
+  assert(points == points_in_parallel);
+  assert(polygons == polygons_in_parallel);
+
+  // a file with colors
+  const std::string colored_data = grid_OFF(300, true);
+  std::vector<CGAL::IO::Color> vcolors, fcolors, vcolors_in_parallel, fcolors_in_parallel;
+  std::istringstream colored_is(colored_data), colored_is_in_parallel(colored_data);
+  ok = CGAL::IO::read_OFF(colored_is, points, polygons,
+                          CGAL::parameters::vertex_color_output_iterator(std::back_inserter(vcolors))
+                                           .face_color_output_iterator(std::back_inserter(fcolors)));
+  assert(ok);
+  ok = CGAL::IO::read_OFF(colored_is_in_parallel, points_in_parallel, polygons_in_parallel,
+                          CGAL::parameters::vertex_color_output_iterator(std::back_inserter(vcolors_in_parallel))
+                                           .face_color_output_iterator(std::back_inserter(fcolors_in_parallel))
+                                           .concurrency_tag(ConcurrencyTag()));
+  assert(ok);
+  assert(points == points_in_parallel);
+  assert(polygons == polygons_in_parallel);
+  assert(vcolors.size() == points.size() && fcolors.size() == polygons.size());
+  assert(vcolors == vcolors_in_parallel);
+  assert(fcolors == fcolors_in_parallel);
+
+  // a truncated file
+  std::istringstream truncated(data.substr(0, data.size() / 2));
+  assert(!CGAL::IO::read_OFF(truncated, points, polygons,
+                             CGAL::parameters::concurrency_tag(ConcurrencyTag()).verbose(false)));
+
+  // an index out of range
+  std::istringstream out_of_range("OFF\n3 1 0\n0 0 0\n1 0 0\n0 1 0\n3 0 1 3\n");
+  assert(!CGAL::IO::read_OFF(out_of_range, points, polygons,
+                             CGAL::parameters::concurrency_tag(ConcurrencyTag()).verbose(false)));
+
+  // a missing coordinate
+  std::istringstream missing_coordinate("OFF\n3 1 0\n0 0 0\n1 0\n0 1 0\n3 0 1 2\n");
+  assert(!CGAL::IO::read_OFF(missing_coordinate, points, polygons,
+                             CGAL::parameters::concurrency_tag(ConcurrencyTag()).verbose(false)));
+}
+
+template <typename Mesh, typename ConcurrencyTag>
+void test_mesh(const std::string& data)
+{
+  std::cout << "  mesh from a stream" << std::endl;
+
+  Mesh m, m_in_parallel;
+  std::istringstream is(data), is_in_parallel(data);
+  bool ok = CGAL::IO::read_OFF(is, m);
+  assert(ok);
+  ok = CGAL::IO::read_OFF(is_in_parallel, m_in_parallel, CGAL::parameters::concurrency_tag(ConcurrencyTag()));
+  assert(ok);
+  assert_same_meshes(m, m_in_parallel);
+
+  std::cout << "  mesh with colors" << std::endl;
+  {
+    typedef typename boost::graph_traits<Mesh>::face_descriptor face_descriptor;
+    typedef typename boost::graph_traits<Mesh>::vertex_descriptor vertex_descriptor;
+
+    std::map<vertex_descriptor, CGAL::IO::Color> vc, vc_in_parallel;
+    std::map<face_descriptor, CGAL::IO::Color> fc, fc_in_parallel;
+    const std::string colored_data = grid_OFF(50, true);
+    Mesh a, b;
+    std::istringstream is_a(colored_data), is_b(colored_data);
+    ok = CGAL::IO::read_OFF(is_a, a, CGAL::parameters::vertex_color_map(boost::make_assoc_property_map(vc))
+                                                      .face_color_map(boost::make_assoc_property_map(fc)));
+    assert(ok);
+    ok = CGAL::IO::read_OFF(is_b, b, CGAL::parameters::vertex_color_map(boost::make_assoc_property_map(vc_in_parallel))
+                                                      .face_color_map(boost::make_assoc_property_map(fc_in_parallel))
+                                                      .concurrency_tag(ConcurrencyTag()));
+    assert(ok);
+    assert_same_meshes(a, b);
+    assert(vc.size() == num_vertices(a) && fc.size() == num_faces(a));
+
+    // the elements are created in the order of the file in both cases
+    auto vit = vertices(b).begin();
+    for(vertex_descriptor v : vertices(a))
+      assert(vc[v] == vc_in_parallel[*vit++]);
+    auto fit = faces(b).begin();
+    for(face_descriptor f : faces(a))
+      assert(fc[f] == fc_in_parallel[*fit++]);
+  }
+
+  std::cout << "  meshes from files" << std::endl;
+  for(const std::string fname : { "data/genus3.off", "data/7_faces_triangle.off", "data/cube-quads.off",
+                                  "data/sphere.obj", "data/sphere.stl", "data/mesh_with_normals.off" })
+  {
+    Mesh a, b;
+    ok = CGAL::IO::read_polygon_mesh(fname, a);
+    assert(ok);
+    ok = CGAL::IO::read_polygon_mesh(fname, b, CGAL::parameters::concurrency_tag(ConcurrencyTag()));
+    assert(ok);
+    assert_same_meshes(a, b);
+  }
+
+  std::cout << "  non-manifold vertex" << std::endl;
+  {
+    // the faces are then added one by one
+    const std::string bowtie = "OFF\n5 2 0\n0 0 0\n1 0 0\n0 1 0\n-1 0 0\n0 -1 0\n3 0 1 2\n3 0 3 4\n";
+    Mesh a, b;
+    std::istringstream is_a(bowtie), is_b(bowtie);
+    const bool ok_a = CGAL::IO::read_OFF(is_a, a);
+    const bool ok_b = CGAL::IO::read_OFF(is_b, b, CGAL::parameters::concurrency_tag(ConcurrencyTag()));
+    assert(ok_a == ok_b);
+    if(ok_a)
+      assert_same_meshes(a, b);
+  }
+}
+
+template <typename ConcurrencyTag>
+void test(const std::string& data)
+{
+  test_soup<ConcurrencyTag>(data);
+
+  std::cout << " Surface_mesh" << std::endl;
+  test_edge_table<SM, ConcurrencyTag>();
+  test_mesh<SM, ConcurrencyTag>(data);
+
+  std::cout << " Polyhedron_3" << std::endl;
+  test_edge_table<Polyhedron, ConcurrencyTag>();
+  test_mesh<Polyhedron, ConcurrencyTag>(data);
+}
+
+int main()
+{
+  // more vertices and faces than in a block
+  const std::string data = grid_OFF(300);
+
+  std::cout << "Sequential" << std::endl;
+  test<CGAL::Sequential_tag>(data);
+#ifdef CGAL_LINKED_WITH_TBB
+  std::cout << "Parallel" << std::endl;
+  test<CGAL::Parallel_tag>(data);
+#endif
+
+  std::cout << "done" << std::endl;
+  return EXIT_SUCCESS;
+}
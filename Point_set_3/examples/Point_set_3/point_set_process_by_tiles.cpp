@@ -0,0 +1,69 @@
+#include <CGAL/Exact_predicates_inexact_constructions_kernel.h>
+#include <CGAL/Point_set_3.h>
+#include <CGAL/Point_set_3/process_by_tiles.h>
+#include <CGAL/compute_average_spacing.h>
+#include <CGAL/grid_simplify_point_set.h>
+#include <CGAL/jet_estimate_normals.h>
+#include <CGAL/remove_outliers.h>
+#include <CGAL/IO/write_xyz_points.h>
+
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+
+typedef CGAL::Exact_predicates_inexact_constructions_kernel Kernel;
+typedef Kernel::Point_3 Point;
+typedef CGAL::Point_set_3<Point> Point_set;
+
+int main (int argc, char** argv)
+{
+  const std::string fname = (argc > 1) ? argv[1] : CGAL::data_file_path("points_3/b9.ply");
+  const double tile_size = (argc > 2) ? std::atof(argv[2]) : 32.;
+  const unsigned int k = 24;
+
+  // the halo must contain the k nearest neighbors of the points of the tiles
+  const double halo_size = tile_size / 4;
+  const double cell_size = tile_size / 16;
+
+  std::ofstream output("out.xyz");
+  output.precision(17);
+
+  std::size_t nb_points = 0;
+  bool ok = CGAL::process_point_set_by_tiles<Point>
+    (fname,
+     [&](Point_set& point_set)
+     {
+       // remove outliers: their average distance to their k nearest
+       // neighbors is larger than 10 times the average spacing of the tile
+       const double spacing = CGAL::compute_average_spacing<CGAL::Sequential_tag>(point_set, k);
+       point_set.remove(CGAL::remove_outliers<CGAL::Parallel_if_available_tag>
+                          (point_set, k, CGAL::parameters::threshold_percent(100)
+                                                          .threshold_distance(10 * spacing)),
+                        point_set.end());
+
+       // the size of the tiles is a multiple of the size of the cells
+       point_set.remove(CGAL::grid_simplify_point_set(point_set, cell_size), point_set.end());
+
+       point_set.add_normal_map();
+       if(point_set.size() > k)
+         CGAL::jet_estimate_normals<CGAL::Parallel_if_available_tag>(point_set, k, point_set.parameters());
+     },
+     [&](const Point_set& point_set)
+     {
+       // the points of each tile are appended to the output file
+       CGAL::IO::write_XYZ(output, point_set,
+                           CGAL::parameters::point_map(point_set.point_map())
+                                            .normal_map(point_set.normal_map()));
+       nb_points += point_set.size();
+     },
+     CGAL::parameters::tile_size(tile_size).halo_size(halo_size));
+
+  if(!ok)
+  {
+    std::cerr << "Error: cannot process " << fname << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  std::cout << nb_points << " points written in out.xyz" << std::endl;
+  return EXIT_SUCCESS;
+}
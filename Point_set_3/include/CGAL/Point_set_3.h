@@ -438,7 +438,10 @@ public:
         -- m_nb_removed;
         iterator out = m_indices.end() - m_nb_removed - 1;
         Index idx = *out;
-        m_base.reset(*out);
+        // the index stored at position `idx` is also reset and must be restored
+        Index index_at_idx = m_indices[idx];
+        m_base.reset(idx);
+        m_indices[idx] = index_at_idx;
         *out = idx;
         return out;
       }
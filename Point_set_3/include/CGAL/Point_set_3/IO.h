@@ -114,6 +114,13 @@ namespace IO {
       \cgalParamExtra{This parameter is only relevant for `PLY` writing: the `OFF` and `XYZ` formats
                        are always \ascii, and the `LAS` format is always binary.}
     \cgalParamNEnd
+
+    \cgalParamNBegin{concurrency_tag}
+      \cgalParamDescription{a tag indicating if the points should be decoded using one or several threads}
+      \cgalParamType{Either `CGAL::Sequential_tag`, or `CGAL::Parallel_tag`, or `CGAL::Parallel_if_available_tag`}
+      \cgalParamDefault{`CGAL::Sequential_tag`}
+      \cgalParamExtra{This parameter is only relevant for the `PLY` and `XYZ` formats.}
+    \cgalParamNEnd
   \cgalNamedParamsEnd
 
   \return `true` if the reading was successful, `false` otherwise.
@@ -126,7 +133,7 @@ bool read_point_set(const std::string& fname,
   const std::string ext = internal::get_file_extension(fname);
 
   if(ext == "xyz" || ext == "pwn")
-    return read_XYZ(fname, ps);
+    return read_XYZ(fname, ps, np);
   else if(ext == "off")
     return read_OFF(fname, ps);
   else if(ext =="ply")
@@ -17,9 +17,14 @@
 #include <CGAL/boost/graph/named_params_helper.h>
 #include <CGAL/IO/PLY.h>
 #include <CGAL/IO/io.h>
+#include <CGAL/Point_set_3/IO/internal/read_by_blocks.h>
+#include <CGAL/tags.h>
 
+#include <array>
+#include <atomic>
 #include <fstream>
 #include <string>
+#include <type_traits>
 #include <vector>
 
 namespace CGAL {
@@ -43,6 +48,10 @@ private:
   {
     virtual ~Abstract_ply_property_to_point_set_property() { }
     virtual void assign(PLY_element& element, typename Point_set::Index index) = 0;
+    // reads the property in a binary item of the vertex element
+    virtual void assign(const char* item, bool swap, typename Point_set::Index index) = 0;
+    // reads the property in the numbers parsed from an \ascii item of the vertex element
+    virtual void assign(const double* values, typename Point_set::Index index) = 0;
   };
 
   template <typename Type>
@@ -53,9 +62,12 @@ private:
     Map m_map;
     Pmap m_pmap;
     std::string m_name;
+    std::size_t m_column;
+    std::size_t m_offset;
   public:
-    PLY_property_to_point_set_property(Point_set& ps, const std::string& name)
-      : m_name(name)
+    PLY_property_to_point_set_property(Point_set& ps, const std::string& name,
+                                       std::size_t column, std::size_t offset)
+      : m_name(name), m_column(column), m_offset(offset)
     {
       m_map = ps.add_property_map(name, Type()).first;
       m_pmap = ps.push_property_map(m_map);
@@ -67,16 +79,72 @@ private:
       element.assign(t, m_name.c_str());
       put(m_pmap, index, t);
     }
+
+    virtual void assign(const char* item, bool swap, typename Point_set::Index index)
+    {
+      m_map[index] = read_binary_number<Type>(item + m_offset, swap);
+    }
+
+    virtual void assign(const double* values, typename Point_set::Index index)
+    {
+      m_map[index] = static_cast<Type>(values[m_column]);
+    }
+  };
+
+  // Layout of the coordinates of the points and of the normals in the items
+  // of the vertex element, in the order x, y, z, nx, ny, nz
+  struct Coordinate
+  {
+    bool found = false;
+    bool is_float = false;
+    std::size_t column = 0;
+    std::size_t offset = 0;
   };
 
   Point_set& m_point_set;
   bool m_use_floats;
   std::vector<Abstract_ply_property_to_point_set_property*> m_properties;
 
+  std::array<Coordinate, 6> m_coordinates;
+  std::size_t m_number_of_columns;
+  std::size_t m_item_size; // 0 if the binary items do not all have the same size
+  bool m_swap;
+
+  template <typename Type>
+  static bool is_number_of_type(PLY_read_number* property)
+  {
+    return dynamic_cast<PLY_read_typed_number<Type>*>(property) != nullptr;
+  }
+
+  // size of a property in a binary file, or 0 if it is a list
+  static std::size_t binary_size(PLY_read_number* property)
+  {
+    if(is_number_of_type<std::int8_t>(property) || is_number_of_type<std::uint8_t>(property))
+      return 1;
+    if(is_number_of_type<std::int16_t>(property) || is_number_of_type<std::uint16_t>(property))
+      return 2;
+    if(is_number_of_type<std::int32_t>(property) || is_number_of_type<std::uint32_t>(property)
+       || is_number_of_type<float>(property))
+      return 4;
+    if(is_number_of_type<double>(property))
+      return 8;
+    return 0;
+  }
+
+  template <typename Number>
+  Number coordinate(const std::size_t i, const char* item) const
+  {
+    const Coordinate& c = m_coordinates[i];
+    if(c.is_float)
+      return Number(read_binary_number<float>(item + c.offset, m_swap));
+    return Number(read_binary_number<double>(item + c.offset, m_swap));
+  }
+
 public:
 
   Point_set_3_filler(Point_set& point_set)
-    : m_point_set(point_set), m_use_floats(false)
+    : m_point_set(point_set), m_use_floats(false),
+      m_number_of_columns(0), m_item_size(0), m_swap(false)
   { }
 
   ~Point_set_3_filler()
@@ -89,11 +157,32 @@ public:
   {
     bool has_normal[3] = { false, false, false };
 
+    m_number_of_columns = element.number_of_properties();
+    m_item_size = 0;
+    bool fixed_size = true;
+    std::size_t offset = 0;
+
     for(std::size_t j=0; j<element.number_of_properties(); ++j)
     {
       internal::PLY_read_number* property = element.property(j);
+      m_swap = (property->format() == 2); // big endian
+
+      const std::size_t size = binary_size(property);
+      fixed_size = fixed_size && (size != 0);
+      const std::size_t current_offset = offset;
+      offset += size;
 
       const std::string& name = property->name();
+      const char* coordinate_names[6] = { "x", "y", "z", "nx", "ny", "nz" };
+      const std::size_t c = std::find(coordinate_names, coordinate_names + 6, name) - coordinate_names;
+      if(c < 6)
+      {
+        m_coordinates[c].found = (is_number_of_type<float>(property) || is_number_of_type<double>(property));
+        m_coordinates[c].is_float = is_number_of_type<float>(property);
+        m_coordinates[c].column = j;
+        m_coordinates[c].offset = current_offset;
+      }
+
       if(name == "x" ||
           name == "y" ||
           name == "z")
@@ -122,53 +211,156 @@ public:
       {
         m_properties.push_back
             (new PLY_property_to_point_set_property<std::int8_t>(m_point_set,
-                                                                   name));
+                                                                   name, j, current_offset));
       }
       else if(dynamic_cast<PLY_read_typed_number<std::uint8_t>*>(property))
       {
         m_properties.push_back
             (new PLY_property_to_point_set_property<std::uint8_t>(m_point_set,
-                                                                    name));
+                                                                    name, j, current_offset));
       }
       else if(dynamic_cast<PLY_read_typed_number<std::int16_t>*>(property))
       {
         m_properties.push_back
             (new PLY_property_to_point_set_property<std::int16_t>(m_point_set,
-                                                                    name));
+                                                                    name, j, current_offset));
       }
       else if(dynamic_cast<PLY_read_typed_number<std::uint16_t>*>(property))
       {
         m_properties.push_back
             (new PLY_property_to_point_set_property<std::uint16_t>(m_point_set,
-                                                                     name));
+                                                                     name, j, current_offset));
       }
       else if(dynamic_cast<PLY_read_typed_number<std::int32_t>*>(property))
       {
         m_properties.push_back
             (new PLY_property_to_point_set_property<std::int32_t>(m_point_set,
-                                                                    name));
+                                                                    name, j, current_offset));
       }
       else if(dynamic_cast<PLY_read_typed_number<std::uint32_t>*>(property))
       {
         m_properties.push_back
             (new PLY_property_to_point_set_property<std::uint32_t>(m_point_set,
-                                                                     name));
+                                                                     name, j, current_offset));
       }
       else if(dynamic_cast<PLY_read_typed_number<float>*>(property))
       {
         m_properties.push_back
             (new PLY_property_to_point_set_property<float>(m_point_set,
-                                                           name));
+                                                           name, j, current_offset));
       }
       else if(dynamic_cast<PLY_read_typed_number<double>*>(property))
       {
         m_properties.push_back
             (new PLY_property_to_point_set_property<double>(m_point_set,
-                                                            name));
+                                                            name, j, current_offset));
       }
     }
     if(has_normal[0] && has_normal[1] && has_normal[2])
       m_point_set.add_normal_map();
+    if(fixed_size)
+      m_item_size = offset;
+  }
+
+  // returns `true` if the items of the vertex element can be read by blocks, that is
+  // if they do not contain lists, and if the coordinates are stored as floating point numbers
+  bool can_read_by_blocks() const
+  {
+    const std::size_t nb_coordinates = m_point_set.has_normal_map() ? 6 : 3;
+    for(std::size_t i=0; i<nb_coordinates; ++i)
+      if(!m_coordinates[i].found)
+        return false;
+    return m_item_size != 0;
+  }
+
+  // reads the items of the vertex element by blocks
+  //
+  // In binary mode, each block is copied from the stream in a buffer with a single read, and
+  // its items are then decoded. In \ascii mode, each item must be on its own line: the lines of
+  // each block are extracted from the stream, and then parsed.
+  template <typename ConcurrencyTag>
+  bool read_by_blocks(std::istream& is, PLY_element& element, const bool binary,
+                      const ConcurrencyTag)
+  {
+    typedef typename Point_set::Index Index;
+    CGAL_precondition(can_read_by_blocks());
+
+    std::vector<char> buffer;
+    std::vector<std::string> lines;
+    std::vector<double> values;
+
+    for(std::size_t first=0; first<element.number_of_items(); first+=point_set_block_size)
+    {
+      const std::size_t nb = (std::min)(point_set_block_size, element.number_of_items() - first);
+
+      if(binary)
+      {
+        buffer.resize(nb * m_item_size);
+        if(!is.read(buffer.data(), static_cast<std::streamsize>(buffer.size())))
+          return false;
+
+        const std::vector<Index> indices = append_points(m_point_set, nb);
+        for_each_in_block<ConcurrencyTag>(nb, [&](const std::size_t i)
+        {
+          process_item(buffer.data() + i * m_item_size, indices[i]);
+        });
+      }
+      else
+      {
+        lines.resize(nb);
+        for(std::size_t i=0; i<nb; ++i)
+          if(!std::getline(is, lines[i]))
+            return false;
+
+        const std::vector<Index> indices = append_points(m_point_set, nb);
+        values.resize(nb * m_number_of_columns);
+        std::atomic<bool> ok(true);
+        for_each_in_block<ConcurrencyTag>(nb, [&](const std::size_t i)
+        {
+          double* item = values.data() + i * m_number_of_columns;
+          if(parse_numbers(lines[i].c_str(), item, m_number_of_columns) != m_number_of_columns)
+            ok = false;
+          else
+            process_item(item, indices[i]);
+        });
+        if(!ok)
+          return false;
+      }
+    }
+
+    return true;
+  }
+
+  void process_item(const char* item, typename Point_set::Index index)
+  {
+    m_point_set.point(index) = Point(coordinate<double>(0, item),
+                                     coordinate<double>(1, item),
+                                     coordinate<double>(2, item));
+    if(m_point_set.has_normal_map())
+      m_point_set.normal(index) = Vector(coordinate<double>(3, item),
+                                         coordinate<double>(4, item),
+                                         coordinate<double>(5, item));
+
+    for(std::size_t i=0; i<m_properties.size(); ++i)
+      m_properties[i]->assign(item, m_swap, index);
+  }
+
+  double coordinate(const std::size_t i, const double* values) const
+  {
+    const Coordinate& c = m_coordinates[i];
+    if(c.is_float)
+      return double(static_cast<float>(values[c.column]));
+    return values[c.column];
+  }
+
+  void process_item(const double* values, typename Point_set::Index index)
+  {
+    m_point_set.point(index) = Point(coordinate(0, values), coordinate(1, values), coordinate(2, values));
+    if(m_point_set.has_normal_map())
+      m_point_set.normal(index) = Vector(coordinate(3, values), coordinate(4, values), coordinate(5, values));
+
+    for(std::size_t i=0; i<m_properties.size(); ++i)
+      m_properties[i]->assign(values, index);
   }
 
   void process_line(PLY_element& element)
@@ -228,19 +420,55 @@ public:
   header. Each line starting by "comment " in the header is
   appended to the `comments` string (without the "comment " word).
 
+  If the vertices only have properties of fixed size (no lists) and
+  their coordinates are floating point numbers, they are read by blocks:
+  in binary mode, each block is copied from the stream with a single read
+  and its vertices are directly decoded in the property maps of the point
+  set. In \ascii mode, blocks are only used if `concurrency_tag` is
+  `CGAL::Parallel_tag`, in which case each vertex must be on its own line,
+  and the lines of each block are parsed in parallel.
+
   \attention To read a binary file, the flag `std::ios::binary` must be set during the creation of the `ifstream`.
 
+  \tparam Point the point type of the `Point_set_3`
+  \tparam Vector the vector type of the `Point_set_3`
+  \tparam NamedParameters a sequence of \ref bgl_namedparameters "Named Parameters"
+
   \param is the input stream
   \param point_set the point set
   \param comments optional PLY comments.
+  \param np optional \ref bgl_namedparameters "Named Parameters" described below
+
+  \cgalNamedParamsBegin
+    \cgalParamNBegin{concurrency_tag}
+      \cgalParamDescription{a tag indicating if the vertices should be decoded using one or several threads}
+      \cgalParamType{Either `CGAL::Sequential_tag`, or `CGAL::Parallel_tag`, or `CGAL::Parallel_if_available_tag`}
+      \cgalParamDefault{`CGAL::Sequential_tag`}
+    \cgalParamNEnd
+  \cgalNamedParamsEnd
 
   \return `true` if the reading was successful, `false` otherwise.
  */
-template <typename Point, typename Vector>
+template <typename Point, typename Vector, typename CGAL_NP_TEMPLATE_PARAMETERS>
 bool read_PLY(std::istream& is,
               CGAL::Point_set_3<Point, Vector>& point_set,
-              std::string& comments)
+              std::string& comments,
+              const CGAL_NP_CLASS& np = parameters::default_values())
 {
+  using parameters::choose_parameter;
+  using parameters::get_parameter;
+
+  typedef typename internal_np::Lookup_named_param_def<internal_np::concurrency_tag_t,
+                                                       CGAL_NP_CLASS,
+                                                       Sequential_tag>::type Concurrency_tag;
+  const Concurrency_tag concurrency_tag =
+    choose_parameter<Concurrency_tag>(get_parameter(np, internal_np::concurrency_tag));
+  constexpr bool parallel = std::is_convertible<Concurrency_tag, Parallel_tag>::value;
+
+#ifndef CGAL_LINKED_WITH_TBB
+  static_assert(!parallel, "Parallel_tag is enabled but TBB is unavailable.");
+#endif
+
   if(!is)
   {
     std::cerr << "Error: cannot open file" << std::endl;
@@ -267,6 +495,17 @@ bool read_PLY(std::istream& is,
     {
       point_set.reserve(element.number_of_items());
       filler.instantiate_properties(element);
+
+      const bool binary = (element.number_of_properties() != 0 && element.property(0)->format() != 0);
+      if(filler.can_read_by_blocks() && (binary || parallel))
+      {
+        if(!filler.read_by_blocks(is, element, binary, concurrency_tag))
+        {
+          is.setstate(std::ios::failbit);
+          return false;
+        }
+        continue;
+      }
     }
 
     for(std::size_t j=0; j<element.number_of_items(); ++j)
@@ -329,6 +568,13 @@ bool read_PLY(std::istream& is, CGAL::Point_set_3<Point, Vector>& point_set)
       \cgalParamType{Boolean}
       \cgalParamDefault{`true`}
     \cgalParamNEnd
+
+    \cgalParamNBegin{concurrency_tag}
+      \cgalParamDescription{a tag indicating if the vertices should be decoded using one or several threads}
+      \cgalParamType{Either `CGAL::Sequential_tag`, or `CGAL::Parallel_tag`, or `CGAL::Parallel_if_available_tag`}
+      \cgalParamDefault{`CGAL::Sequential_tag`}
+      \cgalParamExtra{In \ascii mode, the vertices are parsed in parallel only if each of them is on its own line.}
+    \cgalParamNEnd
   \cgalNamedParamsEnd
 
   \return `true` if the reading was successful, `false` otherwise.
@@ -344,13 +590,13 @@ bool read_PLY(const std::string& fname,
   {
     std::ifstream is(fname, std::ios::binary);
     CGAL::IO::set_mode(is, CGAL::IO::BINARY);
-    return read_PLY(is, point_set, comments);
+    return read_PLY(is, point_set, comments, np);
   }
   else
   {
     std::ifstream is(fname);
     CGAL::IO::set_mode(is, CGAL::IO::ASCII);
-    return read_PLY(is, point_set, comments);
+    return read_PLY(is, point_set, comments, np);
   }
 }
 
@@ -17,9 +17,16 @@
 #include <CGAL/boost/graph/named_params_helper.h>
 #include <CGAL/IO/read_xyz_points.h>
 #include <CGAL/IO/write_xyz_points.h>
+#include <CGAL/Point_set_3/IO/internal/read_by_blocks.h>
+#include <CGAL/tags.h>
 
+#include <array>
+#include <cstdlib>
 #include <fstream>
+#include <iostream>
 #include <string>
+#include <type_traits>
+#include <vector>
 
 namespace CGAL {
 
@@ -31,6 +38,97 @@ class Point_set_3;
 // Read
 
 namespace IO {
+namespace internal {
+
+// Reads the lines of an XYZ file by blocks, and parses the lines of each block in parallel
+template <typename ConcurrencyTag, typename Point, typename Vector>
+bool read_XYZ_by_blocks(std::istream& is, CGAL::Point_set_3<Point, Vector>& point_set,
+                        const ConcurrencyTag)
+{
+  typedef typename CGAL::Point_set_3<Point, Vector>::Index Index;
+
+  // Number of coordinates read on each line: 0 for an empty line or a comment,
+  // 3 for a point, 6 for a point and a normal, and 1 or 2 for an error
+  std::vector<std::string> lines;
+  std::vector<std::array<double, 6> > values;
+  std::vector<std::size_t> nb_values;
+  std::vector<std::size_t> points;
+
+  std::size_t line_number = 0;
+  for(;;)
+  {
+    lines.resize(point_set_block_size);
+    std::size_t nb = 0;
+    while(nb < point_set_block_size && std::getline(is, lines[nb]))
+      ++nb;
+    if(nb == 0)
+      break;
+
+    values.resize(nb);
+    nb_values.resize(nb);
+    for_each_in_block<ConcurrencyTag>(nb, [&](const std::size_t i)
+    {
+      const std::string& line = lines[i];
+      const std::size_t first = line.find_first_not_of(" ");
+      if(first == std::string::npos || line[first] == '#')
+      {
+        nb_values[i] = 0;
+        return;
+      }
+
+      nb_values[i] = parse_numbers(line.c_str(), values[i].data(), 6);
+      if(nb_values[i] > 3 && nb_values[i] < 6)
+        nb_values[i] = 2; // incomplete normal
+      else if(nb_values[i] < 3)
+        nb_values[i] = 1;
+    });
+
+    points.clear();
+    for(std::size_t i=0; i<nb; ++i)
+    {
+      if(nb_values[i] == 0)
+        continue;
+      if(nb_values[i] >= 3)
+      {
+        points.push_back(i);
+        continue;
+      }
+
+      // skips number of points on first line (optional)
+      const char* line = lines[i].c_str();
+      char* end;
+      std::strtol(line, &end, 10);
+      if(line_number + i == 0 && nb_values[i] == 1 && end != line)
+        continue;
+
+      if(nb_values[i] == 2)
+        std::cerr << "Error line " << line_number + i + 1 << " of file (incomplete normal coordinates)" << std::endl;
+      else
+        std::cerr << "Error line " << line_number + i + 1 << " of file (expected point coordinates)" << std::endl;
+      return false;
+    }
+    line_number += nb;
+
+    const std::vector<Index> indices = append_points(point_set, points.size());
+    for_each_in_block<ConcurrencyTag>(points.size(), [&](const std::size_t i)
+    {
+      const std::array<double, 6>& v = values[points[i]];
+      point_set.point(indices[i]) = Point(v[0], v[1], v[2]);
+      if(nb_values[points[i]] == 6)
+        point_set.normal(indices[i]) = Vector(v[3], v[4], v[5]);
+    });
+
+    if(nb < point_set_block_size)
+      break;
+  }
+
+  if(is.eof())
+    is.clear(is.rdstate() & ~std::ios_base::failbit); // set by getline
+
+  return true;
+}
+
+} // namespace internal
 
 /*!
   \ingroup PkgPointSet3IOXYZ
@@ -39,20 +137,62 @@ namespace IO {
 
   If normals are present in the input stream, a normal map will be created and filled.
 
+  If `concurrency_tag` is `CGAL::Parallel_tag`, the lines of the stream are
+  extracted by blocks, and the lines of each block are parsed in parallel.
+
+  \tparam Point the point type of the `Point_set_3`
+  \tparam Vector the vector type of the `Point_set_3`
+  \tparam NamedParameters a sequence of \ref bgl_namedparameters "Named Parameters"
+
   \param is the input stream
   \param point_set the point set
+  \param np an optional sequence of \ref bgl_namedparameters "Named Parameters" among the ones listed below
+
+  \cgalNamedParamsBegin
+    \cgalParamNBegin{concurrency_tag}
+      \cgalParamDescription{a tag indicating if the lines should be parsed using one or several threads}
+      \cgalParamType{Either `CGAL::Sequential_tag`, or `CGAL::Parallel_tag`, or `CGAL::Parallel_if_available_tag`}
+      \cgalParamDefault{`CGAL::Sequential_tag`}
+    \cgalParamNEnd
+  \cgalNamedParamsEnd
 
   \return `true` if the reading was successful, `false` otherwise.
  */
-template <typename Point, typename Vector>
+template <typename Point, typename Vector, typename CGAL_NP_TEMPLATE_PARAMETERS>
 bool read_XYZ(std::istream& is,
-              CGAL::Point_set_3<Point, Vector>& point_set)
+              CGAL::Point_set_3<Point, Vector>& point_set,
+              const CGAL_NP_CLASS& np = parameters::default_values())
 {
+  using parameters::choose_parameter;
+  using parameters::get_parameter;
+
+  typedef typename internal_np::Lookup_named_param_def<internal_np::concurrency_tag_t,
+                                                       CGAL_NP_CLASS,
+                                                       Sequential_tag>::type Concurrency_tag;
+  const Concurrency_tag concurrency_tag =
+    choose_parameter<Concurrency_tag>(get_parameter(np, internal_np::concurrency_tag));
+
+#ifndef CGAL_LINKED_WITH_TBB
+  static_assert(!std::is_convertible<Concurrency_tag, Parallel_tag>::value,
+                "Parallel_tag is enabled but TBB is unavailable.");
+#endif
+
   point_set.add_normal_map();
 
-  bool out = CGAL::IO::read_XYZ(is, point_set.index_back_inserter(),
-                                CGAL::parameters::point_map(point_set.point_push_map())
-                                                 .normal_map(point_set.normal_push_map()));
+  bool out;
+  if(std::is_convertible<Concurrency_tag, Parallel_tag>::value)
+  {
+    if(!is)
+    {
+      std::cerr << "Error: cannot open file" << std::endl;
+      return false;
+    }
+    out = internal::read_XYZ_by_blocks(is, point_set, concurrency_tag);
+  }
+  else
+    out = CGAL::IO::read_XYZ(is, point_set.index_back_inserter(),
+                             CGAL::parameters::point_map(point_set.point_push_map())
+                                              .normal_map(point_set.normal_push_map()));
 
   bool has_normals = false;
   for(typename CGAL::Point_set_3<Point, Vector>::const_iterator it=point_set.begin(); it!=point_set.end(); ++it)
@@ -77,16 +217,33 @@ bool read_XYZ(std::istream& is,
 
   If normals are present in the input file, a normal map will be created and filled.
 
+  If `concurrency_tag` is `CGAL::Parallel_tag`, the lines of the file are
+  extracted by blocks, and the lines of each block are parsed in parallel.
+
+  \tparam Point the point type of the `Point_set_3`
+  \tparam Vector the vector type of the `Point_set_3`
+  \tparam NamedParameters a sequence of \ref bgl_namedparameters "Named Parameters"
+
   \param fname the path to the input file
   \param point_set the point set
+  \param np an optional sequence of \ref bgl_namedparameters "Named Parameters" among the ones listed below
+
+  \cgalNamedParamsBegin
+    \cgalParamNBegin{concurrency_tag}
+      \cgalParamDescription{a tag indicating if the lines should be parsed using one or several threads}
+      \cgalParamType{Either `CGAL::Sequential_tag`, or `CGAL::Parallel_tag`, or `CGAL::Parallel_if_available_tag`}
+      \cgalParamDefault{`CGAL::Sequential_tag`}
+    \cgalParamNEnd
+  \cgalNamedParamsEnd
 
   \return `true` if the reading was successful, `false` otherwise.
 */
-template <typename Point, typename Vector>
-bool read_XYZ(const std::string& fname, CGAL::Point_set_3<Point, Vector>& point_set)
+template <typename Point, typename Vector, typename CGAL_NP_TEMPLATE_PARAMETERS>
+bool read_XYZ(const std::string& fname, CGAL::Point_set_3<Point, Vector>& point_set,
+              const CGAL_NP_CLASS& np = parameters::default_values())
 {
   std::ifstream is(fname);
-  return read_XYZ(is, point_set);
+  return read_XYZ(is, point_set, np);
 }
 
 } // namespace IO
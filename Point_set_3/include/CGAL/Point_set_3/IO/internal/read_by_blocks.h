@@ -0,0 +1,66 @@
+// Copyright (c) 2026 GeometryFactory (France).
+// All rights reserved.
+//
+// This file is part of CGAL (www.cgal.org).
+//
+// $URL$
+// $Id$
+// SPDX-License-Identifier: GPL-3.0-or-later OR LicenseRef-Commercial
+//
+// Author(s)     : GeometryFactory
+
+#ifndef CGAL_POINT_SET_3_IO_INTERNAL_READ_BY_BLOCKS_H
+#define CGAL_POINT_SET_3_IO_INTERNAL_READ_BY_BLOCKS_H
+
+#include <CGAL/license/Point_set_3.h>
+
+#include <CGAL/IO/internal/read_by_blocks.h>
+#include <CGAL/property_map.h>
+
+#include <vector>
+
+namespace CGAL {
+
+template <typename Point, typename Vector>
+class Point_set_3;
+
+namespace IO {
+namespace internal {
+
+// Helpers to put the items of a file read by blocks in the point set,
+// see also <CGAL/IO/internal/read_by_blocks.h>.
+
+constexpr std::size_t point_set_block_size = 1 << 16;
+
+// adds `n` points with default properties at the end of the point set,
+// and returns their indices
+template <typename Point, typename Vector>
+std::vector<typename Point_set_3<Point, Vector>::Index>
+append_points(Point_set_3<Point, Vector>& point_set, const std::size_t n)
+{
+  typedef typename Point_set_3<Point, Vector>::Index Index;
+
+  std::vector<Index> out;
+  out.reserve(n);
+  if(!point_set.has_garbage())
+  {
+    // all the properties are resized at once
+    const std::size_t first = point_set.size();
+    point_set.resize(first + n);
+    for(std::size_t i=0; i<n; ++i)
+      out.push_back(Index(first + i));
+  }
+  else
+  {
+    // the removed points are recycled first
+    for(std::size_t i=0; i<n; ++i)
+      out.push_back(*point_set.insert());
+  }
+  return out;
+}
+
+} // namespace internal
+} // namespace IO
+} // namespace CGAL
+
+#endif // CGAL_POINT_SET_3_IO_INTERNAL_READ_BY_BLOCKS_H
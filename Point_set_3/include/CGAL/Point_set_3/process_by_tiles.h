@@ -0,0 +1,326 @@
+// Copyright (c) 2026 GeometryFactory (France).
+// All rights reserved.
+//
+// This file is part of CGAL (www.cgal.org).
+//
+// $URL$
+// $Id$
+// SPDX-License-Identifier: GPL-3.0-or-later OR LicenseRef-Commercial
+//
+// Author(s)     : GeometryFactory
+
+#ifndef CGAL_POINT_SET_3_PROCESS_BY_TILES_H
+#define CGAL_POINT_SET_3_PROCESS_BY_TILES_H
+
+#include <CGAL/license/Point_set_3.h>
+
+#include <CGAL/Point_set_3.h>
+#include <CGAL/IO/read_points.h>
+#include <CGAL/Bbox_3.h>
+#include <CGAL/Named_function_parameters.h>
+#include <CGAL/boost/graph/named_params_helper.h>
+
+#include <boost/iterator/function_output_iterator.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstdio>
+#include <limits>
+#include <string>
+#include <vector>
+
+namespace CGAL {
+
+namespace Point_set_3_internal {
+
+// Points dispatched in the tiles, stored in a temporary file by blocks of
+// points, so that only one block per tile is kept in memory.
+class Tile_storage
+{
+public:
+  struct Record
+  {
+    double coordinates[3];
+    bool is_core;
+  };
+
+private:
+  static constexpr std::size_t block_size = 1024;
+
+  struct Block
+  {
+    std::fpos_t position;
+    std::size_t size;
+  };
+
+  struct Tile
+  {
+    std::vector<Record> buffer;
+    std::vector<Block> blocks;
+  };
+
+  std::FILE* m_file;
+  std::vector<Tile> m_tiles;
+  bool m_ok;
+
+  void flush(Tile& tile)
+  {
+    Block block;
+    m_ok = m_ok && (std::fseek(m_file, 0, SEEK_END) == 0)
+                && (std::fgetpos(m_file, &block.position) == 0)
+                && (std::fwrite(tile.buffer.data(), sizeof(Record), tile.buffer.size(), m_file)
+                    == tile.buffer.size());
+    block.size = tile.buffer.size();
+    tile.blocks.push_back(block);
+    tile.buffer.clear();
+  }
+
+public:
+  Tile_storage(const std::size_t number_of_tiles)
+    : m_file(std::tmpfile()), m_tiles(number_of_tiles), m_ok(m_file != nullptr)
+  { }
+
+  ~Tile_storage()
+  {
+    if(m_file != nullptr)
+      std::fclose(m_file);
+  }
+
+  Tile_storage(const Tile_storage&) = delete;
+  Tile_storage& operator=(const Tile_storage&) = delete;
+
+  bool ok() const { return m_ok; }
+
+  std::size_t size() const { return m_tiles.size(); }
+
+  bool empty(const std::size_t tile) const
+  {
+    return m_tiles[tile].buffer.empty() && m_tiles[tile].blocks.empty();
+  }
+
+  void push_back(const std::size_t tile, const Record& record)
+  {
+    Tile& t = m_tiles[tile];
+    if(t.buffer.capacity() == 0)
+      t.buffer.reserve(block_size);
+    t.buffer.push_back(record);
+    if(t.buffer.size() == block_size)
+      flush(t);
+  }
+
+  // reads the points of `tile`, in the order they were added, and frees its memory
+  std::vector<Record> read(const std::size_t tile)
+  {
+    Tile& t = m_tiles[tile];
+    std::vector<Record> out;
+    for(const Block& block : t.blocks)
+    {
+      const std::size_t offset = out.size();
+      out.resize(offset + block.size);
+      m_ok = m_ok && (std::fsetpos(m_file, &block.position) == 0)
+                  && (std::fread(out.data() + offset, sizeof(Record), block.size, m_file) == block.size);
+    }
+    out.insert(out.end(), t.buffer.begin(), t.buffer.end());
+    Tile().buffer.swap(t.buffer);
+    t.blocks.clear();
+    return out;
+  }
+};
+
+} // namespace Point_set_3_internal
+
+/*!
+  \ingroup PkgPointSet3Tiles
+
+  \brief processes the points of a file that does not fit in memory, tile by tile.
+
+  The space is divided in a regular grid of cubic tiles of size `tile_size`,
+  aligned on the origin. The points of the input file are read twice with
+  `CGAL::IO::read_points()`: once to compute their bounding box, and once to
+  dispatch them in the tiles, whose points are stored in a temporary file.
+  Then, for each non-empty tile, the points of the tile and the points located
+  at distance at most `halo_size` of the tile (measured along the axes) are
+  put in a point set, on which `process` is called. Finally, the points of the
+  tile (but not those of the halo) that remain in the point set are passed to
+  `output`.
+
+  If `process` only depends on the neighborhoods of the points, and if these
+  neighborhoods are contained in the halo, the result is the same as
+  processing all the points at once. This is the case, for example, of
+  `CGAL::jet_estimate_normals()` and `CGAL::remove_outliers()` with a
+  `threshold_distance` and without `threshold_percent` if the halo contains
+  the `k` nearest neighbors of the points, or of `CGAL::grid_simplify_point_set()`
+  if `tile_size` is a multiple of the size of the cells of the grid, which
+  then do not overlap two tiles.
+
+  Only the positions of the points are read, and the points of a tile
+  are inserted in the point set in the order of the file.
+
+  \tparam Point the point type of the point set
+  \tparam Vector the vector type of the point set
+  \tparam Process a functor with an operator `void operator()(CGAL::Point_set_3<Point, Vector>&)`
+  \tparam Output a functor with an operator `void operator()(const CGAL::Point_set_3<Point, Vector>&)`
+  \tparam NamedParameters a sequence of \ref bgl_namedparameters "Named Parameters"
+
+  \param fname the path to the input file, in one of the formats supported by `CGAL::IO::read_points()`
+  \param process the function called on the points of each tile and of its halo
+  \param output the function called on the points of each tile, after processing
+  \param np an optional sequence of \ref bgl_namedparameters "Named Parameters" among the ones listed below
+
+  \cgalNamedParamsBegin
+    \cgalParamNBegin{tile_size}
+      \cgalParamDescription{the size of the tiles}
+      \cgalParamType{double}
+      \cgalParamDefault{`0`, in which case all the points are in a single tile}
+    \cgalParamNEnd
+
+    \cgalParamNBegin{halo_size}
+      \cgalParamDescription{the size of the halo added around each tile}
+      \cgalParamType{double}
+      \cgalParamDefault{`0`}
+    \cgalParamNEnd
+
+    \cgalParamNBegin{use_binary_mode}
+      \cgalParamDescription{indicates whether data should be read in binary (`true`) or in \ascii (`false`)}
+      \cgalParamType{Boolean}
+      \cgalParamDefault{`true`}
+      \cgalParamExtra{This parameter is only meaningful while using PLY files.}
+    \cgalParamNEnd
+  \cgalNamedParamsEnd
+
+  \return `true` if the reading of the file and the temporary storage of the tiles were successful,
+  `false` otherwise.
+*/
+template <typename Point,
+          typename Vector = typename Kernel_traits<Point>::Kernel::Vector_3,
+          typename Process,
+          typename Output,
+          typename NamedParameters = parameters::Default_named_parameters>
+bool process_point_set_by_tiles(const std::string& fname,
+                                const Process& process,
+                                const Output& output,
+                                const NamedParameters& np = parameters::default_values())
+{
+  using parameters::choose_parameter;
+  using parameters::get_parameter;
+
+  typedef CGAL::Point_set_3<Point, Vector>             Point_set;
+  typedef Point_set_3_internal::Tile_storage           Tile_storage;
+  typedef typename Tile_storage::Record                Record;
+
+  double tile_size = choose_parameter(get_parameter(np, internal_np::tile_size), 0.);
+  const double halo_size = choose_parameter(get_parameter(np, internal_np::halo_size), 0.);
+  CGAL_precondition(tile_size >= 0 && halo_size >= 0);
+  const bool binary = choose_parameter(get_parameter(np, internal_np::use_binary_mode), true);
+  const auto read_np = parameters::use_binary_mode(binary);
+
+  // First pass: bounding box
+  Bbox_3 bbox;
+  std::size_t nb_points = 0;
+  if(!IO::read_points<Point>(fname,
+                             boost::make_function_output_iterator([&](const Point& p)
+                             {
+                               bbox += p.bbox();
+                               ++nb_points;
+                             }),
+                             read_np))
+    return false;
+  if(nb_points == 0)
+    return true;
+
+  // a single tile, of index 0
+  if(tile_size == 0)
+    tile_size = std::numeric_limits<double>::infinity();
+
+  // the tiles are indexed by `floor(x / tile_size)` along each axis
+  std::array<long long, 3> first_tile, nb_tiles;
+  for(int i=0; i<3; ++i)
+  {
+    first_tile[i] = static_cast<long long>(std::floor(bbox.min(i) / tile_size));
+    nb_tiles[i] = static_cast<long long>(std::floor(bbox.max(i) / tile_size)) - first_tile[i] + 1;
+  }
+  auto tile_coordinate = [&](const double x, const int i) -> long long
+  {
+    const long long t = static_cast<long long>(std::floor(x / tile_size)) - first_tile[i];
+    return (std::min)((std::max)(t, 0LL), nb_tiles[i] - 1);
+  };
+  auto tile_index = [&](const std::array<long long, 3>& t) -> std::size_t
+  {
+    return static_cast<std::size_t>((t[2] * nb_tiles[1] + t[1]) * nb_tiles[0] + t[0]);
+  };
+
+  // Second pass: dispatch the points in their tile and in the halos of the neighboring tiles
+  Tile_storage storage(static_cast<std::size_t>(nb_tiles[0] * nb_tiles[1] * nb_tiles[2]));
+  if(!storage.ok())
+    return false;
+
+  if(!IO::read_points<Point>(fname,
+                             boost::make_function_output_iterator([&](const Point& p)
+                             {
+                               Record r;
+                               std::array<long long, 3> tile, lower, upper;
+                               for(int i=0; i<3; ++i)
+                               {
+                                 r.coordinates[i] = CGAL::to_double(p[i]);
+                                 tile[i] = tile_coordinate(r.coordinates[i], i);
+                                 lower[i] = tile_coordinate(r.coordinates[i] - halo_size, i);
+                                 upper[i] = tile_coordinate(r.coordinates[i] + halo_size, i);
+                               }
+
+                               std::array<long long, 3> t;
+                               for(t[2]=lower[2]; t[2]<=upper[2]; ++t[2])
+                                 for(t[1]=lower[1]; t[1]<=upper[1]; ++t[1])
+                                   for(t[0]=lower[0]; t[0]<=upper[0]; ++t[0])
+                                   {
+                                     r.is_core = (t == tile);
+                                     storage.push_back(tile_index(t), r);
+                                   }
+                             }),
+                             read_np))
+    return false;
+
+  // Processing of each tile
+  for(std::size_t tile=0; tile<storage.size(); ++tile)
+  {
+    if(storage.empty(tile))
+      continue;
+
+    const std::vector<Record> records = storage.read(tile);
+    if(!storage.ok())
+      return false;
+    if(std::none_of(records.begin(), records.end(), [](const Record& r) { return r.is_core; }))
+      continue;
+
+    Point_set point_set;
+    point_set.reserve(records.size());
+    typename Point_set::template Property_map<bool> is_core
+      = point_set.template add_property_map<bool>("tile_is_core", false).first;
+    for(const Record& r : records)
+    {
+      typename Point_set::iterator it = point_set.insert(Point(r.coordinates[0], r.coordinates[1], r.coordinates[2]));
+      put(is_core, *it, r.is_core);
+    }
+
+    process(point_set);
+
+    // only the points of the tile are output
+    point_set.remove(std::partition(point_set.begin(), point_set.end(),
+                                    [&](const typename Point_set::Index& idx) -> bool
+                                    {
+                                      return get(is_core, idx);
+                                    }),
+                     point_set.end());
+    point_set.collect_garbage();
+    point_set.remove_property_map(is_core);
+
+    if(!point_set.empty())
+      output(static_cast<const Point_set&>(point_set));
+  }
+
+  return true;
+}
+
+} // namespace CGAL
+
+#endif // CGAL_POINT_SET_3_PROCESS_BY_TILES_H
@@ -0,0 +1,169 @@
+#include <CGAL/Exact_predicates_inexact_constructions_kernel.h>
+#include <CGAL/Point_set_3.h>
+#include <CGAL/Point_set_3/IO.h>
+#include <CGAL/Point_set_3/process_by_tiles.h>
+#include <CGAL/grid_simplify_point_set.h>
+#include <CGAL/jet_estimate_normals.h>
+#include <CGAL/remove_outliers.h>
+#include <CGAL/Random.h>
+
+#include <cassert>
+#include <cmath>
+#include <cstdio>
+#include <iostream>
+#include <map>
+#include <set>
+#include <array>
+#include <string>
+
+typedef CGAL::Exact_predicates_inexact_constructions_kernel Kernel;
+typedef Kernel::Point_3 Point;
+typedef Kernel::Vector_3 Vector;
+typedef CGAL::Point_set_3<Point> Point_set;
+
+const unsigned int k = 12;
+const double tile_size = 0.25;
+const double halo_size = 0.1;
+const double cell_size = tile_size / 8;
+
+double height(const double x, const double y)
+{
+  return 0.1 * std::sin(3 * x) * std::cos(2 * y);
+}
+
+// a noisy terrain with a few outliers, whose nearest neighbors are in the halo
+Point_set make_point_set()
+{
+  CGAL::Random rand(5);
+  Point_set points;
+  for(std::size_t i=0; i<20000; ++i)
+  {
+    const double x = rand.get_double(-1, 1), y = rand.get_double(-1, 1);
+    points.insert(Point(x, y, height(x, y) + rand.get_double(0, 0.002)));
+  }
+  for(std::size_t i=0; i<50; ++i)
+  {
+    const double x = rand.get_double(-1, 1), y = rand.get_double(-1, 1);
+    points.insert(Point(x, y, height(x, y) + rand.get_double(0.06, 0.08)));
+  }
+  return points;
+}
+
+void process(Point_set& points)
+{
+  points.remove(CGAL::remove_outliers<CGAL::Sequential_tag>(points, k,
+                                                            CGAL::parameters::threshold_percent(100)
+                                                                             .threshold_distance(0.05)),
+                points.end());
+  points.add_normal_map();
+  if(points.size() > k)
+      CGAL::jet_estimate_normals<CGAL::Sequential_tag>(points, k,
+                                                     CGAL::parameters::normal_map(points.normal_map()));
+}
+
+void simplify(Point_set& points)
+{
+  points.remove(CGAL::grid_simplify_point_set(points, cell_size), points.end());
+}
+
+std::map<Point, Vector> to_map(const Point_set& points)
+{
+  std::map<Point, Vector> out;
+  for(Point_set::Index idx : points)
+    out[points.point(idx)] = points.has_normal_map() ? points.normal(idx) : CGAL::NULL_VECTOR;
+  return out;
+}
+
+std::map<Point, Vector> process_by_tiles(const std::string& fname, void (*f)(Point_set&),
+                                         const double tile_size, const double halo_size)
+{
+  std::map<Point, Vector> out;
+  std::size_t nb_tiles = 0;
+  bool ok = CGAL::process_point_set_by_tiles<Point>(fname, f,
+                                                    [&](const Point_set& tile)
+                                                    {
+                                                      assert(!tile.has_property_map<bool>("tile_is_core"));
+                                                      for(Point_set::Index idx : tile)
+                                                      {
+                                                        const Point& p = tile.point(idx);
+                                                        // each point is output once
+                                                        assert(out.count(p) == 0);
+                                                        out[p] = tile.has_normal_map() ? tile.normal(idx)
+                                                                                       : CGAL::NULL_VECTOR;
+                                                      }
+                                                      ++nb_tiles;
+                                                    },
+                                                    CGAL::parameters::tile_size(tile_size)
+                                                                     .halo_size(halo_size));
+  assert(ok);
+  std::cout << "  " << nb_tiles << " tiles, " << out.size() << " points" << std::endl;
+  return out;
+}
+
+int main()
+{
+  const std::string fname = "test_process_by_tiles.xyz";
+  Point_set input = make_point_set();
+  bool ok = CGAL::IO::write_point_set(fname, input, CGAL::parameters::stream_precision(17));
+  assert(ok);
+
+  // the points are read as they were written
+  Point_set points;
+  ok = CGAL::IO::read_point_set(fname, points);
+  assert(ok && points.size() == 20050);
+
+  std::cout << "Outlier removal and normal estimation" << std::endl;
+  {
+    Point_set in_memory(points);
+    process(in_memory);
+    const std::map<Point, Vector> reference = to_map(in_memory);
+    assert(reference.size() == 20000);
+
+    for(double ts : { tile_size, 0. })
+    {
+      const std::map<Point, Vector> result = process_by_tiles(fname, process, ts, halo_size);
+      assert(result.size() == reference.size());
+      for(const auto& p : result)
+      {
+        auto it = reference.find(p.first);
+        assert(it != reference.end());
+        assert(CGAL::abs(it->second * p.second) > 1 - 1e-6);
+      }
+    }
+  }
+
+  std::cout << "Grid simplification" << std::endl;
+  {
+    Point_set in_memory(points);
+    simplify(in_memory);
+
+    // the same cells are occupied
+    auto cells = [](const std::map<Point, Vector>& pts)
+    {
+      std::set<std::array<long, 3> > out;
+      for(const auto& p : pts)
+        out.insert({ std::lround(std::floor(p.first.x() / cell_size)),
+                     std::lround(std::floor(p.first.y() / cell_size)),
+                     std::lround(std::floor(p.first.z() / cell_size)) });
+      return out;
+    };
+    const std::map<Point, Vector> result = process_by_tiles(fname, simplify, tile_size, 0.);
+    assert(result.size() == in_memory.size());
+    assert(cells(result) == cells(to_map(in_memory)));
+
+    // from a binary PLY file
+    const std::string ply_fname = "test_process_by_tiles.ply";
+    ok = CGAL::IO::write_point_set(ply_fname, points, CGAL::parameters::use_binary_mode(true));
+    assert(ok);
+    assert(process_by_tiles(ply_fname, simplify, tile_size, 0.) == result);
+    std::remove(ply_fname.c_str());
+  }
+
+  std::cout << "Missing file" << std::endl;
+  ok = CGAL::process_point_set_by_tiles<Point>("does_not_exist.xyz", process, [](const Point_set&) { });
+  assert(!ok);
+
+  std::remove(fname.c_str());
+  std::cout << "done" << std::endl;
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,188 @@
+#include <CGAL/Simple_cartesian.h>
+#include <CGAL/Point_set_3.h>
+#include <CGAL/Point_set_3/IO.h>
+#include <CGAL/Random.h>
+
+#include <cassert>
+#include <cstdint>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <string>
+
+typedef CGAL::Simple_cartesian<double> Kernel;
+typedef Kernel::Point_3 Point;
+typedef Kernel::Vector_3 Vector;
+typedef CGAL::Point_set_3<Point, Vector> Point_set;
+
+// more points than in a block
+const std::size_t nb_points = 70000;
+
+Point_set make_point_set(const bool with_normals)
+{
+  CGAL::Random rand(7);
+  Point_set points;
+  if(with_normals)
+    points.add_normal_map();
+  Point_set::Property_map<std::uint8_t> red = points.add_property_map<std::uint8_t>("red", 0).first;
+  Point_set::Property_map<std::int32_t> label = points.add_property_map<std::int32_t>("label", 0).first;
+  Point_set::Property_map<float> intensity = points.add_property_map<float>("intensity", 0.f).first;
+
+  for(std::size_t i=0; i<nb_points; ++i)
+  {
+    Point_set::iterator it = points.insert(Point(rand.get_double(-1, 1), rand.get_double(-1, 1), rand.get_double(-1, 1)));
+    if(with_normals)
+      points.normal(*it) = Vector(rand.get_double(), rand.get_double(), rand.get_double());
+    red[*it] = static_cast<std::uint8_t>(rand.get_int(0, 256));
+    label[*it] = rand.get_int(-1000, 1000);
+    intensity[*it] = static_cast<float>(rand.get_double());
+  }
+  return points;
+}
+
+bool same_point_sets(const Point_set& a, const Point_set& b, const double tolerance)
+{
+  if(a.size() != b.size() || a.has_normal_map() != b.has_normal_map())
+    return false;
+
+  auto red_a = a.property_map<std::uint8_t>("red");
+  auto red_b = b.property_map<std::uint8_t>("red");
+  auto label_a = a.property_map<std::int32_t>("label");
+  auto label_b = b.property_map<std::int32_t>("label");
+  auto intensity_a = a.property_map<float>("intensity");
+  auto intensity_b = b.property_map<float>("intensity");
+  if(!red_b || !label_b || !intensity_b)
+    return false;
+
+  Point_set::const_iterator it_a = a.begin(), it_b = b.begin();
+  for(; it_a != a.end(); ++it_a, ++it_b)
+  {
+    if(CGAL::squared_distance(a.point(*it_a), b.point(*it_b)) > tolerance * tolerance)
+      return false;
+    if(a.has_normal_map() && (a.normal(*it_a) - b.normal(*it_b)).squared_length() > tolerance * tolerance)
+      return false;
+    if(red_a.value()[*it_a] != red_b.value()[*it_b] || label_a.value()[*it_a] != label_b.value()[*it_b]
+       || CGAL::abs(intensity_a.value()[*it_a] - intensity_b.value()[*it_b]) > tolerance)
+      return false;
+  }
+  return true;
+}
+
+template <typename ConcurrencyTag>
+void test_PLY(const Point_set& points, const bool binary)
+{
+  std::cout << "  PLY, " << (binary ? "binary" : "ASCII") << std::endl;
+  std::stringstream ss(binary ? std::ios::in | std::ios::out | std::ios::binary : std::ios::in | std::ios::out);
+  if(binary)
+    CGAL::IO::set_mode(ss, CGAL::IO::BINARY);
+  else
+    ss.precision(17);
+  bool ok = CGAL::IO::write_PLY(ss, points);
+  assert(ok);
+  const std::string data = ss.str();
+
+  std::istringstream is(data, binary ? std::ios::in | std::ios::binary : std::ios::in);
+  Point_set result;
+  std::string comments;
+  ok = CGAL::IO::read_PLY(is, result, comments, CGAL::parameters::concurrency_tag(ConcurrencyTag()));
+  assert(ok);
+  assert(same_point_sets(points, result, 1e-6));
+
+  // the removed points are recycled
+  std::istringstream is2(data, binary ? std::ios::in | std::ios::binary : std::ios::in);
+  Point_set with_garbage(points);
+  for(std::size_t i=0; i<100; ++i)
+    with_garbage.remove(with_garbage.begin());
+  ok = CGAL::IO::read_PLY(is2, with_garbage, comments, CGAL::parameters::concurrency_tag(ConcurrencyTag()));
+  assert(ok);
+  assert(with_garbage.size() == 2 * nb_points - 100);
+  assert(!with_garbage.has_garbage());
+
+  // a truncated file
+  std::istringstream truncated(data.substr(0, data.size() - data.size() / 4),
+                               binary ? std::ios::in | std::ios::binary : std::ios::in);
+  ok = CGAL::IO::read_PLY(truncated, result, comments, CGAL::parameters::concurrency_tag(ConcurrencyTag()));
+  assert(!ok);
+}
+
+template <typename ConcurrencyTag>
+void test_XYZ(const Point_set& points)
+{
+  std::cout << "  XYZ" << std::endl;
+  std::ostringstream os;
+  os << nb_points << "\n# a comment\n\n";
+  bool ok = CGAL::IO::write_XYZ(os, points, CGAL::parameters::stream_precision(17));
+  assert(ok);
+
+  std::istringstream is(os.str());
+  Point_set result;
+  ok = CGAL::IO::read_XYZ(is, result, CGAL::parameters::concurrency_tag(ConcurrencyTag()));
+  assert(ok);
+  assert(result.size() == nb_points);
+  assert(result.has_normal_map() == points.has_normal_map());
+
+  Point_set::const_iterator it = points.begin(), it_result = result.begin();
+  for(; it != points.end(); ++it, ++it_result)
+  {
+    assert(points.point(*it) == result.point(*it_result));
+    if(points.has_normal_map())
+      assert(points.normal(*it) == result.normal(*it_result));
+  }
+
+  std::istringstream incomplete_normal("1 2 3\n1 2 3 4 5\n");
+  assert(!CGAL::IO::read_XYZ(incomplete_normal, result, CGAL::parameters::concurrency_tag(ConcurrencyTag())));
+  std::istringstream not_a_point("1 2 3\nfoo\n");
+  assert(!CGAL::IO::read_XYZ(not_a_point, result, CGAL::parameters::concurrency_tag(ConcurrencyTag())));
+}
+
+template <typename ConcurrencyTag>
+void test(const Point_set& points)
+{
+  test_PLY<ConcurrencyTag>(points, true);
+  test_PLY<ConcurrencyTag>(points, false);
+  test_XYZ<ConcurrencyTag>(points);
+}
+
+int main()
+{
+  for(bool with_normals : { false, true })
+  {
+    const Point_set points = make_point_set(with_normals);
+
+    std::cout << "Sequential, " << (with_normals ? "with" : "without") << " normals" << std::endl;
+    test<CGAL::Sequential_tag>(points);
+#ifdef CGAL_LINKED_WITH_TBB
+    std::cout << "Parallel, " << (with_normals ? "with" : "without") << " normals" << std::endl;
+    test<CGAL::Parallel_tag>(points);
+#endif
+  }
+
+  std::cout << "Big endian PLY" << std::endl;
+  {
+    std::ostringstream os(std::ios::out | std::ios::binary);
+    os << "ply\nformat binary_big_endian 1.0\nelement vertex 2\n"
+       << "property float x\nproperty float y\nproperty double z\nproperty short label\nend_header\n";
+    const unsigned char vertices[] = { 0x3f, 0x80, 0x00, 0x00, // 1.f
+                                       0x40, 0x00, 0x00, 0x00, // 2.f
+                                       0x40, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 3.
+                                       0xff, 0xfe, // -2
+                                       0xbf, 0x80, 0x00, 0x00, // -1.f
+                                       0x00, 0x00, 0x00, 0x00, // 0.f
+                                       0x3f, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 0.5
+                                       0x01, 0x00 }; // 256
+    os.write(reinterpret_cast<const char*>(vertices), sizeof(vertices));
+
+    std::istringstream is(os.str(), std::ios::in | std::ios::binary);
+    Point_set result;
+    std::string comments;
+    bool ok = CGAL::IO::read_PLY(is, result, comments);
+    assert(ok && result.size() == 2);
+    auto label = result.property_map<std::int16_t>("label");
+    assert(label);
+    assert(result.point(*result.begin()) == Point(1, 2, 3) && label.value()[*result.begin()] == -2);
+    assert(result.point(*(result.begin() + 1)) == Point(-1, 0, 0.5) && label.value()[*(result.begin() + 1)] == 256);
+  }
+
+  std::cout << "done" << std::endl;
+  return EXIT_SUCCESS;
+}
@@ -258,9 +258,9 @@ bool read_PLY(std::istream& is,
   PointMap point_map = NP_helper::get_point_map(np);
   NormalMap normal_map = NP_helper::get_normal_map(np);
 
-  return read_PLY_with_properties(is, output,
-                                  make_ply_point_reader(point_map),
-                                  make_ply_normal_reader(normal_map));
+  return read_PLY_with_properties<OutputIteratorValueType>(is, output,
+                                                          make_ply_point_reader(point_map),
+                                                          make_ply_normal_reader(normal_map));
 }
 
 /**
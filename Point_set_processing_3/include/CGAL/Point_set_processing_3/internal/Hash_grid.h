@@ -0,0 +1,210 @@
+// Copyright (c) 2026 GeometryFactory (France).
+// All rights reserved.
+//
+// This file is part of CGAL (www.cgal.org).
+//
+// $URL$
+// $Id$
+// SPDX-License-Identifier: GPL-3.0-or-later OR LicenseRef-Commercial
+//
+// Author(s) : GeometryFactory
+
+#ifndef CGAL_PSP_INTERNAL_HASH_GRID_H
+#define CGAL_PSP_INTERNAL_HASH_GRID_H
+
+#include <CGAL/license/Point_set_processing_3.h>
+
+#include <CGAL/assertions.h>
+#include <CGAL/Dimension.h>
+#include <CGAL/Kernel_traits.h>
+#include <CGAL/number_utils.h>
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstdint>
+#include <numeric>
+#include <vector>
+
+namespace CGAL {
+namespace Point_set_processing_3 {
+namespace internal {
+
+// Uniform grid whose non-empty cells are stored in a hash table, used to
+// answer fixed-radius neighbor queries in 2D or 3D. The items are sorted
+// by cell, so that the points of a cell are contiguous, and a query only
+// visits the cells intersecting the bounding box of its ball, that is at
+// most 3^d cells if the radius is not larger than the size of the cells.
+template <typename Point, typename Item>
+class Hash_grid
+{
+public:
+  typedef typename Kernel_traits<Point>::Kernel::FT FT;
+
+private:
+  static constexpr int D = Ambient_dimension<Point>::value;
+  typedef std::array<std::int64_t, D> Cell;
+
+  double m_cell_size;
+  std::array<double, D> m_origin;
+
+  // items and their points, sorted by cell
+  std::vector<Item> m_items;
+  std::vector<Point> m_points;
+
+  // the items of the cell `m_cells[i]` are in `[m_cell_begin[i], m_cell_begin[i+1])`
+  std::vector<Cell> m_cells;
+  std::vector<std::size_t> m_cell_begin;
+
+  // open addressing hash table storing `i+1` for the cell `m_cells[i]`, and 0 for empty slots
+  std::vector<std::size_t> m_table;
+  int m_shift;
+
+  std::int64_t cell_coordinate(const double x, const int i) const
+  {
+    return static_cast<std::int64_t>(std::floor((x - m_origin[i]) / m_cell_size));
+  }
+
+  Cell cell(const Point& p) const
+  {
+    Cell c;
+    for(int i=0; i<D; ++i)
+      c[i] = cell_coordinate(CGAL::to_double(p[i]), i);
+    return c;
+  }
+
+  std::size_t slot(const Cell& c) const
+  {
+    std::uint64_t h = 0;
+    for(int i=0; i<D; ++i)
+      h = (h ^ static_cast<std::uint64_t>(c[i])) * 0x9E3779B97F4A7C15ull;
+    return static_cast<std::size_t>(h >> m_shift);
+  }
+
+  // returns the index of the cell `c`, or `m_cells.size()` if it is empty
+  std::size_t find(const Cell& c) const
+  {
+    const std::size_t mask = m_table.size() - 1;
+    for(std::size_t s = slot(c); m_table[s] != 0; s = (s + 1) & mask)
+      if(m_cells[m_table[s] - 1] == c)
+        return m_table[s] - 1;
+    return m_cells.size();
+  }
+
+public:
+  // `point_of(item)` must return the point of `item`
+  template <typename ItemIterator, typename PointOf>
+  Hash_grid(ItemIterator first, ItemIterator beyond, const PointOf& point_of, const FT cell_size)
+    : m_cell_size(CGAL::to_double(cell_size))
+  {
+    CGAL_precondition(cell_size > FT(0));
+
+    std::vector<Item> items(first, beyond);
+    std::vector<Point> points;
+    points.reserve(items.size());
+    for(const Item& item : items)
+      points.push_back(point_of(item));
+
+    m_origin.fill(0.);
+    if(!points.empty())
+    {
+      for(int i=0; i<D; ++i)
+      {
+        m_origin[i] = CGAL::to_double(points[0][i]);
+        for(const Point& p : points)
+          m_origin[i] = (std::min)(m_origin[i], CGAL::to_double(p[i]));
+      }
+    }
+
+    std::vector<Cell> cells;
+    cells.reserve(points.size());
+    for(const Point& p : points)
+      cells.push_back(cell(p));
+
+    std::vector<std::size_t> order(points.size());
+    std::iota(order.begin(), order.end(), std::size_t(0));
+    std::sort(order.begin(), order.end(),
+              [&cells](std::size_t a, std::size_t b) { return cells[a] < cells[b]; });
+
+    m_items.reserve(items.size());
+    m_points.reserve(points.size());
+    for(std::size_t i=0; i<order.size(); ++i)
+    {
+      const std::size_t id = order[i];
+      if(i == 0 || cells[id] != m_cells.back())
+      {
+        m_cells.push_back(cells[id]);
+        m_cell_begin.push_back(i);
+      }
+      m_items.push_back(items[id]);
+      m_points.push_back(points[id]);
+    }
+    m_cell_begin.push_back(order.size());
+
+    // the table is at most half full
+    int bits = 1;
+    while((std::size_t(1) << bits) < 2 * m_cells.size())
+      ++bits;
+    m_shift = 64 - bits;
+    m_table.assign(std::size_t(1) << bits, 0);
+    const std::size_t mask = m_table.size() - 1;
+    for(std::size_t i=0; i<m_cells.size(); ++i)
+    {
+      std::size_t s = slot(m_cells[i]);
+      while(m_table[s] != 0)
+        s = (s + 1) & mask;
+      m_table[s] = i + 1;
+    }
+  }
+
+  FT cell_size() const { return FT(m_cell_size); }
+
+  // calls `f(item)` for the items whose point is at distance at most
+  // `radius` from `query`, until `f` returns `false`
+  template <typename Function>
+  void for_each_in_ball(const Point& query, const FT radius, const Function& f) const
+  {
+    if(m_cells.empty())
+      return;
+
+    const FT sq_radius = CGAL::square(radius);
+
+    // the range of cells is slightly enlarged so that rounding errors in
+    // the computation of the cells cannot discard a point of the ball
+    const double r = CGAL::to_double(radius) * (1. + 1e-9) + 1e-300;
+    Cell lower, upper;
+    for(int i=0; i<D; ++i)
+    {
+      const double x = CGAL::to_double(query[i]);
+      lower[i] = cell_coordinate(x - r, i);
+      upper[i] = cell_coordinate(x + r, i);
+    }
+
+    Cell c = lower;
+    for(;;)
+    {
+      const std::size_t id = find(c);
+      if(id != m_cells.size())
+      {
+        for(std::size_t i=m_cell_begin[id]; i<m_cell_begin[id+1]; ++i)
+          if(CGAL::squared_distance(query, m_points[i]) <= sq_radius && !f(m_items[i]))
+            return;
+      }
+
+      // next cell of the box, in the order of the sorted cells
+      int i = D - 1;
+      while(i >= 0 && c[i] == upper[i])
+      {
+        c[i] = lower[i];
+        --i;
+      }
+      if(i < 0)
+        return;
+      ++c[i];
+    }
+  }
+};
+
+} } } // namespace CGAL::Point_set_processing_3::internal
+
+#endif // CGAL_PSP_INTERNAL_HASH_GRID_H
@@ -14,6 +14,7 @@
 
 #include <CGAL/license/Point_set_processing_3.h>
 
+#include <CGAL/Point_set_processing_3/internal/Hash_grid.h>
 #include <CGAL/Search_traits_2.h>
 #include <CGAL/Search_traits_3.h>
 #include <CGAL/Fuzzy_sphere.h>
@@ -23,6 +24,8 @@
 
 #include <boost/iterator/function_output_iterator.hpp>
 
+#include <memory>
+
 namespace CGAL {
 namespace Point_set_processing_3 {
 namespace internal {
@@ -82,6 +85,8 @@ public:
   typedef CGAL::Orthogonal_k_neighbor_search<Tree_traits, Distance, Splitter, Tree> Neighbor_search;
   typedef typename Neighbor_search::iterator Search_iterator;
 
+  typedef Hash_grid<Point, input_iterator> Grid;
+
 private:
 
   PointRangeRef m_points;
@@ -90,13 +95,17 @@ private:
   Tree_traits m_traits;
   Tree m_tree;
   Distance m_distance;
+  std::unique_ptr<Grid> m_grid;
 
   // Forbid copy
   Neighbor_query (const Neighbor_query&) { }
 
 public:
 
-  Neighbor_query (PointRangeRef points, PointMap point_map)
+  // If `grid_cell_size` is not 0, the radius queries with a radius not
+  // larger than `grid_cell_size` are answered with a hash grid, and the
+  // kd-tree is only built if a k nearest neighbor query is needed.
+  Neighbor_query (PointRangeRef points, PointMap point_map, FT grid_cell_size = FT(0))
     : m_points (points)
     , m_point_map (point_map)
     , m_deref_map (point_map)
@@ -104,7 +113,15 @@ public:
     , m_tree (iterator(m_points.begin()), iterator(m_points.end()), Splitter(), m_traits)
     , m_distance (m_deref_map)
   {
-    m_tree.build();
+    if (grid_cell_size != FT(0))
+      m_grid = std::make_unique<Grid> (iterator(m_points.begin()), iterator(m_points.end()),
+                                       [&](const input_iterator& it) -> Point
+                                       {
+                                         return get (m_point_map, *it);
+                                       },
+                                       grid_cell_size);
+    else
+      m_tree.build();
   }
 
   PointMap point_map() const { return m_point_map; }
@@ -123,7 +140,16 @@ public:
 
       unsigned int nb = 0;
 
-      try
+      if (m_grid && neighbor_radius <= m_grid->cell_size())
+      {
+        m_grid->for_each_in_ball (query, neighbor_radius,
+                                  [&](const input_iterator& it) -> bool
+                                  {
+                                    *(output ++) = it;
+                                    return ++ nb != k;
+                                  });
+      }
+      else try
       {
         std::function<void(const input_iterator&)> output_iterator_with_limit
           = [&](const input_iterator& it)
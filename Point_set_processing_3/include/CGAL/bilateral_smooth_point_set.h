@@ -221,6 +221,16 @@ compute_max_spacing(
                        query (to avoid overly large number of points in high density areas).}
      \cgalParamNEnd
 
+     \cgalParamNBegin{use_hash_grid}
+       \cgalParamDescription{if `true`, the spherical neighborhoods of radius `neighbor_radius` are computed
+                             with a uniform grid whose cells have size `neighbor_radius`, instead of a kd-tree}
+       \cgalParamType{Boolean}
+       \cgalParamDefault{`false`}
+       \cgalParamExtra{This parameter is ignored if `neighbor_radius` is not provided.}
+       \cgalParamExtra{The grid is faster to build and to query than the kd-tree when the density of the point set
+                       is roughly uniform. A kd-tree is still built if a nearest neighbor query is needed.}
+     \cgalParamNEnd
+
      \cgalParamNBegin{sharpness_angle}
        \cgalParamDescription{controls the sharpness of the result}
        \cgalParamType{floating scalar value}
@@ -295,6 +305,7 @@ bilateral_smooth_point_set(
   PointMap point_map = NP_helper::get_point_map(points, np);
   NormalMap normal_map = NP_helper::get_normal_map(points, np);
   FT neighbor_radius = choose_parameter(get_parameter(np, internal_np::neighbor_radius), FT(0));
+  const bool use_hash_grid = choose_parameter(get_parameter(np, internal_np::use_hash_grid), false);
 
   std::size_t nb_points = points.size();
 
@@ -302,7 +313,7 @@ bilateral_smooth_point_set(
    std::cout << "Initialization and compute max spacing: " << std::endl;
 #endif
    // initiate a KD-tree search for points
-   Neighbor_query neighbor_query (points, point_map);
+   Neighbor_query neighbor_query (points, point_map, use_hash_grid ? neighbor_radius : FT(0));
 
    // Guess spacing
 #ifdef CGAL_PSP3_VERBOSE
@@ -103,6 +103,15 @@ CGAL::Emptyset_iterator get_adjacencies (const NamedParameters&, CGAL::Emptyset_
        \cgalParamDefault{`1` percent of the bounding box diagonal}
      \cgalParamNEnd
 
+     \cgalParamNBegin{use_hash_grid}
+       \cgalParamDescription{if `true`, the spherical neighborhoods of radius `neighbor_radius` are computed
+                             with a uniform grid whose cells have size `neighbor_radius`, instead of a kd-tree}
+       \cgalParamType{Boolean}
+       \cgalParamDefault{`false`}
+       \cgalParamExtra{The grid is faster to build and to query than the kd-tree when the density of the point set
+                       is roughly uniform. A kd-tree is still built if a nearest neighbor query is needed.}
+     \cgalParamNEnd
+
      \cgalParamNBegin{attraction_factor}
        \cgalParamDescription{used to compute adjacencies between clusters.
                              Adjacencies are computed using a nearest neighbor graph built similarly
@@ -152,6 +161,7 @@ std::size_t cluster_point_set (PointRange& points,
   PointMap point_map = NP_helper::get_point_map(points, np);
   typename Kernel::FT neighbor_radius = choose_parameter(get_parameter(np, internal_np::neighbor_radius),
                                                          typename Kernel::FT(-1));
+  const bool use_hash_grid = choose_parameter(get_parameter(np, internal_np::use_hash_grid), false);
   typename Kernel::FT factor = choose_parameter(get_parameter(np, internal_np::attraction_factor),
                                                 typename Kernel::FT(2));
 
@@ -179,7 +189,7 @@ std::size_t cluster_point_set (PointRange& points,
   for (const value_type& p : points)
     put (cluster_map, p, Cluster_index_t(-1));
 
-  Neighbor_query neighbor_query (points, point_map);
+  Neighbor_query neighbor_query (points, point_map, use_hash_grid ? neighbor_radius : typename Kernel::FT(0));
 
   std::queue<iterator> todo;
   std::size_t nb_clusters = 0;
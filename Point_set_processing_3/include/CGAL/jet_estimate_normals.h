@@ -135,6 +135,16 @@ jet_estimate_normal(const typename NeighborQuery::Point_3& query, ///< point to
                        query (to avoid overly large number of points in high density areas).}
      \cgalParamNEnd
 
+     \cgalParamNBegin{use_hash_grid}
+       \cgalParamDescription{if `true`, the spherical neighborhoods of radius `neighbor_radius` are computed
+                             with a uniform grid whose cells have size `neighbor_radius`, instead of a kd-tree}
+       \cgalParamType{Boolean}
+       \cgalParamDefault{`false`}
+       \cgalParamExtra{This parameter is ignored if `neighbor_radius` is not provided.}
+       \cgalParamExtra{The grid is faster to build and to query than the kd-tree when the density of the point set
+                       is roughly uniform. A kd-tree is still built if a nearest neighbor query is needed.}
+     \cgalParamNEnd
+
      \cgalParamNBegin{degree_fitting}
        \cgalParamDescription{the degree of fitting}
        \cgalParamType{unsigned int}
@@ -205,6 +215,7 @@ jet_estimate_normals(
   NormalMap normal_map = NP_helper::get_normal_map(points, np);
   unsigned int degree_fitting = choose_parameter(get_parameter(np, internal_np::degree_fitting), 2);
   FT neighbor_radius = choose_parameter(get_parameter(np, internal_np::neighbor_radius), FT(0));
+  const bool use_hash_grid = choose_parameter(get_parameter(np, internal_np::use_hash_grid), false);
 
   const std::function<bool(double)>& callback = choose_parameter(get_parameter(np, internal_np::callback),
                                                                std::function<bool(double)>());
@@ -224,7 +235,7 @@ jet_estimate_normals(
   CGAL_TRACE_STREAM << (memory >> 20) << " Mb allocated\n";
   CGAL_TRACE_STREAM << "  Creates KD-tree\n";
 
-  Neighbor_query neighbor_query (points, point_map);
+  Neighbor_query neighbor_query (points, point_map, use_hash_grid ? neighbor_radius : FT(0));
 
   memory = CGAL::Memory_sizer().virtual_size();
   CGAL_TRACE_STREAM << (memory >> 20) << " Mb allocated\n";
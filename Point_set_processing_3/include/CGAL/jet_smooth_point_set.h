@@ -136,6 +136,16 @@ jet_smooth_point(
                        query (to avoid overly large number of points in high density areas).}
      \cgalParamNEnd
 
+     \cgalParamNBegin{use_hash_grid}
+       \cgalParamDescription{if `true`, the spherical neighborhoods of radius `neighbor_radius` are computed
+                             with a uniform grid whose cells have size `neighbor_radius`, instead of a kd-tree}
+       \cgalParamType{Boolean}
+       \cgalParamDefault{`false`}
+       \cgalParamExtra{This parameter is ignored if `neighbor_radius` is not provided.}
+       \cgalParamExtra{The grid is faster to build and to query than the kd-tree when the density of the point set
+                       is roughly uniform. A kd-tree is still built if a nearest neighbor query is needed.}
+     \cgalParamNEnd
+
      \cgalParamNBegin{degree_fitting}
        \cgalParamDescription{the degree of fitting}
        \cgalParamType{unsigned int}
@@ -207,6 +217,7 @@ jet_smooth_point_set(
   PointMap point_map = NP_helper::get_point_map(points, np);
   typename Kernel::FT neighbor_radius = choose_parameter(get_parameter(np, internal_np::neighbor_radius),
                                                          typename Kernel::FT(0));
+  const bool use_hash_grid = choose_parameter(get_parameter(np, internal_np::use_hash_grid), false);
   unsigned int degree_fitting = choose_parameter(get_parameter(np, internal_np::degree_fitting), 2);
   unsigned int degree_monge = choose_parameter(get_parameter(np, internal_np::degree_monge), 2);
   const std::function<bool(double)>& callback = choose_parameter(get_parameter(np, internal_np::callback),
@@ -224,7 +235,7 @@ jet_smooth_point_set(
   CGAL_precondition(k >= 2);
 
   // Instantiate a KD-tree search.
-  Neighbor_query neighbor_query (points, point_map);
+  Neighbor_query neighbor_query (points, point_map, use_hash_grid ? neighbor_radius : typename Kernel::FT(0));
 
   // Iterates over input points and mutates them.
   // Implementation note: the cast to Point& allows to modify only the point's position.
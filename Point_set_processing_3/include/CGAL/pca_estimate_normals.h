@@ -124,6 +124,16 @@ pca_estimate_normal(const typename NeighborQuery::Kernel::Point_3& query, ///< p
                        query (to avoid overly large number of points in high density areas).}
      \cgalParamNEnd
 
+     \cgalParamNBegin{use_hash_grid}
+       \cgalParamDescription{if `true`, the spherical neighborhoods of radius `neighbor_radius` are computed
+                             with a uniform grid whose cells have size `neighbor_radius`, instead of a kd-tree}
+       \cgalParamType{Boolean}
+       \cgalParamDefault{`false`}
+       \cgalParamExtra{This parameter is ignored if `neighbor_radius` is not provided.}
+       \cgalParamExtra{The grid is faster to build and to query than the kd-tree when the density of the point set
+                       is roughly uniform. A kd-tree is still built if a nearest neighbor query is needed.}
+     \cgalParamNEnd
+
      \cgalParamNBegin{callback}
        \cgalParamDescription{a mechanism to get feedback on the advancement of the algorithm
                              while it's running and to interrupt it if needed}
@@ -173,6 +183,7 @@ pca_estimate_normals(
   PointMap point_map = NP_helper::get_point_map(points, np);
   NormalMap normal_map = NP_helper::get_normal_map(points, np);
   FT neighbor_radius = choose_parameter(get_parameter(np, internal_np::neighbor_radius), FT(0));
+  const bool use_hash_grid = choose_parameter(get_parameter(np, internal_np::use_hash_grid), false);
   const std::function<bool(double)>& callback = choose_parameter(get_parameter(np, internal_np::callback),
                                                                  std::function<bool(double)>());
 
@@ -195,7 +206,7 @@ pca_estimate_normals(
   CGAL_TRACE_STREAM << (memory >> 20) << " Mb allocated\n";
   CGAL_TRACE_STREAM << "  Creates KD-tree\n";
 
-  Neighbor_query neighbor_query (points, point_map);
+  Neighbor_query neighbor_query (points, point_map, use_hash_grid ? neighbor_radius : FT(0));
 
   memory = CGAL::Memory_sizer().virtual_size();
   CGAL_TRACE_STREAM << (memory >> 20) << " Mb allocated\n";
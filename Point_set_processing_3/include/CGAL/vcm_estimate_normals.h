@@ -18,6 +18,7 @@
 #include <CGAL/disable_warnings.h>
 
 #include <CGAL/Point_set_processing_3/internal/Voronoi_covariance_3/voronoi_covariance_3.h>
+#include <CGAL/Point_set_processing_3/internal/Hash_grid.h>
 
 #include <CGAL/property_map.h>
 #include <CGAL/assertions.h>
@@ -35,6 +36,7 @@
 #include <CGAL/Default_diagonalize_traits.h>
 
 #include <iterator>
+#include <memory>
 #include <vector>
 
 namespace CGAL {
@@ -109,7 +111,8 @@ vcm_convolve (ForwardIterator first,
               const std::vector<Covariance> &cov,
               std::vector<Covariance> &ncov,
               double convolution_radius,
-              const K &)
+              const K &,
+              bool use_hash_grid = false)
 {
     typedef std::pair<typename K::Point_3, std::size_t>              Tree_point;
     typedef First_of_pair_property_map< Tree_point >                  Tree_map;
@@ -117,21 +120,39 @@ vcm_convolve (ForwardIterator first,
     typedef Search_traits_adapter<Tree_point, Tree_map, Traits_base>    Traits;
     typedef Kd_tree<Traits>                                                Tree;
     typedef Fuzzy_sphere<Traits>                                   Fuzzy_sphere;
+    typedef Point_set_processing_3::internal::Hash_grid<typename K::Point_3, Tree_point> Grid;
 
-    // Kd tree
-    Tree tree;
-    tree.reserve(cov.size());
+    // Kd tree, or hash grid
+    std::vector<Tree_point> tree_points;
+    tree_points.reserve(cov.size());
     std::size_t i=0;
     for (ForwardIterator it = first; it != beyond; ++it, ++i)
-        tree.insert( Tree_point(get(point_map, *it), i) );
+        tree_points.push_back( Tree_point(get(point_map, *it), i) );
+
+    Tree tree;
+    std::unique_ptr<Grid> grid;
+    if (use_hash_grid)
+      grid = std::make_unique<Grid>(tree_points.begin(), tree_points.end(),
+                                    [](const Tree_point& p) -> const typename K::Point_3& { return p.first; },
+                                    typename K::FT(convolution_radius));
+    else
+      tree.insert(tree_points.begin(), tree_points.end());
 
     // Convolving
     ncov.clear();
     ncov.reserve(cov.size());
     for (ForwardIterator it = first; it != beyond; ++it) {
         std::vector<Tree_point> nn;
-        tree.search(std::back_inserter(nn),
-                    Fuzzy_sphere (get(point_map, *it), convolution_radius));
+        if (grid)
+          grid->for_each_in_ball(get(point_map, *it), typename K::FT(convolution_radius),
+                                 [&nn](const Tree_point& p) -> bool
+                                 {
+                                   nn.push_back(p);
+                                   return true;
+                                 });
+        else
+          tree.search(std::back_inserter(nn),
+                      Fuzzy_sphere (get(point_map, *it), convolution_radius));
 
         Covariance m;
         std::fill(m.begin(), m.end(), typename K::FT(0));
@@ -245,6 +266,15 @@ vcm_convolve (ForwardIterator first,
        \cgalParamDefault{`CGAL::Identity_property_map<geom_traits::Point_3>`}
      \cgalParamNEnd
 
+     \cgalParamNBegin{use_hash_grid}
+       \cgalParamDescription{if `true`, the convolution uses a uniform grid whose cells have size
+                             `convolution_radius` instead of a kd-tree}
+       \cgalParamType{Boolean}
+       \cgalParamDefault{`false`}
+       \cgalParamExtra{The grid is faster to build and to query than the kd-tree when the density of
+                       the point set is roughly uniform.}
+     \cgalParamNEnd
+
      \cgalParamNBegin{geom_traits}
        \cgalParamDescription{an instance of a geometric traits class}
        \cgalParamType{a model of `Kernel`}
@@ -275,6 +305,7 @@ compute_vcm (const PointRange& points,
 
     PointMap point_map = NP_helper::get_const_point_map(points, np);
     Kernel kernel = NP_helper::get_geom_traits(points, np);
+    const bool use_hash_grid = choose_parameter(get_parameter(np, internal_np::use_hash_grid), false);
 
     // First, compute the VCM for each point
     std::vector< std::array<double, 6> > cov;
@@ -295,7 +326,8 @@ compute_vcm (const PointRange& points,
                                cov,
                                ccov,
                                convolution_radius,
-                               kernel);
+                               kernel,
+                               use_hash_grid);
     }
 }
 
@@ -416,6 +448,15 @@ vcm_estimate_normals_internal (PointRange& points,
                          Otherwise, the internal implementation `CGAL::Diagonalize_traits` is used}
      \cgalParamNEnd
 
+     \cgalParamNBegin{use_hash_grid}
+       \cgalParamDescription{if `true`, the convolution uses a uniform grid whose cells have size
+                             `convolution_radius` instead of a kd-tree}
+       \cgalParamType{Boolean}
+       \cgalParamDefault{`false`}
+       \cgalParamExtra{The grid is faster to build and to query than the kd-tree when the density of
+                       the point set is roughly uniform.}
+     \cgalParamNEnd
+
      \cgalParamNBegin{geom_traits}
        \cgalParamDescription{an instance of a geometric traits class}
        \cgalParamType{a model of `Kernel`}
@@ -31,8 +31,10 @@
 #include <algorithm>
 #include <cmath>
 #include <ctime>
+#include <memory>
 
 #include <CGAL/Point_set_processing_3/internal/Callback_wrapper.h>
+#include <CGAL/Point_set_processing_3/internal/Hash_grid.h>
 #include <CGAL/for_each.h>
 
 #include <CGAL/Simple_cartesian.h>
@@ -83,13 +85,55 @@ public:
   typedef typename Kernel::Point_3 PointType;
 };
 
+// Range search structure: a Kd-tree, or a hash grid if a cell size is given
+template <typename Kernel>
+class Range_search
+{
+  typedef typename Kernel::FT FT;
+  typedef typename Kernel::Point_3 Point;
+  typedef Kd_tree_element<Kernel> Element;
+  typedef typename CGAL::Orthogonal_k_neighbor_search<Kd_tree_traits<Kernel> >::Tree Tree;
+  typedef CGAL::Fuzzy_sphere<Kd_tree_traits<Kernel> > Fuzzy_sphere;
+  typedef Point_set_processing_3::internal::Hash_grid<Point, Element> Grid;
+
+  std::unique_ptr<Tree> m_tree;
+  std::unique_ptr<Grid> m_grid;
+
+public:
+  template <typename InputIterator>
+  Range_search(InputIterator first, InputIterator beyond, const FT grid_cell_size)
+  {
+    if (grid_cell_size > FT(0))
+      m_grid = std::make_unique<Grid>(first, beyond,
+                                      [](const Element& e) -> const Point& { return e; },
+                                      grid_cell_size);
+    else
+      m_tree = std::make_unique<Tree>(first, beyond);
+  }
+
+  // outputs the elements at distance at most `radius` from `query`
+  template <typename OutputIterator>
+  void search(OutputIterator output, const Point& query, const FT radius) const
+  {
+    if (m_grid)
+      m_grid->for_each_in_ball(query, radius,
+                               [&](const Element& e) -> bool
+                               {
+                                 *(output ++) = e;
+                                 return true;
+                               });
+    else
+      m_tree->search(output, Fuzzy_sphere(query, radius, 0.0));
+  }
+};
+
 /// Compute average and repulsion term, then
 /// compute and update sample point locations
 ///
 /// \pre `radius > 0`
 ///
 /// @tparam Kernel Geometric traits class.
-/// @tparam Tree Kd-tree.
+/// @tparam Tree range search structure.
 ///
 /// @return average term vector
 template <typename Kernel,
@@ -116,13 +160,10 @@ compute_update_sample_point(
 
   //types for range search
   typedef simplify_and_regularize_internal::Kd_tree_element<Kernel> Kd_tree_point;
-  typedef simplify_and_regularize_internal::Kd_tree_traits<Kernel> Traits;
-  typedef CGAL::Fuzzy_sphere<Traits> Fuzzy_sphere;
 
   //range search for original neighborhood
-  Fuzzy_sphere fs(query, radius, 0.0);
   std::vector<Kd_tree_point> neighbor_original_points;
-  original_kd_tree.search(std::back_inserter(neighbor_original_points), fs);
+  original_kd_tree.search(std::back_inserter(neighbor_original_points), query, radius);
 
   //Compute average term
   FT radius2 = radius * radius;
@@ -165,9 +206,8 @@ compute_update_sample_point(
 
   //Compute repulsion term
 
-  Fuzzy_sphere fs2(query, radius, 0.0);
   std::vector<Kd_tree_point> neighbor_sample_points;
-  sample_kd_tree.search(std::back_inserter(neighbor_sample_points), fs2);
+  sample_kd_tree.search(std::back_inserter(neighbor_sample_points), query, radius);
 
   weight = (FT)0.0;
   FT repulsion_weight_sum = (FT)0.0;
@@ -220,7 +260,7 @@ compute_update_sample_point(
 /// \pre `k >= 2`, radius > 0
 ///
 /// @tparam Kernel Geometric traits class.
-/// @tparam Tree Kd-tree.
+/// @tparam Tree range search structure.
 ///
 /// @return computed point
 template <typename Kernel, typename Tree>
@@ -239,14 +279,11 @@ compute_density_weight_for_original_point(
 
   //types for range search
   typedef simplify_and_regularize_internal::Kd_tree_element<Kernel> Kd_tree_point;
-  typedef simplify_and_regularize_internal::Kd_tree_traits<Kernel> Traits;
-  typedef CGAL::Fuzzy_sphere<Traits> Fuzzy_sphere;
 
   //range search for original neighborhood
-  Fuzzy_sphere fs(query, radius, 0.0);
   std::vector<Kd_tree_point> neighbor_original_points;
 
-  original_kd_tree.search(std::back_inserter(neighbor_original_points), fs);
+  original_kd_tree.search(std::back_inserter(neighbor_original_points), query, radius);
 
   //Compute density weight
   FT radius2 = radius * radius;
@@ -277,7 +314,7 @@ compute_density_weight_for_original_point(
 /// \pre `k >= 2`, radius > 0
 ///
 /// @tparam Kernel Geometric traits class.
-/// @tparam Tree Kd-tree.
+/// @tparam Tree range search structure.
 ///
 /// @return computed point
 template <typename Kernel, typename Tree>
@@ -294,13 +331,10 @@ compute_density_weight_for_sample_point(
 
   //types for range search
   typedef simplify_and_regularize_internal::Kd_tree_element<Kernel> Kd_tree_point;
-  typedef simplify_and_regularize_internal::Kd_tree_traits<Kernel> Traits;
-  typedef CGAL::Fuzzy_sphere<Traits> Fuzzy_sphere;
 
   //range search for original neighborhood
-  Fuzzy_sphere fs(query, radius, 0.0);
   std::vector<Kd_tree_point> neighbor_sample_points;
-  sample_kd_tree.search(std::back_inserter(neighbor_sample_points), fs);
+  sample_kd_tree.search(std::back_inserter(neighbor_sample_points), query, radius);
 
   //Compute density weight
   FT radius2 = radius * radius;
@@ -387,6 +421,15 @@ compute_density_weight_for_sample_point(
                        includes at least two rings of neighboring sample points gives satisfactory result.}
      \cgalParamNEnd
 
+     \cgalParamNBegin{use_hash_grid}
+       \cgalParamDescription{if `true`, the spherical neighborhoods are computed with uniform grids
+                             whose cells have size `neighbor_radius`, instead of kd-trees}
+       \cgalParamType{Boolean}
+       \cgalParamDefault{`false`}
+       \cgalParamExtra{The grids are faster to build and to query than the kd-trees when the density of
+                       the point set is roughly uniform.}
+     \cgalParamNEnd
+
      \cgalParamNBegin{number_of_iterations}
        \cgalParamDescription{number of iterations to solve the optimsation problem}
        \cgalParamType{unsigned int}
@@ -449,6 +492,7 @@ wlop_simplify_and_regularize_point_set(
   double radius = choose_parameter(get_parameter(np, internal_np::neighbor_radius), -1);
   unsigned int iter_number = choose_parameter(get_parameter(np, internal_np::number_of_iterations), 35);
   bool require_uniform_sampling = choose_parameter(get_parameter(np, internal_np::require_uniform_sampling), false);
+  const bool use_hash_grid = choose_parameter(get_parameter(np, internal_np::use_hash_grid), false);
   const std::function<bool(double)>& callback = choose_parameter(get_parameter(np, internal_np::callback),
                                                                  std::function<bool(double)>());
 
@@ -457,9 +501,7 @@ wlop_simplify_and_regularize_point_set(
 
   // types for K nearest neighbors search structure
   typedef simplify_and_regularize_internal::Kd_tree_element<Kernel> Kd_tree_element;
-  typedef simplify_and_regularize_internal::Kd_tree_traits<Kernel> Tree_traits;
-  typedef CGAL::Orthogonal_k_neighbor_search<Tree_traits> Neighbor_search;
-  typedef typename Neighbor_search::Tree Kd_Tree;
+  typedef simplify_and_regularize_internal::Range_search<Kernel> Kd_Tree;
 
   // precondition: at least one element in the container.
   // to fix: should have at least three distinct points
@@ -512,8 +554,10 @@ wlop_simplify_and_regularize_point_set(
   std::vector<Kd_tree_element> original_treeElements;
   for (it = first_original_iter, i=0 ; it != points.end() ; ++it, ++i)
     original_treeElements.push_back( Kd_tree_element(get(point_map, *it), i) );
+  const FT grid_cell_size = use_hash_grid ? FT(radius) : FT(0);
   Kd_Tree original_kd_tree(original_treeElements.begin(),
-                           original_treeElements.end());
+                           original_treeElements.end(),
+                           grid_cell_size);
 
 
   std::vector<Point> update_sample_points(number_of_sample);
@@ -548,7 +592,7 @@ wlop_simplify_and_regularize_point_set(
       Point& p0 = sample_points[i];
       sample_treeElements.push_back(Kd_tree_element(p0,i));
     }
-    Kd_Tree sample_kd_tree(sample_treeElements.begin(), sample_treeElements.end());
+    Kd_Tree sample_kd_tree(sample_treeElements.begin(), sample_treeElements.end(), grid_cell_size);
 
     // Compute sample density weight for sample points
     std::vector<FT> sample_density_weights;
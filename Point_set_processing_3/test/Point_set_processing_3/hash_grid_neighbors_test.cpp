@@ -0,0 +1,215 @@
+// Checks that the fixed-radius neighborhoods computed with a hash grid
+// (named parameter `use_hash_grid`) give the same results as the kd-tree.
+
+#include <CGAL/Exact_predicates_inexact_constructions_kernel.h>
+#include <CGAL/point_generators_2.h>
+#include <CGAL/point_generators_3.h>
+#include <CGAL/Random.h>
+
+#include <CGAL/Point_set_processing_3/internal/Hash_grid.h>
+#include <CGAL/remove_outliers.h>
+#include <CGAL/pca_estimate_normals.h>
+#include <CGAL/jet_estimate_normals.h>
+#include <CGAL/jet_smooth_point_set.h>
+#include <CGAL/bilateral_smooth_point_set.h>
+#include <CGAL/cluster_point_set.h>
+#include <CGAL/wlop_simplify_and_regularize_point_set.h>
+#include <CGAL/vcm_estimate_normals.h>
+#include <CGAL/property_map.h>
+
+#include <boost/property_map/property_map.hpp>
+
+#include <algorithm>
+#include <cassert>
+#include <iostream>
+#include <iterator>
+#include <map>
+#include <utility>
+#include <vector>
+
+typedef CGAL::Exact_predicates_inexact_constructions_kernel Kernel;
+typedef Kernel::FT FT;
+typedef Kernel::Point_2 Point_2;
+typedef Kernel::Point_3 Point;
+typedef Kernel::Vector_3 Vector;
+typedef std::pair<Point, Vector> Point_with_normal;
+typedef CGAL::First_of_pair_property_map<Point_with_normal> Point_map;
+typedef CGAL::Second_of_pair_property_map<Point_with_normal> Normal_map;
+
+template <class P>
+void test_grid(const std::vector<P>& points, const std::vector<P>& queries, const FT radius)
+{
+  typedef CGAL::Point_set_processing_3::internal::Hash_grid<P, std::size_t> Grid;
+
+  std::vector<std::size_t> ids(points.size());
+  for(std::size_t i=0; i<ids.size(); ++i)
+    ids[i] = i;
+  Grid grid(ids.begin(), ids.end(), [&](std::size_t i) { return points[i]; }, radius);
+
+  for(const P& q : queries)
+  {
+    for(const FT r : { radius / 3, radius })
+    {
+      std::vector<std::size_t> result, reference;
+      grid.for_each_in_ball(q, r, [&](std::size_t i) { result.push_back(i); return true; });
+      for(std::size_t i=0; i<points.size(); ++i)
+        if(CGAL::squared_distance(q, points[i]) <= r * r)
+          reference.push_back(i);
+      std::sort(result.begin(), result.end());
+      assert(result == reference);
+    }
+
+    // interruption
+    std::size_t nb = 0;
+    grid.for_each_in_ball(q, radius, [&](std::size_t) { return ++nb != 2; });
+    assert(nb <= 2);
+  }
+}
+
+// compares the first `n` normals, as the normals of isolated outliers are unstable
+bool same_normals(const std::vector<Point_with_normal>& a, const std::vector<Point_with_normal>& b,
+                  const std::size_t n)
+{
+  for(std::size_t i=0; i<n; ++i)
+    if(CGAL::abs(a[i].second * b[i].second) < 0.999)
+      return false;
+  return true;
+}
+
+bool same_points(const std::vector<Point_with_normal>& a, const std::vector<Point_with_normal>& b)
+{
+  if(a.size() != b.size())
+    return false;
+  for(std::size_t i=0; i<a.size(); ++i)
+    if(CGAL::squared_distance(a[i].first, b[i].first) > 1e-16)
+      return false;
+  return true;
+}
+
+int main()
+{
+  CGAL::Random rand(3);
+
+  // the grid alone, in 2D and 3D
+  std::vector<Point_2> points_2, queries_2;
+  std::copy_n(CGAL::Random_points_in_square_2<Point_2>(1., rand), 2000, std::back_inserter(points_2));
+  std::copy_n(CGAL::Random_points_in_square_2<Point_2>(1.2, rand), 100, std::back_inserter(queries_2));
+  test_grid(points_2, queries_2, 0.05);
+
+  std::vector<Point> points_3, queries_3;
+  std::copy_n(CGAL::Random_points_in_cube_3<Point>(1., rand), 2000, std::back_inserter(points_3));
+  std::copy_n(CGAL::Random_points_in_cube_3<Point>(1.2, rand), 100, std::back_inserter(queries_3));
+  test_grid(points_3, queries_3, 0.2);
+  test_grid(points_3, std::vector<Point>(), 0.2);
+  test_grid(std::vector<Point>(1, Point(1, 2, 3)), queries_3, 0.2);
+
+  // a noisy sphere with a few outliers
+  const std::size_t nb_on_sphere = 3000;
+  std::vector<Point_with_normal> points;
+  CGAL::Random_points_on_sphere_3<Point> on_sphere(1., rand);
+  for(std::size_t i=0; i<nb_on_sphere; ++i, ++on_sphere)
+    points.emplace_back(*on_sphere + 0.002 * Vector(rand.get_double(), rand.get_double(), rand.get_double()),
+                        CGAL::NULL_VECTOR);
+  for(std::size_t i=0; i<30; ++i)
+    points.emplace_back(Point(rand.get_double(-2, 2), rand.get_double(-2, 2), rand.get_double(-2, 2)),
+                        CGAL::NULL_VECTOR);
+
+  const FT radius = 0.15;
+  auto np = CGAL::parameters::point_map(Point_map()).normal_map(Normal_map()).neighbor_radius(radius);
+
+  std::cout << "remove_outliers" << std::endl;
+  {
+    std::vector<Point_with_normal> with_tree(points), with_grid(points);
+    with_tree.erase(CGAL::remove_outliers<CGAL::Sequential_tag>(with_tree, 1000, np.threshold_percent(1.)),
+                    with_tree.end());
+    with_grid.erase(CGAL::remove_outliers<CGAL::Parallel_if_available_tag>
+                      (with_grid, 1000, np.threshold_percent(1.).use_hash_grid(true)),
+                    with_grid.end());
+    assert(with_tree.size() == with_grid.size());
+    auto less = [](const Point_with_normal& a, const Point_with_normal& b) { return a.first < b.first; };
+    std::sort(with_tree.begin(), with_tree.end(), less);
+    std::sort(with_grid.begin(), with_grid.end(), less);
+    assert(same_points(with_tree, with_grid));
+  }
+
+  std::cout << "pca_estimate_normals" << std::endl;
+  {
+    std::vector<Point_with_normal> with_tree(points), with_grid(points);
+    CGAL::pca_estimate_normals<CGAL::Sequential_tag>(with_tree, 1000, np);
+    CGAL::pca_estimate_normals<CGAL::Parallel_if_available_tag>(with_grid, 1000, np.use_hash_grid(true));
+    assert(same_normals(with_tree, with_grid, nb_on_sphere));
+  }
+
+  std::cout << "jet_estimate_normals" << std::endl;
+  {
+    std::vector<Point_with_normal> with_grid(points);
+    CGAL::jet_estimate_normals<CGAL::Parallel_if_available_tag>(with_grid, 1000, np.use_hash_grid(true));
+    // the jet is fitted at the first point of the neighborhood, which is not the same
+    // with the grid and with the kd-tree, so the normals are only compared to the sphere
+    for(std::size_t i=0; i<nb_on_sphere; ++i)
+      assert(CGAL::abs(with_grid[i].second * (with_grid[i].first - CGAL::ORIGIN)) > 0.7);
+  }
+
+  std::cout << "jet_smooth_point_set" << std::endl;
+  {
+    std::vector<Point_with_normal> with_grid(points);
+    CGAL::jet_smooth_point_set<CGAL::Parallel_if_available_tag>(with_grid, 1000, np.use_hash_grid(true));
+    for(std::size_t i=0; i<nb_on_sphere; ++i)
+      assert(CGAL::abs((with_grid[i].first - CGAL::ORIGIN).squared_length() - 1) < 0.05);
+  }
+
+  std::cout << "cluster_point_set" << std::endl;
+  {
+    std::vector<Point> input;
+    for(const Point_with_normal& pwn : points)
+      input.push_back(pwn.first);
+    std::map<Point, std::size_t> clusters_with_tree, clusters_with_grid;
+    std::size_t nb_with_tree =
+      CGAL::cluster_point_set(input, boost::make_assoc_property_map(clusters_with_tree),
+                              CGAL::parameters::neighbor_radius(0.05));
+    std::size_t nb_with_grid =
+      CGAL::cluster_point_set(input, boost::make_assoc_property_map(clusters_with_grid),
+                              CGAL::parameters::neighbor_radius(0.05).use_hash_grid(true));
+    assert(nb_with_tree == nb_with_grid);
+    assert(clusters_with_tree == clusters_with_grid);
+  }
+
+  // the following functions need normals
+  CGAL::pca_estimate_normals<CGAL::Sequential_tag>(points, 12, np.neighbor_radius(0));
+
+  std::cout << "bilateral_smooth_point_set" << std::endl;
+  {
+    std::vector<Point_with_normal> with_tree(points), with_grid(points);
+    CGAL::bilateral_smooth_point_set<CGAL::Sequential_tag>(with_tree, 1000, np);
+    CGAL::bilateral_smooth_point_set<CGAL::Parallel_if_available_tag>(with_grid, 1000, np.use_hash_grid(true));
+    for(std::size_t i=0; i<points.size(); ++i)
+      assert(CGAL::squared_distance(with_tree[i].first, with_grid[i].first) < 1e-12);
+  }
+
+  std::cout << "vcm_estimate_normals" << std::endl;
+  {
+    std::vector<Point_with_normal> with_tree(points), with_grid(points);
+    CGAL::vcm_estimate_normals(with_tree, 0.2, 0.1, np);
+    CGAL::vcm_estimate_normals(with_grid, 0.2, 0.1, np.use_hash_grid(true));
+    assert(same_normals(with_tree, with_grid, nb_on_sphere));
+  }
+
+  std::cout << "wlop_simplify_and_regularize_point_set" << std::endl;
+  {
+    // the points are shuffled by the function
+    std::vector<Point_with_normal> with_tree(points), with_grid(points);
+    std::vector<Point> output_with_tree, output_with_grid;
+    CGAL::get_default_random() = CGAL::Random(1);
+    CGAL::wlop_simplify_and_regularize_point_set<CGAL::Sequential_tag>
+      (with_tree, std::back_inserter(output_with_tree), np.number_of_iterations(5));
+    CGAL::get_default_random() = CGAL::Random(1);
+    CGAL::wlop_simplify_and_regularize_point_set<CGAL::Parallel_if_available_tag>
+      (with_grid, std::back_inserter(output_with_grid), np.number_of_iterations(5).use_hash_grid(true));
+    assert(output_with_tree.size() == output_with_grid.size());
+    for(std::size_t i=0; i<output_with_tree.size(); ++i)
+      assert(CGAL::squared_distance(output_with_tree[i], output_with_grid[i]) < 1e-12);
+  }
+
+  std::cout << "done" << std::endl;
+  return EXIT_SUCCESS;
+}
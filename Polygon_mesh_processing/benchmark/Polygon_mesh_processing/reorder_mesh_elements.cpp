@@ -0,0 +1,85 @@
+#include <CGAL/Exact_predicates_inexact_constructions_kernel.h>
+#include <CGAL/Surface_mesh.h>
+
+#include <CGAL/Polygon_mesh_processing/reorder_mesh_elements.h>
+#include <CGAL/Polygon_mesh_processing/compute_normal.h>
+#include <CGAL/Polygon_mesh_processing/interpolated_corrected_curvatures.h>
+#include <CGAL/subdivision_method_3.h>
+#include <CGAL/IO/polygon_mesh_io.h>
+#include <CGAL/Real_timer.h>
+#include <CGAL/Testsuite/shuffle_polygon_mesh.h>
+
+#include <algorithm>
+#include <iostream>
+#include <string>
+#include <vector>
+
+// Times the computation of normals and curvatures on a mesh whose elements are in a random order,
+// as after `polygon_soup_to_polygon_mesh()`, and then on the same mesh after `reorder_mesh_elements()`.
+//
+// Usage: reorder_mesh_elements [mesh] [number of Loop subdivisions]
+
+typedef CGAL::Exact_predicates_inexact_constructions_kernel K;
+typedef K::Point_3 Point_3;
+typedef K::Vector_3 Vector_3;
+typedef CGAL::Surface_mesh<Point_3> Mesh;
+typedef Mesh::Vertex_index vertex_descriptor;
+typedef Mesh::Face_index face_descriptor;
+
+namespace PMP = CGAL::Polygon_mesh_processing;
+
+void run(const std::string& name, Mesh m)
+{
+  std::cout << name << std::endl;
+
+  Mesh::Property_map<vertex_descriptor, Vector_3> vnormals =
+    m.add_property_map<vertex_descriptor, Vector_3>("v:normal").first;
+  Mesh::Property_map<face_descriptor, Vector_3> fnormals =
+    m.add_property_map<face_descriptor, Vector_3>("f:normal").first;
+  Mesh::Property_map<vertex_descriptor, K::FT> mean_curvatures =
+    m.add_property_map<vertex_descriptor, K::FT>("v:mean_curvature").first;
+  Mesh::Property_map<vertex_descriptor, K::FT> Gaussian_curvatures =
+    m.add_property_map<vertex_descriptor, K::FT>("v:Gaussian_curvature").first;
+
+  CGAL::Real_timer timer;
+  timer.start();
+  PMP::compute_normals(m, vnormals, fnormals);
+  std::cout << "  compute_normals(): " << timer.time() << " s" << std::endl;
+
+  timer.reset();
+  PMP::interpolated_corrected_curvatures(m, CGAL::parameters::vertex_mean_curvature_map(mean_curvatures)
+                                                             .vertex_Gaussian_curvature_map(Gaussian_curvatures));
+  std::cout << "  interpolated_corrected_curvatures(): " << timer.time() << " s" << std::endl;
+}
+
+int main(int argc, char** argv)
+{
+  const std::string filename = (argc > 1) ? argv[1] : CGAL::data_file_path("meshes/elephant.off");
+  const unsigned int subdivisions = (argc > 2) ? std::atoi(argv[2]) : 4;
+
+  Mesh m;
+  if(!CGAL::IO::read_polygon_mesh(filename, m))
+  {
+    std::cerr << "Invalid input file." << std::endl;
+    return EXIT_FAILURE;
+  }
+  CGAL::Subdivision_method_3::Loop_subdivision(m, CGAL::parameters::number_of_iterations(subdivisions));
+  CGAL::Testsuite::shuffle_polygon_mesh(m);
+  std::cout << m.number_of_vertices() << " vertices and " << m.number_of_faces() << " faces" << std::endl;
+
+  run("random order", m);
+
+  CGAL::Real_timer timer;
+  timer.start();
+  PMP::reorder_mesh_elements(m, CGAL::parameters::concurrency_tag(CGAL::Parallel_if_available_tag()));
+  std::cout << "reorder_mesh_elements() in Hilbert order: " << timer.time() << " s" << std::endl;
+  run("Hilbert order", m);
+
+  CGAL::Testsuite::shuffle_polygon_mesh(m);
+  timer.reset();
+  PMP::reorder_mesh_elements(m, CGAL::parameters::element_order(PMP::REVERSE_CUTHILL_MCKEE_ORDER));
+  std::cout << "reorder_mesh_elements() in reverse Cuthill-McKee order: " << timer.time() << " s" << std::endl;
+  run("reverse Cuthill-McKee order", m);
+
+  return EXIT_SUCCESS;
+}
@@ -18,12 +18,23 @@
 #include <CGAL/disable_warnings.h>
 
 #include <CGAL/boost/graph/copy_face_graph.h>
+#include <CGAL/boost/graph/helpers.h>
 #include <CGAL/boost/graph/named_params_helper.h>
+#include <CGAL/Polygon_mesh_processing/bbox.h>
 #include <CGAL/Polygon_mesh_processing/intersection.h>
 #include <CGAL/Polygon_mesh_processing/internal/Corefinement/Visitor.h>
 #include <CGAL/Polygon_mesh_processing/internal/Corefinement/Face_graph_output_builder.h>
 #include <CGAL/Polygon_mesh_processing/internal/Corefinement/Output_builder_for_autorefinement.h>
 #include <CGAL/iterator.h>
+#include <CGAL/for_each.h>
+#include <CGAL/hilbert_sort.h>
+#include <CGAL/property_map.h>
+#include <CGAL/Simple_cartesian.h>
+#include <CGAL/Spatial_sort_traits_adapter_3.h>
+#include <CGAL/tags.h>
+
+#include <algorithm>
+#include <vector>
 
 
 namespace CGAL {
@@ -232,6 +243,15 @@ enum Boolean_operation_type {UNION = 0, INTERSECTION=1,
   *     \cgalParamDefault{`false`}
   *     \cgalParamExtra{`np1` only}
   *   \cgalParamNEnd
+  *
+  *   \cgalParamNBegin{concurrency_tag}
+  *     \cgalParamDescription{a tag indicating if the intersections of the faces of `tm1` and `tm2` should be computed
+  *                           and the intersected faces retriangulated sequentially or in parallel}
+  *     \cgalParamType{Either `CGAL::Sequential_tag`, or `CGAL::Parallel_tag`, or `CGAL::Parallel_if_available_tag`}
+  *     \cgalParamDefault{`CGAL::Sequential_tag`}
+  *     \cgalParamExtra{`np1` only. The meshes are always modified sequentially. With a parallel tag, the elements
+  *                     of the output may be created in a different order than with `CGAL::Sequential_tag`.}
+  *   \cgalParamNEnd
   * \cgalNamedParamsEnd
   *
   * @param nps_out an optional tuple of sequences of \ref bgl_namedparameters "Named Parameters" each among the ones listed below
@@ -459,6 +479,12 @@ corefine_and_compute_boolean_operations(
   > ::type User_visitor;
   User_visitor uv(choose_parameter<User_visitor>(get_parameter(np1, internal_np::visitor)));
 
+  typedef typename internal_np::Lookup_named_param_def <
+    internal_np::concurrency_tag_t,
+    NPIn1,
+    Sequential_tag
+  > ::type Concurrency_tag;
+
   // surface intersection algorithm call
   typedef Corefinement::Face_graph_output_builder<TriangleMesh,
                                                   VPM1,
@@ -472,7 +498,7 @@ corefine_and_compute_boolean_operations(
                                                   User_visitor> Ob;
 
   typedef Corefinement::Surface_intersection_visitor_for_corefinement<
-            TriangleMesh, VPM1, VPM2, Ob, Ecm_in, User_visitor> Algo_visitor;
+            TriangleMesh, VPM1, VPM2, Ob, Ecm_in, User_visitor, false, false, Concurrency_tag> Algo_visitor;
 
   Ecm_in ecm_in(tm1,tm2,ecm1,ecm2);
   Edge_mark_map_tuple ecms_out(ecm_out_0, ecm_out_1, ecm_out_2, ecm_out_3);
@@ -490,7 +516,7 @@ corefine_and_compute_boolean_operations(
     ob.setup_for_clipping_a_surface(use_compact_clipper);
   }
 
-  Corefinement::Intersection_of_triangle_meshes<TriangleMesh, VPM1, VPM2, Algo_visitor >
+  Corefinement::Intersection_of_triangle_meshes<TriangleMesh, VPM1, VPM2, Algo_visitor, Concurrency_tag>
     functor(tm1, tm2, vpm1, vpm2, Algo_visitor(uv,ob,ecm_in));
   functor(CGAL::Emptyset_iterator(), throw_on_self_intersection, true);
 
@@ -571,6 +597,15 @@ corefine_and_compute_boolean_operations(
   *     \cgalParamDefault{`false`}
   *     \cgalParamExtra{`np1` only}
   *   \cgalParamNEnd
+  *
+  *   \cgalParamNBegin{concurrency_tag}
+  *     \cgalParamDescription{a tag indicating if the intersections of the faces of `tm1` and `tm2` should be computed
+  *                           and the intersected faces retriangulated sequentially or in parallel}
+  *     \cgalParamType{Either `CGAL::Sequential_tag`, or `CGAL::Parallel_tag`, or `CGAL::Parallel_if_available_tag`}
+  *     \cgalParamDefault{`CGAL::Sequential_tag`}
+  *     \cgalParamExtra{`np1` only. The meshes are always modified sequentially. With a parallel tag, the elements
+  *                     of the output may be created in a different order than with `CGAL::Sequential_tag`.}
+  *   \cgalParamNEnd
   * \cgalNamedParamsEnd
   *
   * @param np_out an optional sequence of \ref bgl_namedparameters "Named Parameters" among the ones listed below
@@ -687,6 +722,135 @@ corefine_and_compute_difference(      TriangleMesh& tm1,
                                                                 [TM1_MINUS_TM2];
 }
 
+/**
+  * \ingroup PMP_corefinement_grp
+  * puts in `tm_out` a triangulated surface mesh \link coref_def_subsec bounding \endlink the union of the volumes
+  * bounded by the triangulated surface meshes of `meshes`.
+  *
+  * The union is computed by a balanced reduction: the meshes are sorted along a Hilbert curve of the centers
+  * of their bounding boxes, and the unions of consecutive meshes are computed with `corefine_and_compute_union()`
+  * level by level, so that each mesh is involved in a logarithmic number of corefinements only. The unions
+  * of a level are independent and can be computed in parallel. Meshes whose bounding boxes do not overlap
+  * are merged without being corefined.
+  *
+  * The input meshes are not modified, and the result is inserted into `tm_out` without clearing it first.
+  *
+  * \pre for each mesh `tm` of `meshes`: \link CGAL::Polygon_mesh_processing::does_self_intersect() `!CGAL::Polygon_mesh_processing::does_self_intersect(tm)` \endlink
+  * \pre for each mesh `tm` of `meshes`: \link CGAL::Polygon_mesh_processing::does_bound_a_volume() `CGAL::Polygon_mesh_processing::does_bound_a_volume(tm)` \endlink
+  *
+  * @tparam TriangleMeshRange a model of `ConstRange` with `TriangleMesh` as value type
+  * @tparam TriangleMesh a model of `HalfedgeListGraph`, `FaceListGraph`, and `MutableFaceGraph`,
+  *                      that is default constructible and copy constructible, and has an internal
+  *                      property map for `CGAL::vertex_point_t`
+  * @tparam NamedParameters a sequence of \ref bgl_namedparameters "Named Parameters"
+  *
+  * @param meshes the input triangulated surface meshes
+  * @param tm_out output surface mesh
+  * @param np an optional sequence of \ref bgl_namedparameters "Named Parameters" among the ones listed below
+  *
+  * \cgalNamedParamsBegin
+  *   \cgalParamNBegin{throw_on_self_intersection}
+  *     \cgalParamDescription{If `true`, the set of triangles close to the intersection of two meshes will be
+  *                           checked for self-intersections and `Corefinement::Self_intersection_exception`
+  *                           will be thrown if at least one self-intersection is found.}
+  *     \cgalParamType{Boolean}
+  *     \cgalParamDefault{`false`}
+  *   \cgalParamNEnd
+  *
+  *   \cgalParamNBegin{concurrency_tag}
+  *     \cgalParamDescription{a tag indicating if the unions of a level of the reduction, and each of these unions,
+  *                           should be computed sequentially or in parallel}
+  *     \cgalParamType{Either `CGAL::Sequential_tag`, or `CGAL::Parallel_tag`, or `CGAL::Parallel_if_available_tag`}
+  *     \cgalParamDefault{`CGAL::Sequential_tag`}
+  *   \cgalParamNEnd
+  * \cgalNamedParamsEnd
+  *
+  * @return `true` if the output surface mesh is manifold and is put into `tm_out`.
+  *         If `false` is returned, `tm_out` is not modified.
+  *
+  * @see `corefine_and_compute_union()`
+  */
+template <class TriangleMeshRange,
+          class TriangleMesh,
+          class NamedParameters = parameters::Default_named_parameters>
+bool
+corefine_and_compute_union_of_meshes(const TriangleMeshRange& meshes,
+                                           TriangleMesh& tm_out,
+                                     const NamedParameters& np = parameters::default_values())
+{
+  using parameters::choose_parameter;
+  using parameters::get_parameter;
+
+  typedef typename internal_np::Lookup_named_param_def <
+    internal_np::concurrency_tag_t,
+    NamedParameters,
+    Sequential_tag
+  > ::type Concurrency_tag;
+  typedef Simple_cartesian<double>::Point_3 Center;
+
+  const bool throw_on_self_intersection =
+    choose_parameter(get_parameter(np, internal_np::throw_on_self_intersection), false);
+
+  // the operands are copied as they are corefined
+  std::vector<TriangleMesh> operands;
+  for(const TriangleMesh& tm : meshes)
+    if(!is_empty(tm))
+      operands.push_back(tm);
+  const std::size_t n = operands.size();
+  if(n == 0)
+    return true;
+
+  std::vector<Bbox_3> bboxes(n);
+  std::vector<Center> centers(n);
+  for(std::size_t i=0; i<n; ++i)
+  {
+    bboxes[i] = bbox(operands[i]);
+    centers[i] = Center((bboxes[i].xmin() + bboxes[i].xmax()) / 2,
+                        (bboxes[i].ymin() + bboxes[i].ymax()) / 2,
+                        (bboxes[i].zmin() + bboxes[i].zmax()) / 2);
+  }
+
+  // consecutive operands are close to each other, so that their unions are small
+  std::vector<std::size_t> order(n);
+  for(std::size_t i=0; i<n; ++i)
+    order[i] = i;
+  hilbert_sort(order.begin(), order.end(),
+               Spatial_sort_traits_adapter_3<Simple_cartesian<double>,
+                                             typename Pointer_property_map<Center>::type>(make_property_map(centers)));
+
+  // at each level, the operand `order[i]` receives its union with the operand `order[i + step]`
+  std::vector<char> valid_union(n, true);
+  for(std::size_t step=1; step<n; step*=2)
+  {
+    const std::size_t nb_unions = (n + step - 1) / (2 * step);
+    CGAL::for_each<Concurrency_tag>(CGAL::make_counting_range<std::size_t>(0, nb_unions),
+                                    [&](const std::size_t k) -> bool
+    {
+      const std::size_t i = order[2 * step * k], j = order[2 * step * k + step];
+      if(do_overlap(bboxes[i], bboxes[j]))
+      {
+        valid_union[i] = corefine_and_compute_union(operands[i], operands[j], operands[i],
+                                                 parameters::throw_on_self_intersection(throw_on_self_intersection)
+                                                            .concurrency_tag(Concurrency_tag()));
+      }
+      else
+      {
+        // the volumes are disjoint
+        copy_face_graph(operands[j], operands[i]);
+      }
+      bboxes[i] += bboxes[j];
+      operands[j] = TriangleMesh();
+      return true;
+    });
+
+    if(std::find(valid_union.begin(), valid_union.end(), false) != valid_union.end())
+      return false;
+  }
+
+  copy_face_graph(operands[order[0]], tm_out);
+  return true;
+}
+
 /**
  * \ingroup PMP_corefinement_grp
  * \link coref_def_subsec corefines \endlink `tm1` and `tm2`. For each input
@@ -738,6 +902,15 @@ corefine_and_compute_difference(      TriangleMesh& tm1,
  *     \cgalParamDefault{`false`}
  *     \cgalParamExtra{`np1` only}
  *   \cgalParamNEnd
+ *
+ *   \cgalParamNBegin{concurrency_tag}
+ *     \cgalParamDescription{a tag indicating if the intersections of the faces of `tm1` and `tm2` should be computed
+ *                           and the intersected faces retriangulated sequentially or in parallel}
+ *     \cgalParamType{Either `CGAL::Sequential_tag`, or `CGAL::Parallel_tag`, or `CGAL::Parallel_if_available_tag`}
+ *     \cgalParamDefault{`CGAL::Sequential_tag`}
+ *     \cgalParamExtra{`np1` only. The meshes are always modified sequentially. With a parallel tag, the elements
+ *                     of the output may be created in a different order than with `CGAL::Sequential_tag`.}
+ *   \cgalParamNEnd
  *   \cgalParamNBegin{do_not_modify}
  *     \cgalParamDescription{if `true`, the corresponding mesh will not be updated.}
  *     \cgalParamType{Boolean}
@@ -827,14 +1000,20 @@ corefine(      TriangleMesh& tm1,
     !parameters::is_default_parameter<NamedParameters1, internal_np::non_manifold_feature_map_t>::value ||
     !parameters::is_default_parameter<NamedParameters2, internal_np::non_manifold_feature_map_t>::value;
 
+  typedef typename internal_np::Lookup_named_param_def <
+    internal_np::concurrency_tag_t,
+    NamedParameters1,
+    Sequential_tag
+  > ::type Concurrency_tag;
+
 // surface intersection algorithm call
   typedef Corefinement::No_extra_output_from_corefinement<TriangleMesh> Ob;
   typedef Corefinement::Surface_intersection_visitor_for_corefinement<
-  TriangleMesh, VPM1, VPM2, Ob, Ecm, User_visitor, false, handle_non_manifold_features> Algo_visitor;
+  TriangleMesh, VPM1, VPM2, Ob, Ecm, User_visitor, false, handle_non_manifold_features, Concurrency_tag> Algo_visitor;
 
   Ob ob;
   Ecm ecm(tm1,tm2,ecm1,ecm2);
-  Corefinement::Intersection_of_triangle_meshes<TriangleMesh, VPM1, VPM2, Algo_visitor>
+  Corefinement::Intersection_of_triangle_meshes<TriangleMesh, VPM1, VPM2, Algo_visitor, Concurrency_tag>
     functor(tm1, tm2, vpm1, vpm2, Algo_visitor(uv,ob,ecm,const_mesh_ptr), const_mesh_ptr);
 
   // Fill non-manifold feature maps if provided
@@ -65,6 +65,11 @@ public:
   {
     operator()(*face_box_ptr, *edge_box_ptr);
   }
+
+  bool may_intersect(const Box*, const Box*) const
+  {
+    return true;
+  }
 };
 
 template<class TriangleMesh,
@@ -152,6 +157,23 @@ public:
     edge_to_faces[edge(eh,tm_edges)].insert(face(fh, tm_faces));
   }
 
+  // returns `false` if the edge is strictly on one side of the plane of the face,
+  // in which case `operator()` does nothing. It does not modify anything and
+  // can be called concurrently.
+  bool may_intersect(const Box* face_box_ptr, const Box* edge_box_ptr) const
+  {
+    halfedge_descriptor fh = face_box_ptr->info();
+    halfedge_descriptor eh = edge_box_ptr->info();
+
+    Point a = get(vpmap_tmf, source(fh, tm_faces));
+    Point b = get(vpmap_tmf, target(fh, tm_faces));
+    Point c = get(vpmap_tmf, target(next(fh, tm_faces), tm_faces));
+
+    const Orientation abcp = orientation(a,b,c, get(vpmap_tme, target(eh, tm_edges)));
+    const Orientation abcq = orientation(a,b,c, get(vpmap_tme, source(eh, tm_edges)));
+    return abcp != abcq || abcp == COPLANAR;
+  }
+
   bool is_face_degenerated(halfedge_descriptor fh) const
   {
     Point a = get(vpmap_tmf, source(fh, tm_faces));
@@ -25,15 +25,26 @@
 #include <CGAL/Polygon_mesh_processing/internal/Corefinement/intersect_triangle_and_segment_3.h>
 #include <CGAL/Polygon_mesh_processing/Non_manifold_feature_map.h>
 #include <CGAL/Polygon_mesh_processing/bbox.h>
+#include <CGAL/for_each.h>
+#include <CGAL/Random.h>
+#include <CGAL/tags.h>
 #include <CGAL/utility.h>
 
 #include <boost/dynamic_bitset.hpp>
 #include <boost/container/flat_set.hpp>
 #include <boost/functional/hash.hpp>
 
+#ifdef CGAL_LINKED_WITH_TBB
+#include <tbb/concurrent_vector.h>
+#endif
+
+#include <algorithm>
 #include <stdexcept>
+#include <type_traits>
 #include <unordered_map>
 #include <unordered_set>
+#include <utility>
+#include <vector>
 
 namespace CGAL{
 namespace Polygon_mesh_processing {
@@ -194,7 +205,8 @@ struct Node_id_set {
 
 template< class TriangleMesh,
           class VertexPointMap1, class VertexPointMap2,
-          class Node_visitor=Default_surface_intersection_visitor<TriangleMesh>
+          class Node_visitor=Default_surface_intersection_visitor<TriangleMesh>,
+          class ConcurrencyTag=Sequential_tag
          >
 class Intersection_of_triangle_meshes
 {
@@ -242,6 +254,53 @@ class Intersection_of_triangle_meshes
   CGAL_assertion_code(bool doing_autorefinement;)
 
 // member functions
+
+  // calls `callback` on the pairs of a face box and an edge box that intersect.
+  // In parallel, the pairs for which `may_intersect` returns `true` are first collected
+  // concurrently, and `callback` is then called sequentially on them, sorted by the
+  // addresses of the boxes, so that the result does not depend on the scheduling of the threads.
+  template <class Callback, class Prefilter>
+  void box_intersection(std::vector<Box*>& face_boxes_ptr,
+                        std::vector<Box*>& edge_boxes_ptr,
+                        Callback& callback,
+                        const Prefilter& may_intersect,
+                        std::ptrdiff_t cutoff)
+  {
+#ifndef CGAL_LINKED_WITH_TBB
+    static_assert (!std::is_convertible<ConcurrencyTag, Parallel_tag>::value,
+                   "Parallel_tag is enabled but TBB is unavailable.");
+    CGAL_USE(may_intersect);
+#else
+    if (std::is_convertible<ConcurrencyTag, Parallel_tag>::value)
+    {
+      // the parallel box intersection handles subranges of roughly the same size on shuffled ranges
+      CGAL::Random rng(0);
+      CGAL::cpp98::random_shuffle(face_boxes_ptr.begin(), face_boxes_ptr.end(), rng);
+      CGAL::cpp98::random_shuffle(edge_boxes_ptr.begin(), edge_boxes_ptr.end(), rng);
+
+      typedef std::pair<const Box*, const Box*> Box_pair;
+      tbb::concurrent_vector<Box_pair> concurrent_box_pairs;
+      auto collect = [&](const Box* fb, const Box* eb)
+      {
+        if (may_intersect(fb, eb))
+          concurrent_box_pairs.emplace_back(fb, eb);
+      };
+      CGAL::box_intersection_d<ConcurrencyTag>(face_boxes_ptr.begin(), face_boxes_ptr.end(),
+                                               edge_boxes_ptr.begin(), edge_boxes_ptr.end(),
+                                               collect, cutoff);
+
+      std::vector<Box_pair> box_pairs(concurrent_box_pairs.begin(), concurrent_box_pairs.end());
+      std::sort(box_pairs.begin(), box_pairs.end());
+      for (const Box_pair& bp : box_pairs)
+        callback(bp.first, bp.second);
+      return;
+    }
+#endif
+    CGAL::box_intersection_d(face_boxes_ptr.begin(), face_boxes_ptr.end(),
+                             edge_boxes_ptr.begin(), edge_boxes_ptr.end(),
+                             callback, cutoff);
+  }
+
   template <class VPMF, class VPME>
   void filter_intersections(const TriangleMesh& tm_f,
                             const TriangleMesh& tm_e,
@@ -332,12 +391,18 @@ class Intersection_of_triangle_meshes
      Callback;
     Callback  callback(tm_f, tm_e, vpm_f, vpm_e, edge_to_faces, coplanar_faces, visitor);
     #endif
+    // pairs of boxes for which the callbacks below do nothing
+    auto may_intersect = [&callback](const Box* fb, const Box* eb)
+    {
+      return callback.may_intersect(fb, eb);
+    };
+
     //using pointers in box_intersection_d is about 10% faster
     if (throw_on_self_intersection){
         Callback_with_self_intersection_report<TriangleMesh, Callback> callback_si(callback, tm_f_faces, tm_e_faces);
-        CGAL::box_intersection_d(face_boxes_ptr.begin(), face_boxes_ptr.end(),
-                                 edge_boxes_ptr.begin(), edge_boxes_ptr.end(),
-                                 callback_si, cutoff);
+        // all the pairs are needed to collect the faces to check for self-intersections
+        box_intersection(face_boxes_ptr, edge_boxes_ptr, callback_si,
+                         [](const Box*, const Box*) { return true; }, cutoff);
         if (run_check && callback_si.self_intersections_found())
          throw Self_intersection_exception();
     }
@@ -350,9 +415,7 @@ class Intersection_of_triangle_meshes
           if (!callback.is_face_degenerated(fb->info()))
             callback(fb, eb);
         };
-        CGAL::box_intersection_d( face_boxes_ptr.begin(), face_boxes_ptr.end(),
-                                  edge_boxes_ptr.begin(), edge_boxes_ptr.end(),
-                                  filtered_callback, cutoff );
+        box_intersection(face_boxes_ptr, edge_boxes_ptr, filtered_callback, may_intersect, cutoff);
       }
       else
       {
@@ -388,14 +451,10 @@ class Intersection_of_triangle_meshes
               }
             }
           };
-          CGAL::box_intersection_d( face_boxes_ptr.begin(), face_boxes_ptr.end(),
-                                    edge_boxes_ptr.begin(), edge_boxes_ptr.end(),
-                                    filtered_callback, cutoff );
+          box_intersection(face_boxes_ptr, edge_boxes_ptr, filtered_callback, may_intersect, cutoff);
         }
         else
-          CGAL::box_intersection_d( face_boxes_ptr.begin(), face_boxes_ptr.end(),
-                                    edge_boxes_ptr.begin(), edge_boxes_ptr.end(),
-                                    callback, cutoff );
+          box_intersection(face_boxes_ptr, edge_boxes_ptr, callback, may_intersect, cutoff);
       }
     }
   }
@@ -952,8 +1011,34 @@ class Intersection_of_triangle_meshes
 
     visitor.start_handling_edge_face_intersections(tm1_edge_to_tm2_faces.size());
 
+    // In parallel, the intersection types of each edge with its faces are computed
+    // concurrently beforehand. The nodes are then created sequentially in the same order.
+    constexpr bool precompute_intersection_types = std::is_convertible<ConcurrencyTag, Parallel_tag>::value;
+    typedef std::vector<std::pair<face_descriptor, Inter_type> > Face_inter_types;
+    std::vector<Face_inter_types> inter_types;
+    if (precompute_intersection_types)
+    {
+      std::vector<typename Edge_to_faces::iterator> entries;
+      entries.reserve(tm1_edge_to_tm2_faces.size());
+      for(typename Edge_to_faces::iterator it=tm1_edge_to_tm2_faces.begin();
+                                           it!=tm1_edge_to_tm2_faces.end();++it)
+        entries.push_back(it);
+
+      inter_types.resize(entries.size());
+      CGAL::for_each<ConcurrencyTag>(CGAL::make_counting_range<std::size_t>(0, entries.size()),
+                                     [&](const std::size_t i) -> bool
+      {
+        halfedge_descriptor h_1=halfedge(entries[i]->first,tm1);
+        inter_types[i].reserve(entries[i]->second.size());
+        for(face_descriptor f_2 : entries[i]->second)
+          inter_types[i].emplace_back(f_2, intersection_type(h_1,f_2,tm1,tm2,vpm1,vpm2));
+        return true;
+      });
+    }
+
+    std::size_t entry_id=0;
     for(typename Edge_to_faces::iterator it=tm1_edge_to_tm2_faces.begin();
-                                         it!=tm1_edge_to_tm2_faces.end();++it)
+                                         it!=tm1_edge_to_tm2_faces.end();++it, ++entry_id)
     {
       visitor.edge_face_intersections_step();
       edge_descriptor e_1=it->first;
@@ -963,7 +1048,19 @@ class Intersection_of_triangle_meshes
       while (!fset.empty()){
         face_descriptor f_2=*fset.begin();
 
-        Inter_type res=intersection_type(h_1,f_2,tm1,tm2,vpm1,vpm2);
+        Inter_type res;
+        if (precompute_intersection_types)
+        {
+          // faces are only removed from `fset`, so `f_2` was there when the types were computed
+          const Face_inter_types& types=inter_types[entry_id];
+          typename Face_inter_types::const_iterator it_type =
+            std::find_if(types.begin(), types.end(),
+                         [f_2](const std::pair<face_descriptor, Inter_type>& ft) { return ft.first==f_2; });
+          CGAL_assertion(it_type!=types.end());
+          res=it_type->second;
+        }
+        else
+          res=intersection_type(h_1,f_2,tm1,tm2,vpm1,vpm2);
         Intersection_type type=std::get<0>(res);
 
     //handle degenerate case: one extremity of edge belong to f_2
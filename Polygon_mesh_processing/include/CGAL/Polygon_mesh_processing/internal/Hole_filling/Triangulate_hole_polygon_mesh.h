@@ -22,7 +22,12 @@
 #endif
 #include <CGAL/boost/graph/iterator.h>
 #include <CGAL/boost/graph/Euler_operations.h>
+#include <CGAL/tags.h>
 #include <CGAL/use.h>
+
+#include <map>
+#include <stack>
+#include <utility>
 #include <vector>
 
 namespace CGAL {
@@ -94,19 +99,85 @@ struct Tracer_polyhedron
   std::vector<halfedge_descriptor>& P;
 };
 
-// This function is used in test cases (since it returns not just OutputIterator but also Weight)
-template<class PolygonMesh, class OutputIterator, class VertexPointMap, class Kernel, class Visitor>
-std::pair<OutputIterator, CGAL::internal::Weight_min_max_dihedral_and_area>
-triangulate_hole_polygon_mesh(PolygonMesh& pmesh,
-            typename boost::graph_traits<PolygonMesh>::halfedge_descriptor border_halfedge,
-            OutputIterator out,
-            VertexPointMap vpmap,
-            bool use_delaunay_triangulation,
-            const Kernel& k,
-            const bool use_cdt,
-            const bool skip_cubic_algorithm,
-            Visitor& visitor,
-            const typename Kernel::FT max_squared_distance)
+// Tracer recording the entries of the lookup table that describe the patch,
+// so that it can be replayed later by Tracer_polyhedron
+struct Tracer_recorder
+{
+  template <class LookupTable>
+  void operator()(const LookupTable& lambda, int v0, int v1)
+  {
+    traced = true;
+    first = v0;
+    last = v1;
+
+    std::stack<std::pair<int, int> > ranges;
+    ranges.push(std::make_pair(v0, v1));
+    while(!ranges.empty())
+    {
+      std::pair<int, int> r = ranges.top();
+      ranges.pop();
+      if(r.first + 2 >= r.second) // a single edge or a single triangle
+        continue;
+
+      int la = lambda.get(r.first, r.second);
+      lambda_entries[r] = la;
+      ranges.push(std::make_pair(r.first, la));
+      ranges.push(std::make_pair(la, r.second));
+    }
+  }
+
+  int get(int i, int k) const
+  {
+    std::map<std::pair<int, int>, int>::const_iterator it = lambda_entries.find(std::make_pair(i, k));
+    CGAL_assertion(it != lambda_entries.end());
+    return it->second;
+  }
+
+  bool traced = false;
+  int first = 0, last = 0;
+  std::map<std::pair<int, int>, int> lambda_entries;
+};
+
+// The triangulation of a hole, computed without modifying the mesh.
+// Patches of holes that do not share any vertex can be computed concurrently
+// and then added one after the other to the mesh.
+template<class PolygonMesh>
+struct Hole_patch
+{
+  typedef typename boost::graph_traits<PolygonMesh>::halfedge_descriptor halfedge_descriptor;
+
+  bool is_valid() const { return tracer.traced; }
+
+  // adds the faces of the patch to `pmesh`, which must not have been modified
+  // on the boundary of the hole since the patch has been computed
+  template<class OutputIterator>
+  OutputIterator add_to(PolygonMesh& pmesh, OutputIterator out)
+  {
+    if(!is_valid())
+      return out;
+
+    Tracer_polyhedron<PolygonMesh, OutputIterator> tracer_polyhedron(out, pmesh, P_edges);
+    tracer_polyhedron(tracer, tracer.first, tracer.last);
+    return tracer_polyhedron.out;
+  }
+
+  std::vector<halfedge_descriptor> P_edges;
+  Tracer_recorder tracer;
+};
+
+template<class ConcurrencyTag = Sequential_tag,
+         class PolygonMesh, class VertexPointMap, class Kernel, class Visitor>
+CGAL::internal::Weight_min_max_dihedral_and_area
+compute_hole_patch(const PolygonMesh& pmesh,
+                   typename boost::graph_traits<PolygonMesh>::halfedge_descriptor border_halfedge,
+                   Hole_patch<PolygonMesh>& patch,
+                   VertexPointMap vpmap,
+                   bool use_delaunay_triangulation,
+                   const Kernel& k,
+                   const bool use_cdt,
+                   const bool skip_cubic_algorithm,
+                   Visitor& visitor,
+                   const typename Kernel::FT max_squared_distance)
 {
 #ifdef CGAL_HOLE_FILLING_DO_NOT_USE_CDT2
   CGAL_USE(use_cdt);
@@ -126,7 +197,7 @@ triangulate_hole_polygon_mesh(PolygonMesh& pmesh,
 #endif
 
   std::vector<Point_3> P, Q;
-  std::vector<halfedge_descriptor> P_edges;
+  std::vector<halfedge_descriptor>& P_edges = patch.P_edges;
   Vertex_map vertex_map;
 
   int id = 0;
@@ -143,7 +214,7 @@ triangulate_hole_polygon_mesh(PolygonMesh& pmesh,
 #else
       std::cerr << "W: Returning no output. Non-manifold vertex is found on boundary!\n";
 #endif
-      return std::make_pair(out, CGAL::internal::Weight_min_max_dihedral_and_area::NOT_VALID());
+      return CGAL::internal::Weight_min_max_dihedral_and_area::NOT_VALID();
     }
   } while (++circ != done);
 
@@ -189,26 +260,48 @@ triangulate_hole_polygon_mesh(PolygonMesh& pmesh,
 
   CGAL::internal::Is_valid_existing_edges_and_degenerate_triangle is_valid(existing_edges);
 
-  // fill hole using polyline function, with custom tracer for PolygonMesh
-  Tracer_polyhedron<PolygonMesh, OutputIterator> tracer(out, pmesh, P_edges);
+  // fill hole using polyline function, recording the patch to later add it to the PolygonMesh
+  Tracer_recorder& tracer = patch.tracer;
 
 #ifndef CGAL_HOLE_FILLING_DO_NOT_USE_CDT2
   if(use_cdt && triangulate_hole_polyline_with_cdt(P, tracer, visitor, is_valid, k, max_squared_distance))
-    return std::make_pair(tracer.out, CGAL::internal::Weight_min_max_dihedral_and_area(0,0));
+    return CGAL::internal::Weight_min_max_dihedral_and_area(0,0);
 #endif
   CGAL::internal::Weight_min_max_dihedral_and_area weight =
 #ifndef CGAL_USE_WEIGHT_INCOMPLETE
-  triangulate_hole_polyline(P, Q, tracer, WC(is_valid), visitor, use_delaunay_triangulation, skip_cubic_algorithm, k);
+  CGAL::internal::triangulate_hole_polyline<ConcurrencyTag>(P, Q, tracer, WC(is_valid), visitor, use_delaunay_triangulation, skip_cubic_algorithm, k);
 #else
   // get actual weight in Weight_incomplete
-  triangulate_hole_polyline(P, Q, tracer, WC(is_valid), visitor, use_delaunay_triangulation, skip_cubic_algorithm, k).weight;
+  CGAL::internal::triangulate_hole_polyline<ConcurrencyTag>(P, Q, tracer, WC(is_valid), visitor, use_delaunay_triangulation, skip_cubic_algorithm, k).weight;
 #endif
 
 #ifdef CGAL_PMP_HOLE_FILLING_DEBUG
   std::cerr << "Hole filling: " << timer.time() << " sc." << std::endl; timer.reset();
 #endif
 
-  return std::make_pair(tracer.out, weight);
+  return weight;
+}
+
+// This function is used in test cases (since it returns not just OutputIterator but also Weight)
+template<class ConcurrencyTag = Sequential_tag,
+         class PolygonMesh, class OutputIterator, class VertexPointMap, class Kernel, class Visitor>
+std::pair<OutputIterator, CGAL::internal::Weight_min_max_dihedral_and_area>
+triangulate_hole_polygon_mesh(PolygonMesh& pmesh,
+            typename boost::graph_traits<PolygonMesh>::halfedge_descriptor border_halfedge,
+            OutputIterator out,
+            VertexPointMap vpmap,
+            bool use_delaunay_triangulation,
+            const Kernel& k,
+            const bool use_cdt,
+            const bool skip_cubic_algorithm,
+            Visitor& visitor,
+            const typename Kernel::FT max_squared_distance)
+{
+  Hole_patch<PolygonMesh> patch;
+  CGAL::internal::Weight_min_max_dihedral_and_area weight =
+    compute_hole_patch<ConcurrencyTag>(pmesh, border_halfedge, patch, vpmap, use_delaunay_triangulation, k,
+                                       use_cdt, skip_cubic_algorithm, visitor, max_squared_distance);
+  return std::make_pair(patch.add_to(pmesh, out), weight);
 }
 
 } // namespace internal
@@ -40,6 +40,9 @@
 
 #include <CGAL/utility.h>
 #include <CGAL/iterator.h>
+#include <CGAL/for_each.h>
+#include <CGAL/property_map.h>
+#include <CGAL/tags.h>
 #include <CGAL/use.h>
 #include <CGAL/Kernel/global_functions_3.h>
 #include <CGAL/squared_distance_3.h>
@@ -47,6 +50,7 @@
 #include <vector>
 #include <stack>
 #include <map>
+#include <type_traits>
 #include <unordered_set>
 
 #include <CGAL/boost/iterator/transform_iterator.hpp>
@@ -738,7 +742,8 @@ template<
   class Tracer,
   class WeightCalculator,
   class Visitor,
-  template <class> class LookupTable = Lookup_table
+  template <class> class LookupTable = Lookup_table,
+  class ConcurrencyTag = Sequential_tag
 >
 class Triangulate_hole_polyline;
 
@@ -1163,7 +1168,8 @@ template<
   class Tracer,
   class WeightCalculator,
   class Visitor,
-  template <class> class LookupTable
+  template <class> class LookupTable,
+  class ConcurrencyTag
 >
 class Triangulate_hole_polyline {
 public:
@@ -1214,34 +1220,60 @@ public:
 
     const int N = s * ( -3* f * (s - 1) + s * s - 1) /6;
 
-    visitor.start_cubic_phase(N);
-    for(int j = 2; j<= range.second; ++j) {              // determines range (2 - 3 - 4 )
-      for(int i=range.first; i<= range.second-j; ++i) {  // iterates over ranges and find min triangulation in those ranges
-        int k = i+j;                                     // like [0-2, 1-3, 2-4, ...], [0-3, 1-4, 2-5, ...]
+    // The ranges of a given size only depend on smaller ranges, so they can be processed in parallel,
+    // provided that the lookup tables can be written concurrently at different entries
+    constexpr bool parallel_execution = std::is_convertible<ConcurrencyTag, Parallel_tag>::value &&
+                                        std::is_same<LookupTable<int>, Lookup_table<int> >::value;
+    const int parallel_cutoff = 100;
 
-        int m_min = -1;
-        Weight w_min = Weight::NOT_VALID();
-        // i is the range start (e.g. 1) k is the range end (e.g. 5) -> [1-5]. Now subdivide the region [1-5] with m -> 2,3,4
-        for(int m = i+1; m<k; ++m) {
+    // the optimal triangulation of the range [i-k]
+    auto triangulate_range = [&](int i, int k, bool report_steps)
+    {
+      int m_min = -1;
+      Weight w_min = Weight::NOT_VALID();
+      // i is the range start (e.g. 1) k is the range end (e.g. 5) -> [1-5]. Now subdivide the region [1-5] with m -> 2,3,4
+      for(int m = i+1; m<k; ++m) {
+        if(report_steps)
           visitor.cubic_step();
-          // now the regions i-m and m-k might be valid(constructed) patches,
-          if( W.get(i,m) == Weight::NOT_VALID() || W.get(m,k) == Weight::NOT_VALID() )
-          { continue; }
-
-          const Weight& w_imk = WC(P,Q,i,m,k, lambda);
-          if(w_imk == Weight::NOT_VALID())
-          { continue; }
-
-          const Weight& w = W.get(i,m) + W.get(m,k) + w_imk;
-          if(m_min == -1 || w < w_min) {
-            w_min = w;
-            m_min = m;
-          }
+        // now the regions i-m and m-k might be valid(constructed) patches,
+        if( W.get(i,m) == Weight::NOT_VALID() || W.get(m,k) == Weight::NOT_VALID() )
+        { continue; }
+
+        const Weight& w_imk = WC(P,Q,i,m,k, lambda);
+        if(w_imk == Weight::NOT_VALID())
+        { continue; }
+
+        const Weight& w = W.get(i,m) + W.get(m,k) + w_imk;
+        if(m_min == -1 || w < w_min) {
+          w_min = w;
+          m_min = m;
         }
+      }
+
+      // can be m_min = -1 and w_min = NOT_VALID which means no possible triangulation between i-k
+      W.put(i,k,w_min);
+      lambda.put(i,k, m_min);
+    };
 
-        // can be m_min = -1 and w_min = NOT_VALID which means no possible triangulation between i-k
-        W.put(i,k,w_min);
-        lambda.put(i,k, m_min);
+    visitor.start_cubic_phase(N);
+    for(int j = 2; j<= range.second; ++j) {              // determines range (2 - 3 - 4 )
+      if(parallel_execution && range.second - range.first >= parallel_cutoff && range.first <= range.second-j)
+      {
+        CGAL::for_each<ConcurrencyTag>(CGAL::make_counting_range<int>(range.first, range.second-j+1),
+                                       [&](int i) -> bool
+                                       {
+                                         triangulate_range(i, i+j, false);
+                                         return true;
+                                       });
+        // the visitor is not required to be thread-safe
+        for(int i=range.first; i<= range.second-j; ++i)
+          for(int m = i+1; m<i+j; ++m)
+            visitor.cubic_step();
+        continue;
+      }
+
+      for(int i=range.first; i<= range.second-j; ++i) {  // iterates over ranges and find min triangulation in those ranges
+        triangulate_range(i, i+j, true);                 // like [0-2, 1-3, 2-4, ...], [0-3, 1-4, 2-5, ...]
       }
     }
     visitor.end_cubic_phase();
@@ -1525,6 +1557,7 @@ triangulate_hole_polyline_with_cdt(const PointRange& points,
  * Internal entry point for both polyline and Polyhedron_3 triangulation functions
  ***********************************************************************************/
 template <
+  typename ConcurrencyTag = Sequential_tag,
   typename PointRange1,
   typename PointRange2,
   typename Tracer,
@@ -1553,7 +1586,8 @@ triangulate_hole_polyline(const PointRange1& points,
 #else
   CGAL_USE(use_delaunay_triangulation);
 #endif
-  typedef CGAL::internal::Triangulate_hole_polyline<K, Tracer, WeightCalculator, Visitor>    Fill;
+  typedef CGAL::internal::Triangulate_hole_polyline<K, Tracer, WeightCalculator, Visitor,
+                                                    Lookup_table, ConcurrencyTag>           Fill;
 
   std::vector<Point_3> P(std::begin(points), std::end(points));
   std::vector<Point_3> Q(std::begin(third_points), std::end(third_points));
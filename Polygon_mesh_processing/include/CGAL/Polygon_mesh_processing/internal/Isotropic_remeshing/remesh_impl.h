@@ -31,6 +31,7 @@
 #include <CGAL/property_map.h>
 #include <CGAL/Dynamic_property_map.h>
 #include <CGAL/iterator.h>
+#include <CGAL/for_each.h>
 #include <CGAL/boost/graph/Euler_operations.h>
 #include <CGAL/boost/graph/properties.h>
 #include <boost/graph/graph_traits.hpp>
@@ -1014,11 +1015,12 @@ namespace internal {
     // "applies an iterative smoothing filter to the mesh.
     // The vertex movement has to be constrained to the vertex tangent plane [...]
     // smoothing algorithm with uniform Laplacian weights"
-    template <class SizingFunction, typename AllowMoveFunctor>
+    template <class SizingFunction, typename AllowMoveFunctor, typename ConcurrencyTag = Sequential_tag>
     void tangential_relaxation_impl(const bool relax_constraints/*1d smoothing*/
                                   , const unsigned int nb_iterations
                                   , const SizingFunction& sizing
-                                  , const AllowMoveFunctor& shall_move)
+                                  , const AllowMoveFunctor& shall_move
+                                  , ConcurrencyTag = ConcurrencyTag())
     {
 #ifdef CGAL_PMP_REMESHING_VERBOSE
       std::cout << "Tangential relaxation (" << nb_iterations << " iter.)...";
@@ -1057,6 +1059,7 @@ namespace internal {
             .vertex_is_constrained_map(constrained_vertices_pmap)
             .relax_constraints(relax_constraints)
             .allow_move_functor(shall_move)
+            .concurrency_tag(ConcurrencyTag())
         );
       }
       else
@@ -1076,6 +1079,7 @@ namespace internal {
             .relax_constraints(relax_constraints)
             .sizing_function(sizing)
             .allow_move_functor(shall_move)
+            .concurrency_tag(ConcurrencyTag())
         );
       }
 
@@ -1094,7 +1098,8 @@ namespace internal {
 
     // PMP book :
     // "maps the vertices back to the surface"
-    void project_to_surface(internal_np::Param_not_found)
+    template <typename ConcurrencyTag = Sequential_tag>
+    void project_to_surface(internal_np::Param_not_found, ConcurrencyTag = ConcurrencyTag())
     {
       //todo : handle the case of boundary vertices
 #ifdef CGAL_PMP_REMESHING_VERBOSE
@@ -1102,15 +1107,21 @@ namespace internal {
       std::cout.flush();
 #endif
 
-      for(vertex_descriptor v : vertices(mesh_))
+      if constexpr (std::is_convertible<ConcurrencyTag, Parallel_tag>::value)
       {
-        if (is_constrained(v) || is_isolated(v) || !is_on_patch(v))
-          continue;
-        //note if v is constrained, it has not moved
+        // the trees are queried concurrently, their internal search structures must exist beforehand
+        for(AABB_tree* tree : trees)
+          tree->accelerate_distance_queries();
+      }
 
-        Point proj = trees[patch_id_to_index_map[get_patch_id(face(halfedge(v, mesh_), mesh_))]]->closest_point(get(vpmap_, v));
+      for_each_vertex_to_project<ConcurrencyTag>([&](vertex_descriptor v)
+      {
+        // the map is not modified as it is read concurrently, an unknown patch uses the first tree
+        const auto pid = patch_id_to_index_map.find(get_patch_id(face(halfedge(v, mesh_), mesh_)));
+        const std::size_t tree_id = (pid == patch_id_to_index_map.end()) ? 0 : pid->second;
+        Point proj = trees[tree_id]->closest_point(get(vpmap_, v));
         put(vpmap_, v, proj);
-      }
+      });
       CGAL_assertion(!input_mesh_is_valid_ || is_valid_polygon_mesh(mesh_));
 #ifdef CGAL_PMP_REMESHING_DEBUG
       debug_self_intersections();
@@ -1124,21 +1135,18 @@ namespace internal {
 #endif
     }
 
-    template <class ProjectionFunctor>
-    void project_to_surface(const ProjectionFunctor& proj)
+    template <class ProjectionFunctor, typename ConcurrencyTag = Sequential_tag>
+    void project_to_surface(const ProjectionFunctor& proj, ConcurrencyTag = ConcurrencyTag())
     {
       //todo : handle the case of boundary vertices
 #ifdef CGAL_PMP_REMESHING_VERBOSE
       std::cout << "Project to surface...";
       std::cout.flush();
 #endif
-      for(vertex_descriptor v : vertices(mesh_))
+      for_each_vertex_to_project<ConcurrencyTag>([&](vertex_descriptor v)
       {
-        if (is_constrained(v) || is_isolated(v) || !is_on_patch(v))
-          continue;
-        //note if v is constrained, it has not moved
         put(vpmap_, v,  proj(v));
-      }
+      });
       CGAL_assertion(is_valid(mesh_));
 #ifdef CGAL_PMP_REMESHING_DEBUG
       debug_self_intersections();
@@ -1153,6 +1161,27 @@ namespace internal {
     }
 
 private:
+  // applies `f` to the vertices moved by the projection, possibly in parallel
+  template <typename ConcurrencyTag, typename Function>
+  void for_each_vertex_to_project(const Function& f) const
+  {
+    std::vector<vertex_descriptor> to_project;
+    for(vertex_descriptor v : vertices(mesh_))
+    {
+      if (is_constrained(v) || is_isolated(v) || !is_on_patch(v))
+        continue;
+      //note if v is constrained, it has not moved
+      to_project.push_back(v);
+    }
+
+    CGAL::for_each<ConcurrencyTag>(to_project,
+                                   [&](vertex_descriptor v) -> bool
+                                   {
+                                     f(v);
+                                     return true;
+                                   });
+  }
+
   Patch_id get_patch_id(const face_descriptor& f) const
   {
     if (f == boost::graph_traits<PM>::null_face())
@@ -20,13 +20,17 @@
 #include <CGAL/Polygon_mesh_processing/compute_normal.h>
 #include <CGAL/Polygon_mesh_processing/measure.h>
 #include <CGAL/Named_function_parameters.h>
+#include <CGAL/for_each.h>
 #include <CGAL/property_map.h>
+#include <CGAL/tags.h>
 #include <CGAL/boost/graph/named_params_helper.h>
 #include <Eigen/Eigenvalues>
 
 #include <numeric>
 #include <queue>
+#include <type_traits>
 #include <unordered_set>
+#include <vector>
 
 namespace CGAL {
 
@@ -717,6 +721,10 @@ class Interpolated_corrected_curvatures_computer
 
   typedef typename GetVertexPointMap<PolygonMesh, NamedParameters>::const_type Vertex_position_map;
 
+  typedef typename internal_np::Lookup_named_param_def<internal_np::concurrency_tag_t,
+    NamedParameters,
+    Sequential_tag>::type Concurrency_tag;
+
   typedef dynamic_vertex_property_t<Vector_3> Vector_map_tag;
   typedef typename boost::property_map<PolygonMesh, Vector_map_tag>::const_type Default_vector_map;
   typedef typename internal_np::Lookup_named_param_def<internal_np::vertex_normal_map_t,
@@ -765,6 +773,18 @@ private:
     mu1_map = get(CGAL::dynamic_face_property_t<FT>(), pmesh);
     mu2_map = get(CGAL::dynamic_face_property_t<FT>(), pmesh);
     muXY_map = get(CGAL::dynamic_face_property_t<std::array<FT, 3 * 3>>(), pmesh);
+
+    // the keys of the maps, which might be hash maps, must all exist before the concurrent writes
+    if (std::is_convertible<Concurrency_tag, Parallel_tag>::value)
+    {
+      for (face_descriptor f : faces(pmesh))
+      {
+        put(mu0_map, f, FT(0));
+        put(mu1_map, f, FT(0));
+        put(mu2_map, f, FT(0));
+        put(muXY_map, f, std::array<FT, 3 * 3>());
+      }
+    }
   }
 
   void set_named_params(const NamedParameters& np)
@@ -781,7 +801,13 @@ private:
 
     // if no normal map is given, compute normals
     if (is_default_parameter<NamedParameters, internal_np::vertex_normal_map_t>::value)
+    {
+      if (std::is_convertible<Concurrency_tag, Parallel_tag>::value)
+        for (vertex_descriptor v : vertices(pmesh))
+          put(vnm, v, NULL_VECTOR);
+
       compute_vertex_normals(pmesh, vnm, np);
+    }
 
     // if no radius is given, we pass -1 which will make the expansion be only on the incident faces instead of a ball
     const FT radius = choose_parameter(get_parameter(np, internal_np::ball_radius), -1);
@@ -823,37 +849,56 @@ public:
 
 private:
 
+  // Computes the (selected) interpolated corrected measures of f
+  // and stores them in the property maps, x and u being buffers for its points and normals
+  void interpolated_corrected_selected_measures_face(face_descriptor f,
+                                                     std::vector<Vector_3>& x,
+                                                     std::vector<Vector_3>& u)
+  {
+    x.clear();
+    u.clear();
+    for (vertex_descriptor v : vertices_around_face(halfedge(f, pmesh), pmesh))
+    {
+      const Point_3& p = get(vpm, v);
+      x.push_back(Vector_3(p.x(), p.y(), p.z()));
+      u.push_back(get(vnm, v));
+    }
+    put(mu0_map, f, interpolated_corrected_area_measure_face<GT>(u, x));
+
+    if (is_mean_curvature_selected)
+      put(mu1_map, f, interpolated_corrected_mean_curvature_measure_face<GT>(u, x));
+
+    if (is_Gaussian_curvature_selected)
+      put(mu2_map, f, interpolated_corrected_Gaussian_curvature_measure_face<GT>(u));
+
+    if (is_principal_curvatures_and_directions_selected)
+      put(muXY_map, f, interpolated_corrected_anisotropic_measure_face<GT>(u, x));
+  }
+
   // Computes the (selected) interpolated corrected measures for all faces
   // and stores them in the property maps
   void interpolated_corrected_selected_measures_all_faces()
   {
-    std::vector<Vector_3> x;
-    std::vector<Vector_3> u;
-    // minimal number of vertices per face is 3
-    x.reserve(3);
-    u.reserve(3);
-
-    for (face_descriptor f : faces(pmesh))
+    if (std::is_convertible<Concurrency_tag, Parallel_tag>::value)
     {
-      for (vertex_descriptor v : vertices_around_face(halfedge(f, pmesh), pmesh))
+      // in parallel, the buffers are local to each face
+      CGAL::for_each<Concurrency_tag>(faces(pmesh), [&](face_descriptor f) -> bool
       {
-        const Point_3& p = get(vpm, v);
-        x.push_back(Vector_3(p.x(), p.y(), p.z()));
-        u.push_back(get(vnm, v));
-      }
-      put(mu0_map, f, interpolated_corrected_area_measure_face<GT>(u, x));
-
-      if (is_mean_curvature_selected)
-        put(mu1_map, f, interpolated_corrected_mean_curvature_measure_face<GT>(u, x));
-
-      if (is_Gaussian_curvature_selected)
-        put(mu2_map, f, interpolated_corrected_Gaussian_curvature_measure_face<GT>(u));
-
-      if (is_principal_curvatures_and_directions_selected)
-        put(muXY_map, f, interpolated_corrected_anisotropic_measure_face<GT>(u, x));
+        std::vector<Vector_3> x, u;
+        interpolated_corrected_selected_measures_face(f, x, u);
+        return true;
+      });
+    }
+    else
+    {
+      std::vector<Vector_3> x;
+      std::vector<Vector_3> u;
+      // minimal number of vertices per face is 3
+      x.reserve(3);
+      u.reserve(3);
 
-      x.clear();
-      u.clear();
+      for (face_descriptor f : faces(pmesh))
+        interpolated_corrected_selected_measures_face(f, x, u);
     }
   }
 
@@ -957,7 +1002,7 @@ private:
   void compute_selected_curvatures() {
     interpolated_corrected_selected_measures_all_faces();
 
-    for (vertex_descriptor v : vertices(pmesh))
+    CGAL::for_each<Concurrency_tag>(vertices(pmesh), [&](vertex_descriptor v) -> bool
     {
       // expand the computed measures (on faces) to the vertices
       Vertex_measures<GT> vertex_measures = (is_negative(ball_radius)) ?
@@ -989,7 +1034,9 @@ private:
           );
         put(principal_curvatures_and_directions_map, v, principal_curvatures_and_directions);
       }
-    }
+
+      return true;
+    });
   }
 };
 
@@ -1075,6 +1122,16 @@ private:
 *     \cgalParamExtra{The geometric traits class must be compatible with the vertex point type.}
 *   \cgalParamNEnd
 *
+*   \cgalParamNBegin{concurrency_tag}
+*     \cgalParamDescription{a tag indicating if the measures of the faces and the curvatures of the vertices,
+*                           as well as the vertex normals if they are not provided,
+*                           should be computed sequentially or in parallel}
+*     \cgalParamType{Either `CGAL::Sequential_tag`, or `CGAL::Parallel_tag`, or `CGAL::Parallel_if_available_tag`}
+*     \cgalParamDefault{`CGAL::Sequential_tag`}
+*     \cgalParamExtra{In parallel, the curvature property maps must support concurrent writes
+*                     of the values of different vertices.}
+*   \cgalParamNEnd
+*
 * \cgalNamedParamsEnd
 *
 */
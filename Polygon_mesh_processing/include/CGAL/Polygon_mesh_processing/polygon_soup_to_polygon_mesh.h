@@ -22,8 +22,10 @@
 #include <CGAL/boost/graph/iterator.h>
 #include <CGAL/boost/graph/named_params_helper.h>
 #include <CGAL/boost/graph/internal/helpers.h>
+#include <CGAL/boost/graph/internal/add_polygons_with_edge_table.h>
 #include <CGAL/Dynamic_property_map.h>
 #include <CGAL/property_map.h>
+#include <CGAL/tags.h>
 
 #include <boost/dynamic_bitset.hpp>
 #include <boost/range/size.hpp>
@@ -68,7 +70,8 @@ struct Polygon_and_Point_id_helper<OutputIterator, void>
 
 template <typename PointRange,
           typename PolygonRange,
-          typename PointMap = typename CGAL::GetPointMap<PointRange>::const_type>
+          typename PointMap = typename CGAL::GetPointMap<PointRange>::const_type,
+          typename ConcurrencyTag = CGAL::Sequential_tag>
 class PS_to_PM_converter
 {
   typedef typename boost::range_value<PolygonRange>::type                 Polygon;
@@ -97,6 +100,7 @@ public:
                   const bool insert_isolated_vertices = true)
   {
     typedef typename boost::graph_traits<PolygonMesh>::vertex_descriptor    vertex_descriptor;
+    typedef typename boost::graph_traits<PolygonMesh>::face_descriptor      face_descriptor;
     typedef typename boost::property_traits<VertexPointMap>::value_type     PM_Point;
 
     typedef typename Polygon_and_Point_id_helper<V2V>::type Point_id;
@@ -131,6 +135,18 @@ public:
       *i2v++ = std::make_pair(i, vertices[i]);
     }
 
+    // the connectivity is built at once from a table of the halfedges of the polygons
+    if(std::is_convertible<ConcurrencyTag, CGAL::Parallel_tag>::value)
+    {
+      std::vector<face_descriptor> faces;
+      if(CGAL::internal::add_polygons_with_edge_table<ConcurrencyTag>(m_polygons, vertices, pmesh, faces))
+      {
+        for(Polygon_id i = 0, end = static_cast<Polygon_id>(m_polygons.size()); i < end; ++i)
+          *i2f++ = std::make_pair(i, faces[i]);
+        return;
+      }
+    }
+
     for(Polygon_id i = 0, end = static_cast<Polygon_id>(m_polygons.size()); i < end; ++i)
     {
       const Polygon& polygon = m_polygons[i];
@@ -141,7 +157,7 @@ public:
       for(std::size_t j = 0; j < size; ++j)
         vr[j] = vertices[polygon[j] ];
 
-      typename boost::graph_traits<PolygonMesh>::face_descriptor fd = CGAL::Euler::add_face(vr, pmesh);
+      face_descriptor fd = CGAL::Euler::add_face(vr, pmesh);
       CGAL_postcondition(is_valid_face_descriptor(fd, pmesh));
       *i2f++ = std::make_pair(i, fd);
     }
@@ -305,6 +321,16 @@ bool is_polygon_soup_a_polygon_mesh(const PolygonRange& polygons)
 *   \cgalParamDefault{unused}
 * \cgalParamNEnd
 *
+*  \cgalParamNBegin{concurrency_tag}
+*   \cgalParamDescription{a tag indicating if the connectivity of `out` should be built using one or several threads}
+*   \cgalParamType{Either `CGAL::Sequential_tag`, or `CGAL::Parallel_tag`, or `CGAL::Parallel_if_available_tag`}
+*   \cgalParamDefault{`CGAL::Sequential_tag`}
+*   \cgalParamExtra{If `CGAL::Parallel_tag` is used, all the halfedges of the polygons are sorted at once
+*                   to pair the opposite halfedges, instead of adding the faces one by one.
+*                   The connectivity of each element of `out` is then set independently, so
+*                   `PolygonMesh` must support the concurrent modification of different elements.}
+* \cgalParamNEnd
+*
 * \cgalNamedParamsEnd
 *
 * @param np_pm an optional sequence of \ref bgl_namedparameters "Named Parameters" among the ones listed below
@@ -346,7 +372,11 @@ void polygon_soup_to_polygon_mesh(const PointRange& points,
   Vertex_point_map vpm = choose_parameter(get_parameter(np_pm, internal_np::vertex_point),
                                           get_property_map(CGAL::vertex_point, out));
 
-  internal::PS_to_PM_converter<PointRange, PolygonRange, Point_map> converter(points, polygons, pm);
+  typedef typename internal_np::Lookup_named_param_def<internal_np::concurrency_tag_t,
+                                                       NamedParameters_PS,
+                                                       Sequential_tag>::type Concurrency_tag;
+
+  internal::PS_to_PM_converter<PointRange, PolygonRange, Point_map, Concurrency_tag> converter(points, polygons, pm);
   converter(out, vpm,
     choose_parameter(get_parameter(np_ps, internal_np::point_to_vertex_output_iterator),
                      impl::make_functor(get_parameter(np_ps, internal_np::point_to_vertex_map))),
@@ -193,6 +193,17 @@ namespace Polygon_mesh_processing {
 *                    of the vertex point map.}
 *     \cgalParamDefault{If not provided, vertices are projected on the input surface mesh.}
 *   \cgalParamNEnd
+*
+*   \cgalParamNBegin{concurrency_tag}
+*     \cgalParamDescription{a tag indicating if the tangential relaxation and the projection steps
+*                           should be performed sequentially or in parallel}
+*     \cgalParamType{Either `CGAL::Sequential_tag`, or `CGAL::Parallel_tag`, or `CGAL::Parallel_if_available_tag`}
+*     \cgalParamDefault{`CGAL::Sequential_tag`}
+*     \cgalParamExtra{The edge splits, collapses and flips, which modify the connectivity of the mesh,
+*                     are always performed sequentially.}
+*     \cgalParamExtra{In parallel, `allow_move_functor` and `projection_functor` must be safe to call
+*                     from several threads.}
+*   \cgalParamNEnd
 * \cgalNamedParamsEnd
 *
 * @sa `split_long_edges()`
@@ -281,6 +292,12 @@ void isotropic_remeshing(const FaceRange& faces
   auto shall_move = choose_parameter(get_parameter(np, internal_np::allow_move_functor),
                                      internal::Allow_all_moves());
 
+  typedef typename internal_np::Lookup_named_param_def <
+      internal_np::concurrency_tag_t,
+      NamedParameters,
+      Sequential_tag
+    > ::type Concurrency_tag;
+
 #if !defined(CGAL_NO_PRECONDITIONS)
   if(protect)
   {
@@ -336,9 +353,9 @@ void isotropic_remeshing(const FaceRange& faces
      remesher.collapse_short_edges(sizing, collapse_constraints);
     if(do_flip)
       remesher.flip_edges_for_valence_and_shape();
-    remesher.tangential_relaxation_impl(smoothing_1d, nb_laplacian, sizing, shall_move);
+    remesher.tangential_relaxation_impl(smoothing_1d, nb_laplacian, sizing, shall_move, Concurrency_tag());
     if ( choose_parameter(get_parameter(np, internal_np::do_project), true) )
-      remesher.project_to_surface(get_parameter(np, internal_np::projection_functor));
+      remesher.project_to_surface(get_parameter(np, internal_np::projection_functor), Concurrency_tag());
 #ifdef CGAL_PMP_REMESHING_VERBOSE
     std::cout << std::endl;
 #endif
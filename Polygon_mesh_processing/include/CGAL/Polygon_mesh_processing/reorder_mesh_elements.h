@@ -0,0 +1,207 @@
+// Copyright (c) 2026 GeometryFactory (France).
+// All rights reserved.
+//
+// This file is part of CGAL (www.cgal.org).
+//
+// $URL$
+// $Id$
+// SPDX-License-Identifier: GPL-3.0-or-later OR LicenseRef-Commercial
+//
+//
+// Author(s)     : GeometryFactory
+
+#ifndef CGAL_POLYGON_MESH_PROCESSING_REORDER_MESH_ELEMENTS_H
+#define CGAL_POLYGON_MESH_PROCESSING_REORDER_MESH_ELEMENTS_H
+
+#include <CGAL/license/Polygon_mesh_processing/miscellaneous.h>
+
+#include <CGAL/Surface_mesh/Surface_mesh.h>
+#include <CGAL/Named_function_parameters.h>
+#include <CGAL/boost/graph/named_params_helper.h>
+#include <CGAL/hilbert_sort.h>
+#include <CGAL/Spatial_sort_traits_adapter_3.h>
+#include <CGAL/tags.h>
+
+#include <algorithm>
+#include <vector>
+
+namespace CGAL {
+namespace Polygon_mesh_processing {
+
+/*!
+ * \ingroup PkgPolygonMeshProcessingRef
+ *
+ * Orders in which `reorder_mesh_elements()` can put the vertices of a surface mesh.
+ */
+enum Element_order {
+  HILBERT_ORDER = 0,           ///< The vertices are sorted along a Hilbert curve of their points.
+  REVERSE_CUTHILL_MCKEE_ORDER  ///< The vertices are sorted with the reverse Cuthill-McKee algorithm,
+                               ///< which only depends on the connectivity of the mesh.
+};
+
+namespace internal {
+
+// puts in `order` the vertices of `sm` in the reverse Cuthill-McKee order: each connected component
+// is traversed breadth-first from one of its vertices of minimal degree, the neighbors of a vertex
+// being visited by increasing degree, and the whole order is then reversed
+template <typename Point>
+void reverse_cuthill_mckee_order(const Surface_mesh<Point>& sm,
+                                 std::vector<typename Surface_mesh<Point>::Vertex_index>& order)
+{
+  typedef typename Surface_mesh<Point>::Vertex_index                       vertex_descriptor;
+  typedef typename Surface_mesh<Point>::Halfedge_index                     halfedge_descriptor;
+
+  std::vector<std::size_t> degrees(sm.num_vertices(), 0);
+  std::size_t max_degree = 0;
+  for(vertex_descriptor v : sm.vertices())
+  {
+    if(!sm.is_isolated(v))
+      degrees[v] = sm.degree(v);
+    max_degree = (std::max)(max_degree, degrees[v]);
+  }
+
+  // the vertices by increasing degree, to choose where to start the traversal of each component
+  std::vector<std::size_t> offsets(max_degree + 2, 0);
+  for(vertex_descriptor v : sm.vertices())
+    ++offsets[degrees[v] + 1];
+  for(std::size_t d=0; d<=max_degree; ++d)
+    offsets[d + 1] += offsets[d];
+  std::vector<vertex_descriptor> by_degree(sm.number_of_vertices());
+  for(vertex_descriptor v : sm.vertices())
+    by_degree[offsets[degrees[v]]++] = v;
+
+  order.clear();
+  order.reserve(sm.number_of_vertices());
+  std::vector<bool> visited(sm.num_vertices(), false);
+  std::vector<vertex_descriptor> neighbors;
+  for(vertex_descriptor start : by_degree)
+  {
+    if(visited[start])
+      continue;
+    visited[start] = true;
+    order.push_back(start);
+
+    // `order` is the queue of the breadth-first traversal
+    for(std::size_t i=order.size()-1; i<order.size(); ++i)
+    {
+      const vertex_descriptor v = order[i];
+      if(sm.is_isolated(v))
+        continue;
+
+      neighbors.clear();
+      const halfedge_descriptor h0 = sm.halfedge(v);
+      halfedge_descriptor h = h0;
+      do
+      {
+        const vertex_descriptor w = sm.source(h);
+        if(!visited[w])
+        {
+          visited[w] = true;
+          neighbors.push_back(w);
+        }
+        h = sm.prev_around_target(h);
+      }
+      while(h != h0);
+
+      std::stable_sort(neighbors.begin(), neighbors.end(),
+                       [&](const vertex_descriptor a, const vertex_descriptor b) { return degrees[a] < degrees[b]; });
+      order.insert(order.end(), neighbors.begin(), neighbors.end());
+    }
+  }
+  std::reverse(order.begin(), order.end());
+}
+
+} // namespace internal
+
+/*!
+ * \ingroup PkgPolygonMeshProcessingRef
+ *
+ * reorders the vertices, halfedges, edges, and faces of a surface mesh, so that elements which are
+ * close on the surface are likely to be close in memory. The traversals of the mesh, as done for
+ * example by `compute_vertex_normals()` or `interpolated_corrected_curvatures()`, are then faster.
+ *
+ * The vertices are sorted as specified by the named parameter `element_order`, the edges and faces
+ * being then sorted by their first vertex. The elements marked as removed are removed as
+ * `Surface_mesh::collect_garbage()` does, and all the properties of the mesh are reordered with their elements.
+ *
+ * @tparam Point the point type of the surface mesh
+ * @tparam NamedParameters a sequence of \ref bgl_namedparameters "Named Parameters"
+ *
+ * @param sm the surface mesh to reorder
+ * @param np an optional sequence of \ref bgl_namedparameters "Named Parameters" among the ones listed below
+ *
+ * \cgalNamedParamsBegin
+ *   \cgalParamNBegin{element_order}
+ *     \cgalParamDescription{the order in which the vertices are put}
+ *     \cgalParamType{`CGAL::Polygon_mesh_processing::Element_order`}
+ *     \cgalParamDefault{`CGAL::Polygon_mesh_processing::HILBERT_ORDER`}
+ *   \cgalParamNEnd
+ *
+ *   \cgalParamNBegin{vertex_point_map}
+ *     \cgalParamDescription{a property map associating points to the vertices of `sm`}
+ *     \cgalParamType{a class model of `ReadablePropertyMap` with `Surface_mesh<Point>::Vertex_index`
+ *                    as key type and `%Point_3` as value type}
+ *     \cgalParamDefault{`boost::get(CGAL::vertex_point, sm)`}
+ *     \cgalParamExtra{It is only used with `HILBERT_ORDER`.}
+ *   \cgalParamNEnd
+ *
+ *   \cgalParamNBegin{geom_traits}
+ *     \cgalParamDescription{an instance of a geometric traits class}
+ *     \cgalParamType{a class model of `SpatialSortingTraits_3`}
+ *     \cgalParamDefault{a \cgal Kernel deduced from the point type, using `CGAL::Kernel_traits`}
+ *     \cgalParamExtra{It is only used with `HILBERT_ORDER`.}
+ *   \cgalParamNEnd
+ *
+ *   \cgalParamNBegin{concurrency_tag}
+ *     \cgalParamDescription{a tag indicating if the elements should be sorted and moved sequentially or in parallel}
+ *     \cgalParamType{Either `CGAL::Sequential_tag`, or `CGAL::Parallel_tag`, or `CGAL::Parallel_if_available_tag`}
+ *     \cgalParamDefault{`CGAL::Sequential_tag`}
+ *     \cgalParamExtra{The reverse Cuthill-McKee order is always computed sequentially.}
+ *   \cgalParamNEnd
+ * \cgalNamedParamsEnd
+ *
+ * \attention By reordering elements get new indices.
+ * In case you store indices in an auxiliary data structure
+ * or in a property these indices are potentially no longer
+ * referring to the right elements.
+ */
+template <typename Point, typename NamedParameters = parameters::Default_named_parameters>
+void reorder_mesh_elements(Surface_mesh<Point>& sm,
+                           const NamedParameters& np = parameters::default_values())
+{
+  using parameters::choose_parameter;
+  using parameters::get_parameter;
+
+  typedef Surface_mesh<Point>                                               Mesh;
+  typedef typename Mesh::Vertex_index                                       vertex_descriptor;
+  typedef typename GetGeomTraits<Mesh, NamedParameters>::type               GT;
+  typedef typename GetVertexPointMap<Mesh, NamedParameters>::const_type     VPM;
+  typedef typename internal_np::Lookup_named_param_def<internal_np::concurrency_tag_t,
+                                                       NamedParameters,
+                                                       Sequential_tag>::type Concurrency_tag;
+
+  const Element_order element_order = choose_parameter(get_parameter(np, internal_np::element_order), HILBERT_ORDER);
+
+  std::vector<vertex_descriptor> order;
+  if(element_order == HILBERT_ORDER)
+  {
+    VPM vpm = choose_parameter(get_parameter(np, internal_np::vertex_point),
+                               get_const_property_map(vertex_point, sm));
+    GT gt = choose_parameter<GT>(get_parameter(np, internal_np::geom_traits));
+
+    order.assign(sm.vertices().begin(), sm.vertices().end());
+    hilbert_sort<Concurrency_tag>(order.begin(), order.end(), Spatial_sort_traits_adapter_3<GT, VPM>(vpm, gt));
+  }
+  else
+  {
+    internal::reverse_cuthill_mckee_order(sm, order);
+  }
+
+  collect_garbage_internal::Dummy_visitor visitor;
+  sm.template collect_garbage<Concurrency_tag>(visitor, order);
+}
+
+} // namespace Polygon_mesh_processing
+} // namespace CGAL
+
+#endif // CGAL_POLYGON_MESH_PROCESSING_REORDER_MESH_ELEMENTS_H
@@ -26,6 +26,7 @@
 
 #include <CGAL/algorithm.h>
 #include <CGAL/Bbox_3.h>
+#include <CGAL/Default.h>
 #include <CGAL/boost/graph/helpers.h>
 #include <CGAL/boost/graph/properties.h>
 #include <CGAL/box_intersection_d.h>
@@ -45,10 +46,13 @@
 #include <boost/iterator/function_output_iterator.hpp>
 #include <boost/range/irange.hpp>
 
+#include <algorithm>
 #include <exception>
 #include <sstream>
 #include <type_traits>
 #include <typeinfo>
+#include <unordered_map>
+#include <unordered_set>
 #include <vector>
 
 namespace CGAL {
@@ -980,6 +984,273 @@ bool does_triangle_soup_self_intersect(const PointRange& points,
   return false;
 }
 
+/**
+ * \ingroup PMP_intersection_grp
+ *
+ * \brief maintains the pairs of intersecting faces of a triangulated surface mesh that is modified locally.
+ *
+ * The bounding boxes of the faces and the pairs of intersecting faces are kept from one call to the next, so that
+ * after a local modification of the mesh only the faces that were modified are tested against the faces close to
+ * them, instead of running `self_intersections()` on the whole mesh again.
+ * The pairs of faces are those reported by `self_intersections()`, a degenerate face `f` being reported as `(f, f)`.
+ *
+ * After a modification of the mesh, the faces that are about to be removed (or that were removed) must be passed
+ * to `remove_faces()`, and the faces that were created, or one vertex of which was moved, must be passed to
+ * `update_faces()`.
+ *
+ * This class depends on the package \ref PkgBoxIntersectionD.
+ *
+ * @tparam TriangleMesh a model of `FaceListGraph` whose face descriptor is hashable with `std::hash`
+ * @tparam GeomTraits a model of `PMPSelfIntersectionTraits`. If `Default` is passed, a \cgal Kernel
+ *                    deduced from the point type, using `CGAL::Kernel_traits`, is used.
+ * @tparam VertexPointMap a class model of `ReadablePropertyMap` with `boost::graph_traits<TriangleMesh>::%vertex_descriptor`
+ *                        as key type and `GeomTraits::Point_3` as value type.
+ *                        If `Default` is passed, the type of `boost::get(CGAL::vertex_point, tmesh)` is used.
+ *
+ * @sa `self_intersections()`
+ * @sa `does_self_intersect()`
+ */
+template <class TriangleMesh,
+          class GeomTraits = Default,
+          class VertexPointMap = Default>
+class Incremental_self_intersection_checker
+{
+public:
+  /// the vertex point map type
+  typedef typename Default::Get<VertexPointMap,
+                                typename boost::property_map<TriangleMesh,
+                                                             vertex_point_t>::const_type>::type Vertex_point_map;
+  /// the geometric traits type
+  typedef typename Default::Get<GeomTraits,
+                                typename Kernel_traits<
+                                  typename boost::property_traits<Vertex_point_map>::value_type>::Kernel>::type Geom_traits;
+  /// the face descriptor type
+  typedef typename boost::graph_traits<TriangleMesh>::face_descriptor face_descriptor;
+
+private:
+  typedef internal::Triangle_mesh_and_triangle_soup_wrapper<TriangleMesh>                     Wrapper;
+  typedef typename boost::graph_traits<TriangleMesh>::vertex_descriptor                       vertex_descriptor;
+  typedef CGAL::Box_intersection_d::Box_with_info_d<double, 3, face_descriptor,
+                                                    CGAL::Box_intersection_d::ID_FROM_BOX_ADDRESS> Box;
+
+  const TriangleMesh& m_tmesh;
+  Vertex_point_map m_vpm;
+  Geom_traits m_gt;
+  // the bounding boxes of the non-degenerate faces
+  std::unordered_map<face_descriptor, Bbox_3> m_boxes;
+  // the faces intersecting each face that intersects at least one face
+  std::unordered_map<face_descriptor, std::vector<face_descriptor> > m_intersecting_faces;
+  std::size_t m_number_of_pairs;
+
+public:
+  /// \name Creation
+  /// @{
+
+  /**
+   * computes the pairs of intersecting faces of `tmesh`.
+   *
+   * @pre `CGAL::is_triangle_mesh(tmesh)`
+   */
+  Incremental_self_intersection_checker(const TriangleMesh& tmesh,
+                                        Vertex_point_map vpm,
+                                        const Geom_traits& gt = Geom_traits())
+    : m_tmesh(tmesh), m_vpm(vpm), m_gt(gt), m_number_of_pairs(0)
+  {
+    CGAL_precondition(is_triangle_mesh(tmesh));
+
+    std::vector<std::pair<face_descriptor, face_descriptor> > pairs;
+    self_intersections(tmesh, std::back_inserter(pairs), parameters::vertex_point_map(m_vpm).geom_traits(m_gt));
+    for(const std::pair<face_descriptor, face_descriptor>& p : pairs)
+      add_pair(p.first, p.second);
+
+    m_boxes.reserve(num_faces(tmesh));
+    for(face_descriptor f : faces(tmesh))
+      if(!is_degenerate(f))
+        m_boxes.emplace(f, bbox(f));
+  }
+
+  /**
+   * computes the pairs of intersecting faces of `tmesh`, using `get(CGAL::vertex_point, tmesh)` as vertex point map.
+   *
+   * @pre `CGAL::is_triangle_mesh(tmesh)`
+   */
+  Incremental_self_intersection_checker(const TriangleMesh& tmesh,
+                                        const Geom_traits& gt = Geom_traits())
+    : Incremental_self_intersection_checker(tmesh, get(vertex_point, tmesh), gt)
+  {}
+
+  /// @}
+
+  /// \name Updates
+  /// @{
+
+  /**
+   * forgets the faces of `face_range`, and the pairs of intersecting faces they are involved in.
+   * The mesh is not accessed, so this function can be called before or after the faces are removed from the mesh.
+   *
+   * @tparam FaceRange a range of `face_descriptor`
+   */
+  template <class FaceRange>
+  void remove_faces(const FaceRange& face_range)
+  {
+    for(face_descriptor f : face_range)
+    {
+      m_boxes.erase(f);
+
+      auto it = m_intersecting_faces.find(f);
+      if(it == m_intersecting_faces.end())
+        continue;
+      for(face_descriptor g : it->second)
+      {
+        --m_number_of_pairs;
+        if(g == f)
+          continue;
+        std::vector<face_descriptor>& g_faces = m_intersecting_faces[g];
+        g_faces.erase(std::find(g_faces.begin(), g_faces.end(), f));
+        if(g_faces.empty())
+          m_intersecting_faces.erase(g);
+      }
+      m_intersecting_faces.erase(it);
+    }
+  }
+
+  /**
+   * updates the pairs of intersecting faces involving the faces of `face_range`, which must contain
+   * the faces that were added to the mesh and the faces incident to a vertex that was moved since
+   * the creation of the checker or the last update.
+   *
+   * The faces of `face_range` are tested against each other and against the faces whose bounding boxes
+   * intersect the bounding box of `face_range`, which are found with a linear scan of the stored bounding boxes.
+   *
+   * @tparam FaceRange a range of `face_descriptor`
+   *
+   * @pre `CGAL::is_triangle_mesh(tmesh)`
+   */
+  template <class FaceRange>
+  void update_faces(const FaceRange& face_range)
+  {
+    CGAL_precondition(is_triangle_mesh(m_tmesh));
+
+    // a face given several times must be tested only once, and not against itself
+    std::unordered_set<face_descriptor> updated_faces;
+    std::vector<face_descriptor> unique_faces;
+    for(face_descriptor f : face_range)
+      if(updated_faces.insert(f).second)
+        unique_faces.push_back(f);
+
+    remove_faces(unique_faces);
+
+    std::vector<Box> updated_boxes;
+    Bbox_3 updated_region;
+    for(face_descriptor f : unique_faces)
+    {
+      if(is_degenerate(f))
+      {
+        add_pair(f, f);
+        continue;
+      }
+      const Bbox_3 b = bbox(f);
+      m_boxes.emplace(f, b);
+      updated_boxes.push_back(Box(b, f));
+      updated_region += b;
+    }
+    if(updated_boxes.empty())
+      return;
+
+    std::vector<Box> close_boxes;
+    for(const std::pair<const face_descriptor, Bbox_3>& fb : m_boxes)
+      if(do_overlap(fb.second, updated_region) && updated_faces.count(fb.first) == 0)
+        close_boxes.push_back(Box(fb.second, fb.first));
+
+    std::vector<const Box*> updated_box_ptr, close_box_ptr;
+    updated_box_ptr.reserve(updated_boxes.size());
+    for(const Box& b : updated_boxes)
+      updated_box_ptr.push_back(&b);
+    close_box_ptr.reserve(close_boxes.size());
+    for(const Box& b : close_boxes)
+      close_box_ptr.push_back(&b);
+
+    typename Geom_traits::Construct_segment_3 construct_segment = m_gt.construct_segment_3_object();
+    typename Geom_traits::Construct_triangle_3 construct_triangle = m_gt.construct_triangle_3_object();
+    typename Geom_traits::Do_intersect_3 do_intersect = m_gt.do_intersect_3_object();
+    auto test_faces = [&](const Box* b, const Box* c)
+    {
+      if(internal::do_faces_intersect<Geom_traits>(b->info(), c->info(), m_tmesh, m_vpm,
+                                                   construct_segment, construct_triangle, do_intersect))
+        add_pair(b->info(), c->info());
+    };
+
+    const std::ptrdiff_t cutoff = 2000;
+    CGAL::box_self_intersection_d<CGAL::Sequential_tag>(updated_box_ptr.begin(), updated_box_ptr.end(),
+                                                        test_faces, cutoff);
+    CGAL::box_intersection_d<CGAL::Sequential_tag>(updated_box_ptr.begin(), updated_box_ptr.end(),
+                                                   close_box_ptr.begin(), close_box_ptr.end(),
+                                                   test_faces, cutoff);
+  }
+
+  /// @}
+
+  /// \name Queries
+  /// @{
+
+  /// returns whether at least two faces of the mesh intersect, or a face is degenerate.
+  bool does_self_intersect() const
+  {
+    return m_number_of_pairs != 0;
+  }
+
+  /// returns the number of pairs of intersecting faces.
+  std::size_t number_of_intersecting_pairs() const
+  {
+    return m_number_of_pairs;
+  }
+
+  /**
+   * puts in `out` the pairs of intersecting faces, each pair being reported once.
+   *
+   * @tparam FacePairOutputIterator a model of `OutputIterator` holding objects of type
+   *   `std::pair<face_descriptor, face_descriptor>`
+   */
+  template <class FacePairOutputIterator>
+  FacePairOutputIterator intersecting_pairs(FacePairOutputIterator out) const
+  {
+    std::unordered_set<face_descriptor> reported;
+    for(const std::pair<const face_descriptor, std::vector<face_descriptor> >& f_faces : m_intersecting_faces)
+    {
+      for(face_descriptor g : f_faces.second)
+        if(g == f_faces.first || reported.count(g) == 0)
+          *out++ = std::make_pair(f_faces.first, g);
+      reported.insert(f_faces.first);
+    }
+    return out;
+  }
+
+  /// @}
+
+private:
+  void add_pair(face_descriptor f, face_descriptor g)
+  {
+    ++m_number_of_pairs;
+    m_intersecting_faces[f].push_back(g);
+    if(g != f)
+      m_intersecting_faces[g].push_back(f);
+  }
+
+  bool is_degenerate(face_descriptor f) const
+  {
+    std::array<vertex_descriptor, 3> vh;
+    Wrapper::get_face_vertices(f, vh, m_tmesh);
+    return m_gt.collinear_3_object()(get(m_vpm, vh[0]), get(m_vpm, vh[1]), get(m_vpm, vh[2]));
+  }
+
+  Bbox_3 bbox(face_descriptor f) const
+  {
+    std::array<vertex_descriptor, 3> vh;
+    Wrapper::get_face_vertices(f, vh, m_tmesh);
+    return get(m_vpm, vh[0]).bbox() + get(m_vpm, vh[1]).bbox() + get(m_vpm, vh[2]).bbox();
+  }
+};
+
 }// namespace Polygon_mesh_processing
 }// namespace CGAL
 
@@ -22,10 +22,13 @@
 
 #include <CGAL/Named_function_parameters.h>
 #include <CGAL/boost/graph/named_params_helper.h>
+#include <CGAL/for_each.h>
+#include <CGAL/tags.h>
 
 #include <tuple>
 #include <type_traits>
 #include <unordered_map>
+#include <vector>
 
 namespace CGAL {
 namespace Polygon_mesh_processing {
@@ -123,6 +126,15 @@ struct Allow_all_moves{
 *     \cgalParamDefault{If not provided, smoothing weights are the same for all vertices.}
 *   \cgalParamNEnd
 *
+*   \cgalParamNBegin{concurrency_tag}
+*     \cgalParamDescription{a tag indicating if the barycenters and the moves of the vertices
+*                           should be computed sequentially or in parallel}
+*     \cgalParamType{Either `CGAL::Sequential_tag`, or `CGAL::Parallel_tag`, or `CGAL::Parallel_if_available_tag`}
+*     \cgalParamDefault{`CGAL::Sequential_tag`}
+*     \cgalParamExtra{In parallel, the vertices sharing a face are not moved concurrently, and
+*                     `allow_move_functor` must be safe to call from several threads.}
+*   \cgalParamNEnd
+*
 * \cgalNamedParamsEnd
 *
 * \todo check if it should really be a triangle mesh or if a polygon mesh is fine
@@ -226,6 +238,18 @@ void tangential_relaxation(const VertexRange& vertices,
   Shall_move shall_move = choose_parameter(get_parameter(np, internal_np::allow_move_functor),
                                            internal::Allow_all_moves());
 
+  typedef typename internal_np::Lookup_named_param_def <
+      internal_np::concurrency_tag_t,
+      CGAL_NP_CLASS,
+      Sequential_tag
+    > ::type Concurrency_tag;
+  constexpr bool parallel_relaxation = std::is_convertible<Concurrency_tag, Parallel_tag>::value;
+
+  // in parallel, the vertices are accessed by index
+  std::vector<vertex_descriptor> vertex_list;
+  if constexpr (parallel_relaxation)
+    vertex_list.assign(std::begin(vertices), std::end(vertices));
+
   for (unsigned int nit = 0; nit < nb_iterations; ++nit)
   {
 #ifdef CGAL_PMP_TANGENTIAL_RELAXATION_VERBOSE
@@ -239,15 +263,12 @@ void tangential_relaxation(const VertexRange& vertices,
     auto gt_barycenter = gt.construct_barycenter_3_object();
     auto gt_project = gt.construct_projected_point_3_object();
 
-    // at each vertex, compute vertex normal
-    std::unordered_map<vertex_descriptor, Vector_3> vnormals;
-    compute_vertex_normals(tm, boost::make_assoc_property_map(vnormals), np);
-
-    // at each vertex, compute barycenter of neighbors
-    for(vertex_descriptor v : vertices)
+    // compute the barycenter of the neighbors of `v` and puts it in `vnp`,
+    // returns `false` if `v` does not move
+    auto compute_barycenter = [&](vertex_descriptor v, const auto& vertex_normal, VNP& vnp) -> bool
     {
       if (get(vcm, v) || CGAL::internal::is_isolated(v, tm))
-        continue;
+        return false;
 
       // collect hedges to detect if we have to handle boundary cases
       std::vector<halfedge_descriptor> interior_hedges, border_halfedges;
@@ -261,7 +282,7 @@ void tangential_relaxation(const VertexRange& vertices,
 
       if (border_halfedges.empty())
       {
-        const Vector_3& vn = vnormals.at(v);
+        const Vector_3 vn = vertex_normal(v);
         Vector_3 move = CGAL::NULL_VECTOR;
         if constexpr (std::is_same_v<SizingFunction, Uniform_sizing_field<TriangleMesh, VPMap>>)
         {
@@ -298,11 +319,12 @@ void tangential_relaxation(const VertexRange& vertices,
           }
           move = move / weight; //todo ip: what if weight ends up being close to 0?
         }
-        barycenters.emplace_back(v, vn, get(vpm, v) + move);
+        vnp = VNP(v, vn, get(vpm, v) + move);
+        return true;
       }
       else
       {
-        if (!relax_constraints) continue;
+        if (!relax_constraints) return false;
         Vector_3 vn(NULL_VECTOR);
 
         if (border_halfedges.size() == 2)// corners are constrained
@@ -324,10 +346,44 @@ void tangential_relaxation(const VertexRange& vertices,
             typename GT::Point_3 p1 = gt_project(s1, bary), p2 = gt_project(s2, bary);
 
             bary = squared_distance(p1, bary)<squared_distance(p2,bary)? p1:p2;
-            barycenters.emplace_back(v, vn, bary);
+            vnp = VNP(v, vn, bary);
+            return true;
           }
         }
       }
+      return false;
+    };
+
+    if constexpr (parallel_relaxation)
+    {
+      // vertex normals are computed on the fly, each vertex having its own
+      std::vector<VNP> all_barycenters(vertex_list.size());
+      std::vector<char> moves(vertex_list.size(), 0);
+      CGAL::for_each<Concurrency_tag>(CGAL::make_counting_range<std::size_t>(0, vertex_list.size()),
+                                      [&](std::size_t i) -> bool
+                                      {
+                                        auto vertex_normal = [&](vertex_descriptor v) { return compute_vertex_normal(v, tm, np); };
+                                        moves[i] = compute_barycenter(vertex_list[i], vertex_normal, all_barycenters[i]);
+                                        return true;
+                                      });
+      for(std::size_t i=0; i<vertex_list.size(); ++i)
+        if (moves[i])
+          barycenters.push_back(all_barycenters[i]);
+    }
+    else
+    {
+      // at each vertex, compute vertex normal
+      std::unordered_map<vertex_descriptor, Vector_3> vnormals;
+      compute_vertex_normals(tm, boost::make_assoc_property_map(vnormals), np);
+
+      // at each vertex, compute barycenter of neighbors
+      auto vertex_normal = [&](vertex_descriptor v) { return vnormals.at(v); };
+      for(vertex_descriptor v : vertices)
+      {
+        VNP vnp;
+        if (compute_barycenter(v, vertex_normal, vnp))
+          barycenters.push_back(vnp);
+      }
     }
 
     // compute moves
@@ -345,7 +401,7 @@ void tangential_relaxation(const VertexRange& vertices,
     }
 
     // perform moves
-    for(const VP_pair& vp : new_locations)
+    auto perform_move = [&](const VP_pair& vp)
     {
       const Point_3 initial_pos = get(vpm, vp.first); // make a copy on purpose
       const Vector_3 move(initial_pos, vp.second);
@@ -363,6 +419,53 @@ void tangential_relaxation(const VertexRange& vertices,
       }
       if (frac <= 0.02)
         put(vpm, vp.first, initial_pos);//cancel move
+    };
+
+    if constexpr (parallel_relaxation)
+    {
+      // Whether a move is valid depends on the positions of the vertices of the incident faces,
+      // so such vertices are not moved concurrently: the moving vertices are greedily colored
+      // so that two vertices of a same face have different colors, and the vertices of a color
+      // are moved in parallel.
+      auto color_map = get(CGAL::dynamic_vertex_property_t<std::size_t>(), tm, std::size_t(0));
+      for(const VP_pair& vp : new_locations)
+        put(color_map, vp.first, 1);
+
+      std::vector<std::vector<std::size_t> > color_classes;
+      std::vector<bool> used;
+      for(std::size_t i=0; i<new_locations.size(); ++i)
+      {
+        const vertex_descriptor v = new_locations[i].first;
+        used.assign(color_classes.size() + 3, false);
+        for(halfedge_descriptor h : halfedges_around_target(v, tm))
+        {
+          if (is_border(h, tm))
+            continue;
+          for(vertex_descriptor w : vertices_around_face(h, tm))
+            if (w != v)
+              used[get(color_map, w)] = true; // 0: not moving, 1: not yet colored
+        }
+        std::size_t c = 2;
+        while (used[c])
+          ++c;
+        put(color_map, v, c);
+        if (c - 2 == color_classes.size())
+          color_classes.emplace_back();
+        color_classes[c - 2].push_back(i);
+      }
+
+      for(const std::vector<std::size_t>& color_class : color_classes)
+        CGAL::for_each<Concurrency_tag>(color_class,
+                                        [&](std::size_t i) -> bool
+                                        {
+                                          perform_move(new_locations[i]);
+                                          return true;
+                                        });
+    }
+    else
+    {
+      for(const VP_pair& vp : new_locations)
+        perform_move(vp);
     }
   }//end for loop (nit == nb_iterations)
 
@@ -17,6 +17,7 @@
 #include <CGAL/disable_warnings.h>
 
 #include <CGAL/bounding_box.h>
+#include <CGAL/for_each.h>
 #include <CGAL/Polygon_mesh_processing/internal/Hole_filling/Triangulate_hole_polygon_mesh.h>
 #include <CGAL/Polygon_mesh_processing/internal/Hole_filling/Triangulate_hole_polyline.h>
 #include <CGAL/Polygon_mesh_processing/refine.h>
@@ -28,7 +29,7 @@
 #include <CGAL/boost/graph/helpers.h>
 
 #include <tuple>
-
+#include <unordered_map>
 #include <vector>
 
 namespace CGAL {
@@ -60,6 +61,42 @@ namespace Polygon_mesh_processing {
     };
   } // namespace Hole_filling
 
+namespace internal {
+
+  // the maximum squared distance of the points of the hole to their fitting plane
+  // for the hole to be filled using a 2D constrained Delaunay triangulation
+  template<typename GeomTraits, typename PolygonMesh, typename VertexPointMap, typename NamedParameters>
+  typename GeomTraits::FT
+  hole_filling_max_squared_distance(const PolygonMesh& pmesh,
+                                    typename boost::graph_traits<PolygonMesh>::halfedge_descriptor border_halfedge,
+                                    const VertexPointMap vpmap,
+                                    const NamedParameters& np)
+  {
+    using parameters::choose_parameter;
+    using parameters::get_parameter;
+
+    std::vector<typename GeomTraits::Point_3> points;
+    typedef Halfedge_around_face_circulator<PolygonMesh> Hedge_around_face_circulator;
+    Hedge_around_face_circulator circ(border_halfedge, pmesh), done(circ);
+    do {
+      points.push_back(get(vpmap, target(*circ, pmesh)));
+    } while (++circ != done);
+
+    const typename GeomTraits::Iso_cuboid_3 bbox = CGAL::bounding_box(points.begin(), points.end());
+    typename GeomTraits::FT default_squared_distance = CGAL::abs(CGAL::squared_distance(bbox.vertex(0), bbox.vertex(5)));
+    default_squared_distance /= typename GeomTraits::FT(16); // one quarter of the bbox height
+
+    const typename GeomTraits::FT threshold_distance = choose_parameter(
+      get_parameter(np, internal_np::threshold_distance), typename GeomTraits::FT(-1));
+    typename GeomTraits::FT max_squared_distance = default_squared_distance;
+    if (threshold_distance >= typename GeomTraits::FT(0))
+      max_squared_distance = threshold_distance * threshold_distance;
+    CGAL_assertion(max_squared_distance >= typename GeomTraits::FT(0));
+    return max_squared_distance;
+  }
+
+} // namespace internal
+
   /*!
   \ingroup PMP_hole_filling_grp
 
@@ -149,6 +186,15 @@ namespace Polygon_mesh_processing {
       \cgalParamType{Hole_filling::Default_visitor}
     \cgalParamNEnd
 
+    \cgalParamNBegin{concurrency_tag}
+      \cgalParamDescription{a tag indicating if the cubic search space algorithm should be run in parallel.
+                            Only large holes (a hundred vertices or more) benefit from it.}
+      \cgalParamType{Either `CGAL::Sequential_tag`, or `CGAL::Parallel_tag`, or `CGAL::Parallel_if_available_tag`}
+      \cgalParamDefault{`CGAL::Sequential_tag`}
+      \cgalParamExtra{In parallel, the steps of the cubic phase are reported to the visitor by the calling thread,
+                      once all the triangulations of boundary sub-ranges of a given size have been computed.}
+    \cgalParamNEnd
+
   \cgalNamedParamsEnd
 
   @return the face output iterator
@@ -173,6 +219,9 @@ namespace Polygon_mesh_processing {
     using parameters::get_parameter_reference;
 
     typedef typename GetGeomTraits<PolygonMesh,CGAL_NP_CLASS>::type         GeomTraits;
+    typedef typename internal_np::Lookup_named_param_def<internal_np::concurrency_tag_t,
+                                                         CGAL_NP_CLASS,
+                                                         Sequential_tag>::type Concurrency_tag;
 
     typedef typename internal_np::Lookup_named_param_def<internal_np::face_output_iterator_t,
                                                          CGAL_NP_CLASS,
@@ -195,37 +244,20 @@ namespace Polygon_mesh_processing {
         choose_parameter(get_parameter(np, internal_np::use_2d_constrained_delaunay_triangulation), false);
 #endif
 
+    const auto vpmap = choose_parameter(get_parameter(np, internal_np::vertex_point), get_property_map(vertex_point, pmesh));
+
     typename GeomTraits::FT max_squared_distance = typename GeomTraits::FT(-1);
-    if (use_cdt) {
-
-      std::vector<typename GeomTraits::Point_3> points;
-      typedef Halfedge_around_face_circulator<PolygonMesh> Hedge_around_face_circulator;
-      const auto vpmap = choose_parameter(get_parameter(np, internal_np::vertex_point), get_property_map(vertex_point, pmesh));
-      Hedge_around_face_circulator circ(border_halfedge, pmesh), done(circ);
-      do {
-        points.push_back(get(vpmap, target(*circ, pmesh)));
-      } while (++circ != done);
-
-      const typename GeomTraits::Iso_cuboid_3 bbox = CGAL::bounding_box(points.begin(), points.end());
-      typename GeomTraits::FT default_squared_distance = CGAL::abs(CGAL::squared_distance(bbox.vertex(0), bbox.vertex(5)));
-      default_squared_distance /= typename GeomTraits::FT(16); // one quarter of the bbox height
-
-      const typename GeomTraits::FT threshold_distance = choose_parameter(
-        get_parameter(np, internal_np::threshold_distance), typename GeomTraits::FT(-1));
-      max_squared_distance = default_squared_distance;
-      if (threshold_distance >= typename GeomTraits::FT(0))
-        max_squared_distance = threshold_distance * threshold_distance;
-      CGAL_assertion(max_squared_distance >= typename GeomTraits::FT(0));
-    }
+    if (use_cdt)
+      max_squared_distance = internal::hole_filling_max_squared_distance<GeomTraits>(pmesh, border_halfedge, vpmap, np);
 
     Hole_filling::Default_visitor default_visitor;
 
     return
-      internal::triangulate_hole_polygon_mesh(
+      internal::triangulate_hole_polygon_mesh<Concurrency_tag>(
         pmesh,
         border_halfedge,
         out,
-        choose_parameter(get_parameter(np, internal_np::vertex_point), get_property_map(vertex_point, pmesh)),
+        vpmap,
         use_dt3,
         choose_parameter<GeomTraits>(get_parameter(np, internal_np::geom_traits)),
         use_cdt,
@@ -264,6 +296,203 @@ namespace Polygon_mesh_processing {
   }
 #endif // CGAL_NO_DEPRECATED_CODE
 
+  /*!
+  \ingroup PMP_hole_filling_grp
+
+  triangulates several holes of a polygon mesh.
+
+  The triangulations of the holes are first computed without modifying `pmesh`,
+  possibly in parallel, and are then added to `pmesh` one after the other.
+  Holes sharing a vertex with another hole of `border_halfedges` are not independent
+  and are triangulated sequentially, once the other holes have been filled.
+  The algorithm used for each hole and its preconditions are the same as in `triangulate_hole()`.
+  Holes that cannot be triangulated are left unchanged.
+
+  @tparam PolygonMesh a model of `MutableFaceGraph`
+  @tparam HalfedgeRange a model of `ConstRange` with value type `boost::graph_traits<PolygonMesh>::%halfedge_descriptor`
+  @tparam NamedParameters a sequence of \ref bgl_namedparameters "Named Parameters"
+
+  @param pmesh polygon mesh containing the holes
+  @param border_halfedges a range with exactly one border halfedge per hole to fill.
+                          All the holes of `pmesh` can be obtained using `extract_boundary_cycles()`.
+  @param np an optional sequence of \ref bgl_namedparameters "Named Parameters" among the ones listed below
+
+  \cgalNamedParamsBegin
+
+    \cgalParamNBegin{face_output_iterator}
+      \cgalParamDescription{iterator over patch faces}
+      \cgalParamType{a model of `OutputIterator`
+    holding `boost::graph_traits<PolygonMesh>::%face_descriptor` for patch faces}
+      \cgalParamDefault{`Emptyset_iterator`}
+    \cgalParamNEnd
+
+    \cgalParamNBegin{vertex_point_map}
+      \cgalParamDescription{a property map associating points to the vertices of `pmesh`}
+      \cgalParamType{a class model of `ReadWritePropertyMap` with `boost::graph_traits<PolygonMesh>::%vertex_descriptor`
+                     as key type and `%Point_3` as value type}
+      \cgalParamDefault{`boost::get(CGAL::vertex_point, pmesh)`}
+      \cgalParamExtra{If this parameter is omitted, an internal property map for `CGAL::vertex_point_t`
+                      must be available in `PolygonMesh`.}
+    \cgalParamNEnd
+
+    \cgalParamNBegin{geom_traits}
+      \cgalParamDescription{an instance of a geometric traits class}
+      \cgalParamType{a class model of `Kernel`}
+      \cgalParamDefault{a \cgal Kernel deduced from the point type, using `CGAL::Kernel_traits`}
+      \cgalParamExtra{The geometric traits class must be compatible with the vertex point type.}
+    \cgalParamNEnd
+
+    \cgalParamNBegin{use_delaunay_triangulation}
+      \cgalParamDescription{If `true`, use the Delaunay triangulation facet search space.}
+      \cgalParamType{Boolean}
+      \cgalParamDefault{`true`}
+    \cgalParamNEnd
+
+    \cgalParamNBegin{use_2d_constrained_delaunay_triangulation}
+      \cgalParamDescription{If `true`, near planar holes are filled using a 2D constrained Delaunay triangulation,
+                            as in `triangulate_hole()`.}
+      \cgalParamType{Boolean}
+      \cgalParamDefault{`false`}
+    \cgalParamNEnd
+
+    \cgalParamNBegin{threshold_distance}
+      \cgalParamDescription{The maximum distance between the vertices of
+                            the boundary of a hole and the least squares plane fitted to this boundary.}
+      \cgalParamType{double}
+      \cgalParamDefault{one quarter of the height of the bounding box of the hole}
+      \cgalParamExtra{This parameter is used only in conjunction with
+                      the parameter `use_2d_constrained_delaunay_triangulation`.}
+    \cgalParamNEnd
+
+    \cgalParamNBegin{do_not_use_cubic_algorithm}
+      \cgalParamDescription{Set this parameter to `true` if you only want to use the Delaunay based versions of the algorithm,
+                            skipping the cubic search space one in case of failure.}
+      \cgalParamType{Boolean}
+      \cgalParamDefault{`false`}
+    \cgalParamNEnd
+
+    \cgalParamNBegin{concurrency_tag}
+      \cgalParamDescription{a tag indicating if the triangulations of the holes should be computed in parallel}
+      \cgalParamType{Either `CGAL::Sequential_tag`, or `CGAL::Parallel_tag`, or `CGAL::Parallel_if_available_tag`}
+      \cgalParamDefault{`CGAL::Sequential_tag`}
+      \cgalParamExtra{In parallel, the cubic search space algorithm is also run in parallel for large holes.}
+    \cgalParamNEnd
+
+  \cgalNamedParamsEnd
+
+  @return the number of holes that have been filled
+
+  \sa `triangulate_hole()`
+  \sa `extract_boundary_cycles()`
+  */
+  template<typename PolygonMesh,
+           typename HalfedgeRange,
+           typename CGAL_NP_TEMPLATE_PARAMETERS>
+  std::size_t
+  triangulate_holes(PolygonMesh& pmesh,
+                    const HalfedgeRange& border_halfedges,
+                    const CGAL_NP_CLASS& np = parameters::default_values())
+  {
+    using parameters::choose_parameter;
+    using parameters::get_parameter;
+
+    typedef typename boost::graph_traits<PolygonMesh>::vertex_descriptor   vertex_descriptor;
+    typedef typename boost::graph_traits<PolygonMesh>::halfedge_descriptor halfedge_descriptor;
+
+    typedef typename GetGeomTraits<PolygonMesh,CGAL_NP_CLASS>::type         GeomTraits;
+    typedef typename GeomTraits::FT                                         FT;
+    typedef typename internal_np::Lookup_named_param_def<internal_np::concurrency_tag_t,
+                                                         CGAL_NP_CLASS,
+                                                         Sequential_tag>::type Concurrency_tag;
+
+    typedef typename internal_np::Lookup_named_param_def<internal_np::face_output_iterator_t,
+                                                         CGAL_NP_CLASS,
+                                                         Emptyset_iterator>::type Face_output_iterator;
+
+    Face_output_iterator out = choose_parameter<Emptyset_iterator>(get_parameter(np, internal_np::face_output_iterator));
+
+    const bool use_dt3 =
+#ifdef CGAL_HOLE_FILLING_DO_NOT_USE_DT3
+      false;
+#else
+      choose_parameter(get_parameter(np, internal_np::use_delaunay_triangulation), true);
+#endif
+    const bool use_cdt =
+#ifdef CGAL_HOLE_FILLING_DO_NOT_USE_CDT2
+        false;
+#else
+        choose_parameter(get_parameter(np, internal_np::use_2d_constrained_delaunay_triangulation), false);
+#endif
+    const bool skip_cubic_algorithm = choose_parameter(get_parameter(np, internal_np::do_not_use_cubic_algorithm), false);
+
+    const GeomTraits traits = choose_parameter<GeomTraits>(get_parameter(np, internal_np::geom_traits));
+    const auto vpmap = choose_parameter(get_parameter(np, internal_np::vertex_point), get_property_map(vertex_point, pmesh));
+
+    // Filling a hole creates edges between the vertices of its boundary, which must be taken
+    // into account to fill another hole sharing some of these vertices.
+    std::unordered_map<vertex_descriptor, std::size_t> nb_incident_holes;
+    for(halfedge_descriptor h : border_halfedges)
+    {
+      CGAL_precondition(is_border(h, pmesh));
+      for(halfedge_descriptor hf : halfedges_around_face(h, pmesh))
+        ++nb_incident_holes[target(hf, pmesh)];
+    }
+
+    std::vector<halfedge_descriptor> independent_holes, dependent_holes;
+    for(halfedge_descriptor h : border_halfedges)
+    {
+      bool is_independent = true;
+      for(halfedge_descriptor hf : halfedges_around_face(h, pmesh))
+      {
+        if(nb_incident_holes[target(hf, pmesh)] > 1)
+        {
+          is_independent = false;
+          break;
+        }
+      }
+      (is_independent ? independent_holes : dependent_holes).push_back(h);
+    }
+
+    auto compute_patch = [&](halfedge_descriptor h, internal::Hole_patch<PolygonMesh>& patch)
+    {
+      Hole_filling::Default_visitor visitor;
+      const FT max_squared_distance =
+        use_cdt ? internal::hole_filling_max_squared_distance<GeomTraits>(pmesh, h, vpmap, np) : FT(-1);
+      internal::compute_hole_patch<Concurrency_tag>(pmesh, h, patch, vpmap, use_dt3, traits, use_cdt,
+                                                    skip_cubic_algorithm, visitor, max_squared_distance);
+    };
+
+    // the patches of independent holes are computed without modifying the mesh
+    std::vector<internal::Hole_patch<PolygonMesh> > patches(independent_holes.size());
+    CGAL::for_each<Concurrency_tag>(CGAL::make_counting_range<std::size_t>(0, independent_holes.size()),
+                                    [&](std::size_t i) -> bool
+                                    {
+                                      compute_patch(independent_holes[i], patches[i]);
+                                      return true;
+                                    });
+
+    std::size_t nb_filled_holes = 0;
+    for(internal::Hole_patch<PolygonMesh>& patch : patches)
+    {
+      if(!patch.is_valid())
+        continue;
+      out = patch.add_to(pmesh, out);
+      ++nb_filled_holes;
+    }
+
+    for(halfedge_descriptor h : dependent_holes)
+    {
+      internal::Hole_patch<PolygonMesh> patch;
+      compute_patch(h, patch);
+      if(!patch.is_valid())
+        continue;
+      out = patch.add_to(pmesh, out);
+      ++nb_filled_holes;
+    }
+
+    return nb_filled_holes;
+  }
+
   /*!
   \ingroup PMP_hole_filling_grp
   @brief triangulates and refines a hole in a polygon mesh.
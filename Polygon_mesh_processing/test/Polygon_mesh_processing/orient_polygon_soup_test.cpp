@@ -68,6 +68,13 @@ bool test_orient(const bool save_oriented)
     if(!is_valid_polygon_mesh(mesh))
       return false;
 
+    Surface_mesh mesh_in_parallel;
+    PMP::polygon_soup_to_polygon_mesh(points, polygons, mesh_in_parallel,
+                                      CGAL::parameters::concurrency_tag(CGAL::Parallel_if_available_tag()));
+    if(!is_valid_polygon_mesh(mesh_in_parallel) || num_halfedges(mesh_in_parallel) != num_halfedges(mesh) ||
+       num_faces(mesh_in_parallel) != num_faces(mesh))
+      return false;
+
     Polyhedron poly;
     PMP::polygon_soup_to_polygon_mesh(points, polygons, poly);
 
@@ -14,6 +14,7 @@
 
 #include <iostream>
 #include <fstream>
+#include <vector>
 
 typedef CGAL::Exact_predicates_inexact_constructions_kernel          EPICK;
 //typedef CGAL::Exact_predicates_exact_constructions_kernel_with_sqrt  EPECK;
@@ -68,6 +69,26 @@ void test(const Mesh& mesh,
   PMP::compute_normals(mesh, vnormals, fnormals, CGAL::parameters::vertex_point_map(vpmap)
                                                                   .geom_traits(K()));
 
+  // the normals computed for all faces are the ones of the faces taken one by one,
+  // and do not depend on the concurrency tag
+  std::vector<Vector> face_normals, vertex_normals;
+  for(face_descriptor f : faces(mesh))
+  {
+    assert(get(fnormals, f) == PMP::compute_face_normal(f, mesh));
+    face_normals.push_back(get(fnormals, f));
+  }
+  for(vertex_descriptor v : vertices(mesh))
+    vertex_normals.push_back(get(vnormals, v));
+
+  PMP::compute_normals(mesh, vnormals, fnormals, CGAL::parameters::concurrency_tag(CGAL::Parallel_if_available_tag()));
+
+  std::size_t i = 0;
+  for(face_descriptor f : faces(mesh))
+    assert(get(fnormals, f) == face_normals[i++]);
+  i = 0;
+  for(vertex_descriptor v : vertices(mesh))
+    assert(get(vnormals, v) == vertex_normals[i++]);
+
 #if 1//def CGAL_PMP_COMPUTE_NORMAL_DEBUG_PP
   std::ofstream vn_out("vertex_normals.cgal.polylines.txt");
   std::ofstream fn_out("face_normals.cgal.polylines.txt");
@@ -310,10 +310,65 @@ Main(int argc, const char* argv[])
 }
 };
 
+// remeshes with the relaxation and the projection performed in parallel
+template <typename ConcurrencyTag>
+void test_concurrency(const char* filename)
+{
+  typedef CGAL::Surface_mesh<Epic::Point_3> Mesh;
+  typedef boost::graph_traits<Mesh>::vertex_descriptor vertex_descriptor;
+
+  Mesh m;
+  std::ifstream input(filename);
+  if (!input || !(input >> m)){
+    std::cerr << "Error: can not read file.\n";
+    assert(false);
+    return;
+  }
+
+  Mesh m_seq = m;
+  PMP::isotropic_remeshing(faces(m_seq), 0.05, m_seq,
+                           CGAL::parameters::number_of_iterations(3)
+                                            .number_of_relaxation_steps(3));
+  PMP::isotropic_remeshing(faces(m), 0.05, m,
+                           CGAL::parameters::number_of_iterations(3)
+                                            .number_of_relaxation_steps(3)
+                                            .concurrency_tag(ConcurrencyTag()));
+  assert(CGAL::is_valid_polygon_mesh(m));
+  assert(!PMP::does_self_intersect(m));
+
+  // the vertices are not moved in the same order
+  std::cout << num_faces(m_seq) << " faces sequentially, " << num_faces(m) << " faces in parallel" << std::endl;
+  assert(10 * num_faces(m) > 9 * num_faces(m_seq) && 9 * num_faces(m) < 10 * num_faces(m_seq));
+
+  // a projection functor, and moves restricted to one side of a plane
+  std::size_t nb_vertices = num_vertices(m);
+  auto vpm = get(CGAL::vertex_point, m);
+  PMP::isotropic_remeshing(faces(m), 0.05, m,
+                           CGAL::parameters::do_split(false)
+                                            .do_collapse(false)
+                                            .do_flip(false)
+                                            .projection_functor([&](vertex_descriptor v) { return get(vpm, v); })
+                                            .allow_move_functor([](vertex_descriptor, const Epic::Point_3&, const Epic::Point_3& q)
+                                                                { return q.x() < 0.5; })
+                                            .concurrency_tag(ConcurrencyTag()));
+  assert(num_vertices(m) == nb_vertices);
+  assert(CGAL::is_valid_polygon_mesh(m));
+
+  PMP::tangential_relaxation(m, CGAL::parameters::number_of_iterations(5)
+                                                 .concurrency_tag(ConcurrencyTag()));
+  assert(CGAL::is_valid_polygon_mesh(m));
+  assert(!PMP::does_self_intersect(m));
+}
+
 int main(int argc, const char* argv[])
 {
   Main<Epic> m(argc,argv);
 
+  test_concurrency<CGAL::Sequential_tag>("data/joint_refined.off");
+#ifdef CGAL_LINKED_WITH_TBB
+  test_concurrency<CGAL::Parallel_tag>("data/joint_refined.off");
+#endif
+
   const char* param[6] = { "remesh",//command
                            "data_remeshing/cheese_transformed-facets.off",//input
                            "0.0015", //target edge length
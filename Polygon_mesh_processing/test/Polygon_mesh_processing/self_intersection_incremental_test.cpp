@@ -0,0 +1,168 @@
+#include <CGAL/Polygon_mesh_processing/self_intersections.h>
+#include <CGAL/Polygon_mesh_processing/bbox.h>
+#include <CGAL/Polygon_mesh_processing/compute_normal.h>
+#include <CGAL/Polygon_mesh_processing/IO/polygon_mesh_io.h>
+
+#include <CGAL/Surface_mesh.h>
+#include <CGAL/Polyhedron_3.h>
+#include <CGAL/boost/graph/Euler_operations.h>
+#include <CGAL/Random.h>
+
+#include <CGAL/Exact_predicates_inexact_constructions_kernel.h>
+
+#include <algorithm>
+#include <cassert>
+#include <cstdlib>
+#include <iostream>
+#include <iterator>
+#include <vector>
+
+typedef CGAL::Exact_predicates_inexact_constructions_kernel     K;
+
+namespace PMP = ::CGAL::Polygon_mesh_processing;
+
+// the pairs of faces, each pair and the range being sorted
+template <typename Face_pairs>
+Face_pairs sorted(Face_pairs pairs)
+{
+  for(auto& p : pairs)
+    if(p.second < p.first)
+      std::swap(p.first, p.second);
+  std::sort(pairs.begin(), pairs.end());
+  return pairs;
+}
+
+template <typename Mesh, typename Checker>
+void check(const Mesh& m, const Checker& checker)
+{
+  typedef typename boost::graph_traits<Mesh>::face_descriptor      face_descriptor;
+  typedef std::vector<std::pair<face_descriptor, face_descriptor> > Face_pairs;
+
+  Face_pairs expected, pairs;
+  PMP::self_intersections(m, std::back_inserter(expected));
+  checker.intersecting_pairs(std::back_inserter(pairs));
+
+  assert(sorted(expected) == sorted(pairs));
+  assert(checker.number_of_intersecting_pairs() == expected.size());
+  assert(checker.does_self_intersect() == !expected.empty());
+}
+
+template <typename Mesh>
+void test_moves(Mesh& m, PMP::Incremental_self_intersection_checker<Mesh>& checker, CGAL::Random& rng)
+{
+  typedef typename boost::graph_traits<Mesh>::vertex_descriptor    vertex_descriptor;
+  typedef typename boost::graph_traits<Mesh>::face_descriptor      face_descriptor;
+
+  const CGAL::Bbox_3 bb = PMP::bbox(m);
+  const double size = bb.xmax() - bb.xmin();
+
+  std::vector<vertex_descriptor> vs(vertices(m).begin(), vertices(m).end());
+  for(int i=0; i<50; ++i)
+  {
+    // move a vertex, likely through the surface
+    vertex_descriptor v = vs[rng.get_int(0, static_cast<int>(vs.size()))];
+    K::Vector_3 d(rng.get_double(-1, 1), rng.get_double(-1, 1), rng.get_double(-1, 1));
+    put(CGAL::vertex_point, m, v, get(CGAL::vertex_point, m, v) + (0.05 * size) * d);
+
+    std::vector<face_descriptor> fs;
+    for(face_descriptor f : CGAL::faces_around_target(halfedge(v, m), m))
+      if(f != boost::graph_traits<Mesh>::null_face())
+        fs.push_back(f);
+    checker.update_faces(fs);
+    check(m, checker);
+  }
+  std::cout << "  " << checker.number_of_intersecting_pairs() << " pairs after moves" << std::endl;
+
+  for(int i=0; i<20; ++i)
+  {
+    // move the two vertices of an edge, the faces incident to both being given twice
+    vertex_descriptor v = vs[rng.get_int(0, static_cast<int>(vs.size()))];
+    vertex_descriptor w = source(halfedge(v, m), m);
+    K::Vector_3 d(rng.get_double(-1, 1), rng.get_double(-1, 1), rng.get_double(-1, 1));
+    put(CGAL::vertex_point, m, v, get(CGAL::vertex_point, m, v) + (0.05 * size) * d);
+    put(CGAL::vertex_point, m, w, get(CGAL::vertex_point, m, w) - (0.05 * size) * d);
+
+    std::vector<face_descriptor> fs;
+    for(vertex_descriptor u : { v, w })
+      for(face_descriptor f : CGAL::faces_around_target(halfedge(u, m), m))
+        if(f != boost::graph_traits<Mesh>::null_face())
+          fs.push_back(f);
+    checker.update_faces(fs);
+    check(m, checker);
+  }
+  std::cout << "  " << checker.number_of_intersecting_pairs() << " pairs after moves of edges" << std::endl;
+}
+
+void test_surface_mesh(const std::string& filename, CGAL::Random& rng)
+{
+  typedef CGAL::Surface_mesh<K::Point_3>                           Mesh;
+  typedef boost::graph_traits<Mesh>::halfedge_descriptor          halfedge_descriptor;
+  typedef boost::graph_traits<Mesh>::face_descriptor              face_descriptor;
+
+  Mesh m;
+  if(!PMP::IO::read_polygon_mesh(filename, m))
+  {
+    std::cerr << "Error: cannot read file: " << filename << std::endl;
+    std::exit(EXIT_FAILURE);
+  }
+
+  std::cout << "Surface_mesh" << std::endl;
+  PMP::Incremental_self_intersection_checker<Mesh> checker(m);
+  check(m, checker);
+  test_moves(m, checker, rng);
+
+  // create faces around a new vertex, then remove them
+  for(int i=0; i<20; ++i)
+  {
+    face_descriptor f(rng.get_int(0, static_cast<int>(m.number_of_faces())));
+    if(m.is_removed(f))
+      continue;
+    halfedge_descriptor h = CGAL::Euler::add_center_vertex(halfedge(f, m), m);
+    m.point(target(h, m)) = CGAL::centroid(m.point(source(h, m)), m.point(target(next(h, m), m)),
+                                           m.point(target(next(next(h, m), m), m)))
+                            + (i % 2 == 0 ? 0.1 : 0.) * PMP::compute_face_normal(face(h, m), m) ;
+
+    std::vector<face_descriptor> fs(CGAL::faces_around_target(h, m).begin(),
+                                    CGAL::faces_around_target(h, m).end());
+    checker.update_faces(fs);
+    check(m, checker);
+
+    if(i % 4 == 1)
+    {
+      checker.remove_faces(fs);
+      h = CGAL::Euler::remove_center_vertex(h, m);
+      checker.update_faces(std::vector<face_descriptor>(1, face(h, m)));
+      check(m, checker);
+    }
+  }
+  std::cout << "  " << checker.number_of_intersecting_pairs() << " pairs after Euler operations" << std::endl;
+}
+
+void test_polyhedron(const std::string& filename, CGAL::Random& rng)
+{
+  typedef CGAL::Polyhedron_3<K>                                    Mesh;
+
+  Mesh m;
+  if(!PMP::IO::read_polygon_mesh(filename, m))
+  {
+    std::cerr << "Error: cannot read file: " << filename << std::endl;
+    std::exit(EXIT_FAILURE);
+  }
+
+  std::cout << "Polyhedron_3" << std::endl;
+  PMP::Incremental_self_intersection_checker<Mesh> checker(m);
+  check(m, checker);
+  test_moves(m, checker, rng);
+}
+
+int main(int argc, char** argv)
+{
+  const std::string filename = (argc > 1) ? argv[1] : CGAL::data_file_path("meshes/elephant.off");
+
+  CGAL::Random rng(0);
+  test_surface_mesh(filename, rng);
+  test_polyhedron(filename, rng);
+
+  std::cout << "done" << std::endl;
+  return EXIT_SUCCESS;
+}
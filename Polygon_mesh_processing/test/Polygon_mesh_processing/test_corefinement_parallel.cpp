@@ -0,0 +1,118 @@
+#include <CGAL/Exact_predicates_inexact_constructions_kernel.h>
+#include <CGAL/Surface_mesh.h>
+
+#include <CGAL/Polygon_mesh_processing/corefinement.h>
+#include <CGAL/Polygon_mesh_processing/transform.h>
+#include <CGAL/Aff_transformation_3.h>
+#include <CGAL/IO/polygon_mesh_io.h>
+#include <CGAL/Testsuite/canonical_faces.h>
+
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <cstdlib>
+#include <iostream>
+#include <optional>
+#include <string>
+#include <vector>
+
+typedef CGAL::Exact_predicates_inexact_constructions_kernel K;
+typedef K::Point_3 Point_3;
+typedef CGAL::Surface_mesh<Point_3> Mesh;
+
+namespace PMP = CGAL::Polygon_mesh_processing;
+
+// checks that two meshes are the same, up to the order of their elements
+void assert_equivalent(const Mesh& m1, const Mesh& m2)
+{
+  assert(CGAL::is_valid_polygon_mesh(m2));
+  assert(m1.number_of_vertices() == m2.number_of_vertices());
+  assert(m1.number_of_edges() == m2.number_of_edges());
+  assert(m1.number_of_faces() == m2.number_of_faces());
+  assert(CGAL::Testsuite::canonical_faces(m1) == CGAL::Testsuite::canonical_faces(m2));
+}
+
+template <typename ConcurrencyTag>
+std::array<bool, 4> boolean_operations(Mesh& tm1, Mesh& tm2, Mesh& out_union, Mesh& out_inter)
+{
+  std::array<std::optional<Mesh*>, 4> output;
+  output[PMP::Corefinement::UNION] = &out_union;
+  output[PMP::Corefinement::INTERSECTION] = &out_inter;
+  return PMP::corefine_and_compute_boolean_operations(tm1, tm2, output,
+                                                      CGAL::parameters::concurrency_tag(ConcurrencyTag()));
+}
+
+void test_boolean_operations(const Mesh& tm1, const Mesh& tm2)
+{
+  Mesh seq1 = tm1, seq2 = tm2, par1 = tm1, par2 = tm2;
+  Mesh seq_union, seq_inter, par_union, par_inter;
+
+  std::array<bool, 4> seq_res =
+    boolean_operations<CGAL::Sequential_tag>(seq1, seq2, seq_union, seq_inter);
+  std::array<bool, 4> par_res =
+    boolean_operations<CGAL::Parallel_if_available_tag>(par1, par2, par_union, par_inter);
+
+  assert(seq_res == par_res);
+  assert_equivalent(seq1, par1);
+  assert_equivalent(seq2, par2);
+  if(seq_res[PMP::Corefinement::UNION])
+    assert_equivalent(seq_union, par_union);
+  if(seq_res[PMP::Corefinement::INTERSECTION])
+    assert_equivalent(seq_inter, par_inter);
+
+  std::cout << "  union: " << seq_res[PMP::Corefinement::UNION] << " (" << seq_union.number_of_faces() << " faces)"
+            << ", intersection: " << seq_res[PMP::Corefinement::INTERSECTION]
+            << " (" << seq_inter.number_of_faces() << " faces)" << std::endl;
+}
+
+void test_corefine(const Mesh& tm1, const Mesh& tm2)
+{
+  Mesh seq1 = tm1, seq2 = tm2, par1 = tm1, par2 = tm2;
+
+  PMP::corefine(seq1, seq2);
+  PMP::corefine(par1, par2, CGAL::parameters::concurrency_tag(CGAL::Parallel_if_available_tag()));
+
+  assert_equivalent(seq1, par1);
+  assert_equivalent(seq2, par2);
+  std::cout << "  corefine: " << seq1.number_of_faces() << " and " << seq2.number_of_faces() << " faces" << std::endl;
+}
+
+void test(const Mesh& tm1, const Mesh& tm2)
+{
+  test_corefine(tm1, tm2);
+  test_boolean_operations(tm1, tm2);
+}
+
+Mesh read(const std::string& filename)
+{
+  Mesh m;
+  bool ok = CGAL::IO::read_polygon_mesh(filename, m);
+  assert(ok);
+  CGAL_USE(ok);
+  return m;
+}
+
+int main()
+{
+  // many intersections
+  std::cout << "elephant and sphere" << std::endl;
+  test(read(CGAL::data_file_path("meshes/elephant.off")), read(CGAL::data_file_path("meshes/sphere.off")));
+
+  // a mesh and a translated copy sharing coplanar faces
+  std::cout << "cube and translated cube" << std::endl;
+  Mesh cube = read(CGAL::data_file_path("meshes/cube-meshed.off"));
+  Mesh translated_cube = cube;
+  PMP::transform(K::Aff_transformation_3(CGAL::TRANSLATION, K::Vector_3(0.5, 0.5, 0)), translated_cube);
+  test(cube, translated_cube);
+
+  // coplanar triangles
+  for(const std::string& name : { "tr1", "tr2", "tr3", "tr4" })
+  {
+    std::cout << "coplanar triangles " << name << std::endl;
+    test(read("data-coref/coplanar_triangles/" + name + "-1.off"),
+         read("data-coref/coplanar_triangles/" + name + "-2.off"));
+  }
+
+  std::cout << "done" << std::endl;
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,131 @@
+#include <CGAL/Exact_predicates_inexact_constructions_kernel.h>
+#include <CGAL/Surface_mesh.h>
+#include <CGAL/Polyhedron_3.h>
+
+#include <CGAL/Polygon_mesh_processing/corefinement.h>
+#include <CGAL/Polygon_mesh_processing/measure.h>
+#include <CGAL/Polygon_mesh_processing/orientation.h>
+#include <CGAL/Polygon_mesh_processing/transform.h>
+#include <CGAL/Aff_transformation_3.h>
+#include <CGAL/IO/polygon_mesh_io.h>
+
+#include <cassert>
+#include <cmath>
+#include <cstdlib>
+#include <iostream>
+#include <vector>
+
+typedef CGAL::Exact_predicates_inexact_constructions_kernel K;
+
+namespace PMP = CGAL::Polygon_mesh_processing;
+
+// the union of the meshes computed by successive unions with `corefine_and_compute_union()`
+template <typename TriangleMesh>
+TriangleMesh pairwise_union(std::vector<TriangleMesh> meshes)
+{
+  TriangleMesh result = meshes[0];
+  for(std::size_t i=1; i<meshes.size(); ++i)
+  {
+    bool ok = PMP::corefine_and_compute_union(result, meshes[i], result);
+    assert(ok);
+    CGAL_USE(ok);
+  }
+  return result;
+}
+
+template <typename TriangleMesh, typename ConcurrencyTag>
+void test(const std::vector<TriangleMesh>& meshes)
+{
+  TriangleMesh reference = pairwise_union(meshes);
+
+  TriangleMesh result;
+  bool ok = PMP::corefine_and_compute_union_of_meshes(meshes, result,
+                                                      CGAL::parameters::concurrency_tag(ConcurrencyTag()));
+  assert(ok);
+  CGAL_USE(ok);
+
+  assert(CGAL::is_triangle_mesh(result));
+  assert(PMP::does_bound_a_volume(result));
+  const double expected_volume = CGAL::to_double(PMP::volume(reference));
+  const double volume = CGAL::to_double(PMP::volume(result));
+  std::cout << "  " << meshes.size() << " meshes, " << num_faces(result) << " faces, volume "
+            << volume << " (" << expected_volume << ")" << std::endl;
+  assert(std::abs(volume - expected_volume) < 1e-6 * expected_volume);
+}
+
+template <typename TriangleMesh>
+std::vector<TriangleMesh> translated_copies(const TriangleMesh& tm,
+                                            const std::vector<K::Vector_3>& translations)
+{
+  std::vector<TriangleMesh> meshes;
+  for(const K::Vector_3& t : translations)
+  {
+    meshes.push_back(tm);
+    PMP::transform(K::Aff_transformation_3(CGAL::TRANSLATION, t), meshes.back());
+  }
+  return meshes;
+}
+
+template <typename TriangleMesh, typename ConcurrencyTag>
+void test(const char* filename)
+{
+  TriangleMesh sphere;
+  bool ok = CGAL::IO::read_polygon_mesh(filename, sphere);
+  assert(ok);
+  CGAL_USE(ok);
+  CGAL::Bbox_3 bb = PMP::bbox(sphere);
+  const double size = bb.xmax() - bb.xmin();
+
+  // a sweep of overlapping copies
+  std::vector<K::Vector_3> translations;
+  for(int i=0; i<9; ++i)
+    translations.emplace_back(0.3 * size * i, 0.05 * size * (i % 3), 0);
+  std::cout << " sweep" << std::endl;
+  test<TriangleMesh, ConcurrencyTag>(translated_copies(sphere, translations));
+
+  // two groups of overlapping copies, far from each other, given in an interleaved order
+  translations.clear();
+  for(int i=0; i<4; ++i)
+  {
+    translations.emplace_back(0.5 * size * i, 0, 0);
+    translations.emplace_back(0.5 * size * i, 10 * size, 0);
+  }
+  std::cout << " two groups" << std::endl;
+  test<TriangleMesh, ConcurrencyTag>(translated_copies(sphere, translations));
+
+  // a copy inside another one, and a single mesh
+  std::vector<TriangleMesh> meshes(1, sphere);
+  meshes.push_back(sphere);
+  PMP::transform(K::Aff_transformation_3(CGAL::SCALING, 0.5), meshes.back());
+  std::cout << " nested" << std::endl;
+  test<TriangleMesh, ConcurrencyTag>(meshes);
+  meshes.pop_back();
+  std::cout << " single" << std::endl;
+  test<TriangleMesh, ConcurrencyTag>(meshes);
+
+  // no mesh
+  meshes.clear();
+  TriangleMesh result;
+  ok = PMP::corefine_and_compute_union_of_meshes(meshes, result);
+  assert(ok && is_empty(result));
+}
+
+int main(int argc, char** argv)
+{
+  const char* filename = (argc > 1) ? argv[1] : "data-coref/sphere.off";
+
+  typedef CGAL::Surface_mesh<K::Point_3> Surface_mesh;
+  typedef CGAL::Polyhedron_3<K> Polyhedron;
+
+  std::cout << "Surface_mesh" << std::endl;
+  test<Surface_mesh, CGAL::Sequential_tag>(filename);
+  std::cout << "Polyhedron_3" << std::endl;
+  test<Polyhedron, CGAL::Sequential_tag>(filename);
+#ifdef CGAL_LINKED_WITH_TBB
+  std::cout << "Surface_mesh in parallel" << std::endl;
+  test<Surface_mesh, CGAL::Parallel_tag>(filename);
+#endif
+
+  std::cout << "done" << std::endl;
+  return EXIT_SUCCESS;
+}
@@ -12,6 +12,7 @@
 #include <functional>
 #include <iostream>
 #include <string>
+#include <vector>
 
 #define ABS_ERROR 1e-6
 
@@ -124,6 +125,29 @@ void test_average_curvatures(std::string mesh_path,
   assert(passes_comparison(gaussian_curvature_avg, test_info.gaussian_curvature_avg, test_info.tolerance));
   assert(passes_comparison(principal_curvature_avg, test_info.principal_curvature_avg, test_info.tolerance));
 
+  // are curvatures computed in parallel the same as the ones computed sequentially?
+  // (the maps already have a value for each vertex, so that they can be written concurrently)
+  std::vector<Epic_kernel::FT> mean_curvatures, Gaussian_curvatures;
+  for (vertex_descriptor v : vertices(pmesh)) {
+    mean_curvatures.push_back(get(mean_curvature_map, v));
+    Gaussian_curvatures.push_back(get(gaussian_curvature_map, v));
+  }
+
+  PMP::interpolated_corrected_curvatures(
+    pmesh,
+    CGAL::parameters::ball_radius(test_info.expansion_radius)
+    .vertex_mean_curvature_map(mean_curvature_map)
+    .vertex_Gaussian_curvature_map(gaussian_curvature_map)
+    .concurrency_tag(CGAL::Parallel_if_available_tag())
+  );
+
+  std::size_t i = 0;
+  for (vertex_descriptor v : vertices(pmesh)) {
+    assert(get(mean_curvature_map, v) == mean_curvatures[i]);
+    assert(get(gaussian_curvature_map, v) == Gaussian_curvatures[i]);
+    ++i;
+  }
+
   Epic_kernel::FT new_mean_curvature_avg = 0, new_Gaussian_curvature_avg = 0, new_principal_curvature_avg = 0;
 
   for (vertex_descriptor v : vertices(pmesh)) {
@@ -0,0 +1,105 @@
+#include <CGAL/Exact_predicates_inexact_constructions_kernel.h>
+#include <CGAL/Surface_mesh.h>
+
+#include <CGAL/Polygon_mesh_processing/reorder_mesh_elements.h>
+#include <CGAL/boost/graph/Euler_operations.h>
+#include <CGAL/boost/graph/helpers.h>
+#include <CGAL/IO/polygon_mesh_io.h>
+#include <CGAL/Testsuite/canonical_faces.h>
+#include <CGAL/Testsuite/shuffle_polygon_mesh.h>
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <cstdlib>
+#include <iostream>
+#include <string>
+#include <vector>
+
+typedef CGAL::Exact_predicates_inexact_constructions_kernel K;
+typedef K::Point_3 Point_3;
+typedef CGAL::Surface_mesh<Point_3> Mesh;
+
+namespace PMP = CGAL::Polygon_mesh_processing;
+
+// the average distance between the indices of the vertices of an edge
+double average_index_gap(const Mesh& m)
+{
+  double sum = 0;
+  for(Mesh::Edge_index e : m.edges())
+    sum += std::abs(double(m.vertex(e, 0)) - double(m.vertex(e, 1)));
+  return sum / double(m.number_of_edges());
+}
+
+// the mesh of the file with its vertices and faces in a random order,
+// and some removed faces
+Mesh shuffled_mesh(const std::string& filename)
+{
+  Mesh m;
+  bool ok = CGAL::IO::read_polygon_mesh(filename, m);
+  assert(ok);
+  CGAL_USE(ok);
+
+  CGAL::Testsuite::shuffle_polygon_mesh(m);
+  for(int i=0; i<10; ++i)
+    CGAL::Euler::remove_face(m.halfedge(*std::next(m.faces().begin(), i * 7)), m);
+  return m;
+}
+
+template <typename ConcurrencyTag>
+void test(const std::string& filename, const PMP::Element_order order)
+{
+  Mesh m = shuffled_mesh(filename);
+  const std::vector<std::vector<Point_3> > faces = CGAL::Testsuite::canonical_faces(m);
+  const std::size_t nv = m.number_of_vertices(), ne = m.number_of_edges(), nf = m.number_of_faces();
+  const double gap = average_index_gap(m);
+
+  // a property that must follow its vertex
+  Mesh::Property_map<Mesh::Vertex_index, Point_3> copy = m.add_property_map<Mesh::Vertex_index, Point_3>("v:copy").first;
+  for(Mesh::Vertex_index v : m.vertices())
+    copy[v] = m.point(v);
+
+  PMP::reorder_mesh_elements(m, CGAL::parameters::element_order(order)
+                                                 .concurrency_tag(ConcurrencyTag()));
+
+  assert(CGAL::is_valid_polygon_mesh(m));
+  assert(!m.has_garbage());
+  assert(m.number_of_vertices() == nv && m.number_of_edges() == ne && m.number_of_faces() == nf);
+  assert(CGAL::Testsuite::canonical_faces(m) == faces);
+  for(Mesh::Vertex_index v : m.vertices())
+    assert(copy[v] == m.point(v));
+
+  std::cout << "  average index gap: " << gap << " -> " << average_index_gap(m) << std::endl;
+  assert(average_index_gap(m) < 0.1 * gap);
+}
+
+template <typename ConcurrencyTag>
+void test(const std::string& filename)
+{
+  std::cout << " Hilbert order" << std::endl;
+  test<ConcurrencyTag>(filename, PMP::HILBERT_ORDER);
+  std::cout << " reverse Cuthill-McKee order" << std::endl;
+  test<ConcurrencyTag>(filename, PMP::REVERSE_CUTHILL_MCKEE_ORDER);
+}
+
+int main(int argc, char** argv)
+{
+  const std::string filename = (argc > 1) ? argv[1] : CGAL::data_file_path("meshes/elephant.off");
+
+  std::cout << "Sequential" << std::endl;
+  test<CGAL::Sequential_tag>(filename);
+#ifdef CGAL_LINKED_WITH_TBB
+  std::cout << "Parallel" << std::endl;
+  test<CGAL::Parallel_tag>(filename);
+#endif
+
+  // default parameters on a mesh without garbage
+  Mesh m;
+  CGAL::IO::read_polygon_mesh(filename, m);
+  const std::size_t nf = m.number_of_faces();
+  PMP::reorder_mesh_elements(m);
+  assert(CGAL::is_valid_polygon_mesh(m) && m.number_of_faces() == nf);
+
+  std::cout << "done" << std::endl;
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,152 @@
+#include <CGAL/Exact_predicates_inexact_constructions_kernel.h>
+#include <CGAL/Surface_mesh.h>
+#include <CGAL/Polyhedron_3.h>
+
+#include <CGAL/Polygon_mesh_processing/triangulate_hole.h>
+#include <CGAL/Polygon_mesh_processing/border.h>
+#include <CGAL/boost/graph/helpers.h>
+#include <CGAL/IO/polygon_mesh_io.h>
+#include <CGAL/Testsuite/canonical_faces.h>
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <cstdlib>
+#include <iostream>
+#include <iterator>
+#include <vector>
+
+typedef CGAL::Exact_predicates_inexact_constructions_kernel K;
+typedef K::Point_3 Point_3;
+
+namespace PMP = CGAL::Polygon_mesh_processing;
+
+template <typename ConcurrencyTag, typename Mesh>
+std::size_t fill_all_holes(Mesh& mesh, std::size_t& nb_patch_faces)
+{
+  typedef typename boost::graph_traits<Mesh>::halfedge_descriptor halfedge_descriptor;
+  typedef typename boost::graph_traits<Mesh>::face_descriptor face_descriptor;
+
+  std::vector<halfedge_descriptor> holes;
+  PMP::extract_boundary_cycles(mesh, std::back_inserter(holes));
+
+  std::vector<face_descriptor> patch;
+  std::size_t nb_filled = PMP::triangulate_holes(mesh, holes,
+                                                 CGAL::parameters::face_output_iterator(std::back_inserter(patch))
+                                                                  .concurrency_tag(ConcurrencyTag()));
+  nb_patch_faces = patch.size();
+  return nb_filled;
+}
+
+template <typename Mesh>
+void test_shark(const Mesh& input)
+{
+  typedef typename boost::graph_traits<Mesh>::halfedge_descriptor halfedge_descriptor;
+
+  std::vector<halfedge_descriptor> holes;
+  PMP::extract_boundary_cycles(input, std::back_inserter(holes));
+  std::cout << "  " << holes.size() << " holes" << std::endl;
+  assert(holes.size() > 1);
+
+  // reference: holes filled one after the other
+  Mesh ref = input;
+  std::vector<halfedge_descriptor> ref_holes;
+  PMP::extract_boundary_cycles(ref, std::back_inserter(ref_holes));
+  std::size_t nb_ref_filled = 0, nb_ref_faces = 0;
+  for(halfedge_descriptor h : ref_holes)
+  {
+    std::size_t nb_faces = num_faces(ref);
+    PMP::triangulate_hole(ref, h);
+    if(num_faces(ref) != nb_faces)
+      ++nb_ref_filled;
+    nb_ref_faces += num_faces(ref) - nb_faces;
+  }
+
+  Mesh seq = input, par = input;
+  std::size_t nb_seq_faces = 0, nb_par_faces = 0;
+  std::size_t nb_seq_filled = fill_all_holes<CGAL::Sequential_tag>(seq, nb_seq_faces);
+  std::size_t nb_par_filled = fill_all_holes<CGAL::Parallel_if_available_tag>(par, nb_par_faces);
+  std::cout << "  " << nb_seq_filled << " holes filled with " << nb_seq_faces << " faces" << std::endl;
+
+  assert(nb_seq_filled == nb_ref_filled);
+  assert(nb_par_filled == nb_ref_filled);
+  assert(nb_seq_faces == nb_ref_faces);
+  assert(nb_par_faces == nb_ref_faces);
+  assert(CGAL::is_valid_polygon_mesh(seq));
+  assert(CGAL::is_valid_polygon_mesh(par));
+  assert(CGAL::Testsuite::canonical_faces(seq) == CGAL::Testsuite::canonical_faces(ref));
+  assert(CGAL::Testsuite::canonical_faces(par) == CGAL::Testsuite::canonical_faces(ref));
+}
+
+// a cup whose wavy rim is a hole with `n` vertices
+template <typename Mesh>
+Mesh cup(int n)
+{
+  typedef typename boost::graph_traits<Mesh>::vertex_descriptor vertex_descriptor;
+
+  Mesh m;
+  const double pi = 3.14159265358979323846;
+  std::vector<vertex_descriptor> bottom, top;
+  vertex_descriptor center = add_vertex(Point_3(0, 0, 0), m);
+  for(int i=0; i<n; ++i)
+  {
+    double a = 2 * pi * i / n;
+    bottom.push_back(add_vertex(Point_3(std::cos(a), std::sin(a), 0), m));
+    top.push_back(add_vertex(Point_3(std::cos(a), std::sin(a), 1 + 0.2 * std::sin(5 * a)), m));
+  }
+  for(int i=0; i<n; ++i)
+  {
+    int j = (i + 1) % n;
+    CGAL::Euler::add_face(std::vector<vertex_descriptor>{ center, bottom[j], bottom[i] }, m);
+    CGAL::Euler::add_face(std::vector<vertex_descriptor>{ bottom[i], bottom[j], top[j] }, m);
+    CGAL::Euler::add_face(std::vector<vertex_descriptor>{ bottom[i], top[j], top[i] }, m);
+  }
+  return m;
+}
+
+template <typename Mesh>
+void test_large_hole()
+{
+  typedef typename boost::graph_traits<Mesh>::halfedge_descriptor halfedge_descriptor;
+
+  Mesh seq = cup<Mesh>(150), par = seq;
+  halfedge_descriptor seq_h = *std::find_if(halfedges(seq).begin(), halfedges(seq).end(),
+                                            [&](halfedge_descriptor h){ return is_border(h, seq); });
+  halfedge_descriptor par_h = *std::find_if(halfedges(par).begin(), halfedges(par).end(),
+                                            [&](halfedge_descriptor h){ return is_border(h, par); });
+
+  // the cubic search space algorithm is the one that is run in parallel
+  PMP::triangulate_hole(seq, seq_h, CGAL::parameters::use_delaunay_triangulation(false));
+  PMP::triangulate_hole(par, par_h, CGAL::parameters::use_delaunay_triangulation(false)
+                                                     .concurrency_tag(CGAL::Parallel_if_available_tag()));
+
+  std::cout << "  " << num_faces(seq) << " faces" << std::endl;
+  assert(CGAL::is_closed(seq));
+  assert(CGAL::is_valid_polygon_mesh(par));
+  assert(CGAL::Testsuite::canonical_faces(seq) == CGAL::Testsuite::canonical_faces(par));
+}
+
+template <typename Mesh>
+void test()
+{
+  Mesh shark;
+  bool ok = CGAL::IO::read_polygon_mesh(CGAL::data_file_path("meshes/mech-holes-shark.off"), shark);
+  assert(ok);
+  CGAL_USE(ok);
+
+  std::cout << " many holes" << std::endl;
+  test_shark(shark);
+  std::cout << " large hole" << std::endl;
+  test_large_hole<Mesh>();
+}
+
+int main()
+{
+  std::cout << "Surface_mesh" << std::endl;
+  test<CGAL::Surface_mesh<Point_3> >();
+  std::cout << "Polyhedron_3" << std::endl;
+  test<CGAL::Polyhedron_3<K> >();
+
+  std::cout << "done" << std::endl;
+  return EXIT_SUCCESS;
+}
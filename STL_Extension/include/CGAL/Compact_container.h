@@ -139,6 +139,55 @@ struct Constant_size_policy
   }
 };
 
+// Same as Addition_size_policy, but the size of the blocks is bounded by the
+// largest number of elements that the allocator can provide in one call
+// (`max_size()`, minus the two boundary elements).
+template<unsigned int first_block_size_, unsigned int block_size_increment>
+struct Bounded_addition_size_policy
+{
+  static const unsigned int first_block_size = first_block_size_;
+
+  template<typename Compact_container>
+  static typename Compact_container::size_type max_block_size()
+  {
+    typedef typename Compact_container::allocator_type Allocator;
+    return std::allocator_traits<Allocator>::max_size(Allocator()) - 2;
+  }
+
+  template<typename Compact_container>
+  static void increase_size(Compact_container& cc)
+  {
+    cc.block_size = (std::min)(
+      typename Compact_container::size_type(cc.block_size + block_size_increment),
+      max_block_size<Compact_container>());
+  }
+
+  template<typename Compact_container>
+  static void get_index_and_block(typename Compact_container::size_type i,
+                                  typename Compact_container::size_type& index,
+                                  typename Compact_container::size_type& block)
+  {
+    typedef typename Compact_container::size_type ST;
+    const ST max_size = max_block_size<Compact_container>();
+    // number of blocks, and of elements, before the size of the blocks is bounded
+    const ST nb_growing = (max_size <= first_block_size_) ? 0 :
+      (max_size - first_block_size_ + block_size_increment - 1) / block_size_increment;
+    const ST nb_elements_growing =
+      nb_growing*first_block_size_ + (block_size_increment*nb_growing*(nb_growing-1))/2;
+
+    if ( i < nb_elements_growing )
+    {
+      Addition_size_policy<first_block_size_, block_size_increment>::
+        template get_index_and_block<Compact_container>(i, index, block);
+    }
+    else
+    {
+      block = nb_growing + (i - nb_elements_growing)/max_size;
+      index = ((i - nb_elements_growing)%max_size)+1;
+    }
+  }
+};
+
 // The following base class can be used to easily add a squattable pointer
 // to a class (maybe you lose a bit of compactness though).
 // TODO : Shouldn't adding these bits be done automatically and transparently,
@@ -268,6 +317,8 @@ public:
   template<unsigned int first_block_size_, unsigned int block_size_increment>
     friend struct Addition_size_policy;
   template<unsigned int k> friend struct Constant_size_policy;
+  template<unsigned int first_block_size_, unsigned int block_size_increment>
+    friend struct Bounded_addition_size_policy;
 
   explicit Compact_container(const Allocator &a = Allocator())
   : alloc(a)
@@ -173,6 +173,7 @@ CGAL_add_named_parameter(postprocess_regions_t, postprocess_regions, postprocess
 CGAL_add_named_parameter(sizing_function_t, sizing_function, sizing_function)
 CGAL_add_named_parameter(bbox_scaling_t, bbox_scaling, bbox_scaling)
 CGAL_add_named_parameter(weight_function_t, weight_function, weight_function)
+CGAL_add_named_parameter(element_order_t, element_order, element_order)
 CGAL_add_named_parameter(weight_limiting_t, weight_limiting, weight_limiting)
 CGAL_add_named_parameter(progressive_t, progressive, progressive)
 CGAL_add_named_parameter(tiling_t, tiling, tiling)
@@ -206,6 +207,9 @@ CGAL_add_named_parameter(callback_t, callback, callback)
 CGAL_add_named_parameter(sharpness_angle_t, sharpness_angle, sharpness_angle)
 CGAL_add_named_parameter(edge_sensitivity_t, edge_sensitivity, edge_sensitivity)
 CGAL_add_named_parameter(neighbor_radius_t, neighbor_radius, neighbor_radius)
+CGAL_add_named_parameter(use_hash_grid_t, use_hash_grid, use_hash_grid)
+CGAL_add_named_parameter(tile_size_t, tile_size, tile_size)
+CGAL_add_named_parameter(halo_size_t, halo_size, halo_size)
 CGAL_add_named_parameter(number_of_output_points_t, number_of_output_points, number_of_output_points)
 CGAL_add_named_parameter(size_t, size, size)
 CGAL_add_named_parameter(maximum_variation_t, maximum_variation, maximum_variation)
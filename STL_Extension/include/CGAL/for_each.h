@@ -128,6 +128,44 @@ void for_each (Range& range,
      typename std::iterator_traits<typename Range::iterator>::iterator_category());
 }
 
+namespace internal {
+
+template <typename Function>
+void for_each_index (const std::size_t n, const Function& functor, const Sequential_tag&)
+{
+  for (std::size_t i = 0; i != n; ++ i)
+    functor (i);
+}
+
+#ifdef CGAL_LINKED_WITH_TBB
+template <typename Function>
+void for_each_index (const std::size_t n, const Function& functor, const Parallel_tag&)
+{
+  tbb::parallel_for (tbb::blocked_range<std::size_t>(0, n),
+                     [&](const tbb::blocked_range<std::size_t>& r)
+                     {
+                       for (std::size_t i = r.begin(); i != r.end(); ++ i)
+                         functor (i);
+                     });
+}
+#endif
+
+// applies `functor` to all the integers of `[0, n)`, in parallel if
+// `ConcurrencyTag` is `Parallel_tag`. Unlike `CGAL::for_each()`, the
+// loop cannot be interrupted.
+template <typename ConcurrencyTag, typename Function>
+void for_each_index (const std::size_t n, const Function& functor)
+{
+#ifndef CGAL_LINKED_WITH_TBB
+  static_assert (!std::is_convertible<ConcurrencyTag, Parallel_tag>::value,
+                 "Parallel_tag is enabled but TBB is unavailable.");
+#endif
+
+  for_each_index (n, functor, ConcurrencyTag());
+}
+
+} // namespace internal
+
 } // namespace CGAL
 
 
@@ -0,0 +1,220 @@
+namespace CGAL {
+
+/*!
+\ingroup SearchClasses
+
+The class `Compact_kd_tree` defines a `k-d` tree with an implicit layout, meant
+for large point sets that do not change once the tree is built.
+
+Contrary to `Kd_tree`, the nodes are not allocated one by one and do not store
+pointers: each internal node splits its points at the median along the largest
+side of its box, so that all the leaves have the same depth and the same number
+of points, up to one, and the nodes are stored in a single vector in breadth-first
+order. An internal node only stores its cutting dimension and the extents of its
+children along this dimension.
+The points are reordered in the order of the leaves, and their coordinates are
+copied in one contiguous array per dimension, so that the distances from a query
+to all the points of a leaf are computed with loops on contiguous
+coordinates, which the compiler can vectorize.
+
+This uses less memory than a `Kd_tree` with `EnablePointsCache` set to `Tag_true`,
+while providing faster nearest neighbor queries.
+The neighbor queries are exact and use the Euclidean distance; the other distances
+and the approximate searches are only available with `Kd_tree`.
+
+\tparam Traits must be a model of the concept `SearchTraits`, for example
+`Search_traits_3<Simple_cartesian<double> >`.
+
+\sa `CGAL::Kd_tree<Traits, Splitter, UseExtendedNode, EnablePointsCache>`
+*/
+template< typename Traits >
+class Compact_kd_tree {
+public:
+
+/// \name Types
+/// @{
+
+/*!
+Dimension tag.
+*/
+typedef unspecified_type D;
+
+/*!
+Point class.
+*/
+typedef Traits::Point_d Point_d;
+
+/*!
+Number type.
+*/
+typedef Traits::FT FT;
+
+/*!
+A point and its squared distance to a query.
+*/
+typedef std::pair<Point_d, FT> Point_with_squared_distance;
+
+/*!
+Const iterator over the points of the tree.
+*/
+typedef unspecified_type iterator;
+
+/*!
+Const iterator over the points of the tree.
+*/
+typedef unspecified_type const_iterator;
+
+/*!
+Size type.
+*/
+typedef unspecified_type size_type;
+
+/// @}
+
+/// \name Creation
+/// @{
+
+/*!
+Constructs an empty tree whose leaves have at most `bucket_size` points.
+\pre `bucket_size >= 2`
+*/
+Compact_kd_tree(unsigned int bucket_size = 16, Traits t = Traits());
+
+/*!
+Constructs a tree on the elements from the sequence
+`[first, beyond)`, whose leaves have at most `bucket_size` points.
+The value type of the `InputIterator` must be `Point_d`.
+\pre `bucket_size >= 2`
+*/
+template <class InputIterator>
+Compact_kd_tree(InputIterator first, InputIterator beyond,
+                unsigned int bucket_size = 16, Traits t = Traits());
+
+/*!
+Constructs a tree on the elements of `points`, whose leaves have at most `bucket_size` points.
+The value type of elements in `PointRange` must be `Point_d`.
+\pre `bucket_size >= 2`
+*/
+template <class PointRange>
+Compact_kd_tree(const PointRange& points, unsigned int bucket_size = 16, Traits t = Traits());
+
+/*!
+As for `Kd_tree`, the constructor does not build the tree, and `build()`
+is called implicitly at the first query if it was not called before.
+
+\tparam ConcurrencyTag enables sequential versus parallel
+construction. Possible values are `Sequential_tag`, `Parallel_tag`, and
+`Parallel_if_available_tag`. This template parameter is optional:
+calling `build()` without specifying the concurrency tag will result
+in `Sequential_tag` being used, as well as the implicit call at the first query.
+*/
+template <typename ConcurrencyTag>
+void build();
+
+/*!
+Clears the internal data structure, which then gets rebuilt either by an
+explicit call to `build()` or implicitly by the next query.
+*/
+void invalidate_build();
+
+/// @}
+
+/// \name Operations
+/// @{
+
+/*!
+Inserts the point `p` in the tree. The next query, or a call to `build()`,
+triggers a rebuild of the whole tree.
+*/
+void insert(Point_d p);
+
+/*!
+Inserts the elements from the sequence `[first, beyond)` in the tree.
+The value type of the `InputIterator` must be `Point_d`.
+*/
+template <class InputIterator> void insert(InputIterator first, InputIterator beyond);
+
+/*!
+Removes all the points of the tree.
+*/
+void clear();
+
+/*!
+Writes in `out` the `k` nearest neighbors of `q` and their squared distances to `q`,
+as objects of type `Point_with_squared_distance`, sorted by increasing distance.
+`Traits::Construct_cartesian_const_iterator_d` must be callable on `QueryItem`,
+which is for example `Point_d`, or the key type of the point property map if
+`Traits` is a `Search_traits_adapter`.
+\pre `k <= size()`
+*/
+template <class QueryItem, class OutputIterator>
+OutputIterator k_nearest_neighbors(const QueryItem& q, unsigned int k, OutputIterator out) const;
+
+/*!
+Computes the `k` nearest neighbors of each element of `queries`. The neighbors of the
+`i`-th query, sorted by increasing distance, are written in `[neighbors + i*k, neighbors + (i+1)*k)`,
+and their squared distances to the query in `[squared_distances + i*k, squared_distances + (i+1)*k)`.
+The queries are processed in the order of the leaves containing them, as in
+`Kd_tree::k_nearest_neighbors()`.
+
+\tparam ConcurrencyTag enables sequential versus parallel
+algorithm. Possible values are `Sequential_tag`, `Parallel_tag`, and
+`Parallel_if_available_tag`.
+\tparam QueryRange a model of `ConstRange` whose value type can be a `QueryItem` of the function above.
+\tparam PointIterator a random access iterator with value type `Point_d`.
+\tparam FTIterator a random access iterator with value type `FT`.
+
+\pre `0 < k <= size()`
+*/
+template <class ConcurrencyTag = Sequential_tag, class QueryRange, class PointIterator, class FTIterator>
+void k_nearest_neighbors(const QueryRange& queries, unsigned int k,
+                         PointIterator neighbors, FTIterator squared_distances) const;
+
+/*!
+Reports the points that are approximately contained by `q`.
+The types `FuzzyQueryItem::Point_d` and `Point_d` must be equivalent.
+To use this function `Traits` must be a model of the concept `RangeSearchTraits`.
+*/
+template <class OutputIterator, class FuzzyQueryItem>
+OutputIterator search(OutputIterator it, FuzzyQueryItem q) const;
+
+/*!
+Returns a const iterator to the first point in the tree. Once the tree is
+built, the points are in the order of the leaves.
+*/
+const_iterator begin() const;
+
+/*!
+Returns the appropriate past-the-end const iterator.
+*/
+const_iterator end() const;
+
+/*!
+Returns the number of points stored in the tree.
+*/
+size_type size() const;
+
+/*!
+Returns whether the tree is empty.
+*/
+bool empty() const;
+
+/*!
+Returns the maximal number of points of a leaf.
+*/
+unsigned int bucket_size() const;
+
+/*!
+Returns a const reference to the bounding box of the points of the tree.
+*/
+const Kd_tree_rectangle<FT,D>& bounding_box() const;
+
+/*!
+Returns the traits.
+*/
+const Traits& traits() const;
+
+/// @}
+
+}; /* end Compact_kd_tree */
+} /* end namespace CGAL */
@@ -205,6 +205,39 @@ To use this function `Traits` must be a model of the concept `RangeSearchTraits`
 template <class OutputIterator, class FuzzyQueryItem>
 OutputIterator search(OutputIterator it, FuzzyQueryItem q) const;
 
+/*!
+Computes the `k` nearest neighbors of each point of `queries`, with an exact
+search using `distance`. The neighbors of the `i`-th query, sorted by increasing
+distance, are written in `[neighbors + i*k, neighbors + (i+1)*k)`, and their
+transformed distances to the query in
+`[transformed_distances + i*k, transformed_distances + (i+1)*k)`.
+
+The queries are processed in the order of the leaves of the tree that contain
+them, so that consecutive queries traverse the same nodes, and the buffers of the
+search are shared by consecutive queries.
+This is faster than using one `Orthogonal_k_neighbor_search` per query, in
+particular when the queries are the points of the tree.
+
+\tparam ConcurrencyTag enables sequential versus parallel
+algorithm. Possible values are `Sequential_tag`, `Parallel_tag`, and
+`Parallel_if_available_tag`. With `Parallel_tag`, the tree is built
+sequentially if it is not built yet; call `build<Parallel_tag>()` beforehand
+to build it in parallel.
+\tparam Distance a model of the concept `OrthogonalDistance`, with
+`Distance::Query_item` equivalent to `Point_d`. The default is the distance
+used by default by `Orthogonal_k_neighbor_search`.
+\tparam QueryRange a model of `ConstRange` whose value type is `Distance::Query_item`.
+\tparam PointIterator a random access iterator with value type `Point_d`.
+\tparam FTIterator a random access iterator with value type `FT`.
+
+\pre `0 < k <= size()`
+\pre `UseExtendedNode` is `Tag_true`.
+*/
+template <class ConcurrencyTag = Sequential_tag, class Distance, class QueryRange, class PointIterator, class FTIterator>
+void k_nearest_neighbors(const QueryRange& queries, unsigned int k,
+                         PointIterator neighbors, FTIterator transformed_distances,
+                         const Distance& distance = Distance()) const;
+
 /*!
 Returns a const iterator to the first point in the tree.
 \note Starting with \cgal 4.6, the order of the points in the iterator range
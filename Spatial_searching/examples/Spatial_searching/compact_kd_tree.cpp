@@ -0,0 +1,44 @@
+#include <CGAL/Simple_cartesian.h>
+#include <CGAL/point_generators_3.h>
+#include <CGAL/Search_traits_3.h>
+#include <CGAL/Compact_kd_tree.h>
+#include <CGAL/Fuzzy_sphere.h>
+
+#include <iostream>
+#include <iterator>
+#include <vector>
+
+typedef CGAL::Simple_cartesian<double> K;
+typedef K::Point_3 Point_3;
+typedef CGAL::Search_traits_3<K> Traits;
+typedef CGAL::Compact_kd_tree<Traits> Tree;
+
+int main()
+{
+  const unsigned int N = 10000;
+  const unsigned int k = 6;
+
+  std::vector<Point_3> points;
+  points.reserve(N);
+  std::copy_n(CGAL::Random_points_in_sphere_3<Point_3>(1.), N, std::back_inserter(points));
+
+  Tree tree(points);
+
+  // the k nearest neighbors of a single query
+  std::vector<Tree::Point_with_squared_distance> neighbors;
+  tree.k_nearest_neighbors(Point_3(0, 0, 0), k, std::back_inserter(neighbors));
+  for(const Tree::Point_with_squared_distance& n : neighbors)
+    std::cout << n.first << " at squared distance " << n.second << std::endl;
+
+  // the k nearest neighbors of all the points, k values per point
+  std::vector<Point_3> all_neighbors(points.size() * k);
+  std::vector<double> squared_distances(points.size() * k);
+  tree.k_nearest_neighbors(points, k, all_neighbors.begin(), squared_distances.begin());
+
+  // a range query
+  std::vector<Point_3> result;
+  tree.search(std::back_inserter(result), CGAL::Fuzzy_sphere<Traits>(Point_3(0, 0, 0), 0.2));
+  std::cout << result.size() << " points in the sphere" << std::endl;
+
+  return 0;
+}
@@ -0,0 +1,608 @@
+// Copyright (c) 2026 GeometryFactory (France).
+// All rights reserved.
+//
+// This file is part of CGAL (www.cgal.org).
+//
+// $URL$
+// $Id$
+// SPDX-License-Identifier: GPL-3.0-or-later OR LicenseRef-Commercial
+//
+//
+// Author(s)     : GeometryFactory
+
+#ifndef CGAL_COMPACT_KD_TREE_H
+#define CGAL_COMPACT_KD_TREE_H
+
+#include <CGAL/license/Spatial_searching.h>
+
+#include <CGAL/disable_warnings.h>
+
+#include <CGAL/assertions.h>
+#include <CGAL/Kd_tree_rectangle.h>
+#include <CGAL/Spatial_searching/internal/Get_dimension_tag.h>
+#include <CGAL/Spatial_searching/internal/K_neighbor_batch_search.h>
+#include <CGAL/tags.h>
+
+#include <boost/range/has_range_iterator.hpp>
+
+#ifdef CGAL_HAS_THREADS
+#include <CGAL/mutex.h>
+#endif
+
+#ifdef CGAL_LINKED_WITH_TBB
+#include <tbb/parallel_invoke.h>
+#endif
+
+#include <algorithm>
+#include <iterator>
+#include <memory>
+#include <numeric>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace CGAL {
+
+template <class SearchTraits>
+class Compact_kd_tree
+{
+public:
+  typedef SearchTraits Traits;
+  typedef typename SearchTraits::Point_d Point_d;
+  typedef typename SearchTraits::FT FT;
+  typedef typename std::vector<Point_d>::const_iterator iterator;
+  typedef typename std::vector<Point_d>::const_iterator const_iterator;
+  typedef typename std::vector<Point_d>::size_type size_type;
+  typedef typename internal::Get_dimension_tag<SearchTraits>::Dimension D;
+  typedef std::pair<Point_d, FT> Point_with_squared_distance;
+
+private:
+  typedef Compact_kd_tree<SearchTraits> Self;
+
+  // The nodes are not linked: the internal nodes are stored in a vector in
+  // breadth-first order, the children of the node `i` being the nodes `2i+1`
+  // and `2i+2`. Each node splits its points at the median of its cutting
+  // dimension, so that the range of points of a node follows from its
+  // position in the tree, and all the leaves have the same depth.
+  struct Node
+  {
+    FT lower_high; // largest coordinate of the lower child along the cutting dimension
+    FT upper_low;  // smallest coordinate of the upper child along the cutting dimension
+    int cutting_dimension;
+  };
+
+  SearchTraits traits_;
+  unsigned int bucket_size_;
+
+  // the points, in the order of the leaves
+  std::vector<Point_d> pts;
+  // the coordinates of the points, stored dimension by dimension: the
+  // `d`-th coordinate of the `i`-th point is `coords[d * size() + i]`
+  std::vector<FT> coords;
+  std::vector<Node> nodes;
+  std::unique_ptr<Kd_tree_rectangle<FT,D> > bbox;
+  // depth of the leaves
+  int depth_;
+  int dim_;
+
+  #ifdef CGAL_HAS_THREADS
+  mutable CGAL_MUTEX building_mutex;//mutex used to protect const calls inducing build()
+  #endif
+  bool built_;
+
+  const FT* coordinates(int d) const
+  {
+    return coords.data() + std::size_t(d) * pts.size();
+  }
+
+  // splits the points of the subtree of the node `n` at depth `depth`,
+  // which are the points `order[first]`, ..., `order[beyond-1]`; `box`
+  // contains the lower corner then the upper corner of a box enclosing them
+  template <typename ConcurrencyTag>
+  void build_node(std::size_t n, std::size_t first, std::size_t beyond, int depth,
+                  std::vector<FT> box,
+                  std::vector<std::size_t>& order, const std::vector<FT>& unsorted_coords)
+  {
+    if(depth == depth_)
+      return;
+
+    // the points are split along the largest side of the box
+    int cd = 0;
+    for(int d=1; d<dim_; ++d)
+      if(box[dim_+cd] - box[cd] < box[dim_+d] - box[d])
+        cd = d;
+
+    const FT* c = unsorted_coords.data() + std::size_t(cd) * pts.size();
+    const std::size_t middle = first + (beyond - first) / 2;
+    std::nth_element(order.begin() + first, order.begin() + middle, order.begin() + beyond,
+                     [c](std::size_t a, std::size_t b) { return c[a] < c[b]; });
+
+    Node& node = nodes[n];
+    node.cutting_dimension = cd;
+    node.upper_low = c[order[middle]];
+    node.lower_high = c[order[first]];
+    for(std::size_t i=first+1; i<middle; ++i)
+      node.lower_high = (std::max)(node.lower_high, c[order[i]]);
+
+    std::vector<FT> upper_box = box;
+    upper_box[cd] = node.upper_low;
+    box[dim_+cd] = node.lower_high;
+
+#ifdef CGAL_LINKED_WITH_TBB
+    // the children are split in parallel if both are internal nodes and
+    // if they have enough points to be worth the cost of a new task
+    if(std::is_convertible<ConcurrencyTag, Parallel_tag>::value &&
+       depth + 1 < depth_ && beyond - first > 10 * bucket_size_)
+    {
+      tbb::parallel_invoke([&] { build_node<ConcurrencyTag>(2*n+1, first, middle, depth+1, box, order, unsorted_coords); },
+                           [&] { build_node<ConcurrencyTag>(2*n+2, middle, beyond, depth+1, upper_box, order, unsorted_coords); });
+      return;
+    }
+#endif
+
+    build_node<ConcurrencyTag>(2*n+1, first, middle, depth+1, box, order, unsorted_coords);
+    build_node<ConcurrencyTag>(2*n+2, middle, beyond, depth+1, upper_box, order, unsorted_coords);
+  }
+
+  void const_build() const {
+    #ifdef CGAL_HAS_THREADS
+    //this ensure that build() will be called once
+    CGAL_SCOPED_LOCK(building_mutex);
+    if(!is_built())
+    #endif
+      const_cast<Self*>(this)->build();
+  }
+
+  // Searches the k nearest neighbors of successive queries, reusing its
+  // buffers from one query to the next.
+  class K_neighbor_search
+  {
+    typedef std::pair<std::size_t, FT> Index_with_squared_distance;
+
+    struct Distance_less
+    {
+      bool operator()(const Index_with_squared_distance& p1,
+                      const Index_with_squared_distance& p2) const
+      {
+        return p1.second < p2.second;
+      }
+    };
+
+    const Self& m_tree;
+    unsigned int m_k;
+    std::vector<FT> m_query;
+    std::vector<FT> m_dists;
+    std::vector<FT> m_leaf_distances;
+    // max-heap of the current neighbors, with at most `m_k` elements
+    std::vector<Index_with_squared_distance> m_heap;
+
+  public:
+    K_neighbor_search(const Self& tree, const unsigned int k)
+      : m_tree(tree), m_k(k),
+        m_query(tree.dim_), m_dists(tree.dim_),
+        m_leaf_distances(tree.max_leaf_size())
+    {
+      CGAL_precondition(k > 0);
+      m_heap.reserve(k);
+    }
+
+    // calls `out(i, d)` for the `k` nearest neighbors of `q`, sorted by
+    // increasing distance, with `i` the position of the neighbor in the
+    // tree and `d` its squared distance to `q`
+    template <class QueryItem, class Output>
+    void operator()(const QueryItem& q, const Output& out)
+    {
+      std::copy_n(m_tree.traits().construct_cartesian_const_iterator_d_object()(q),
+                  m_tree.dim_, m_query.begin());
+      m_heap.clear();
+
+      FT distance_to_root = FT(0);
+      for(int d=0; d<m_tree.dim_; ++d)
+      {
+        const FT val = m_query[d];
+        if(val < m_tree.bbox->min_coord(d))
+          m_dists[d] = m_tree.bbox->min_coord(d) - val;
+        else if(val > m_tree.bbox->max_coord(d))
+          m_dists[d] = val - m_tree.bbox->max_coord(d);
+        else
+          m_dists[d] = FT(0);
+        distance_to_root += m_dists[d] * m_dists[d];
+      }
+      search(0, 0, m_tree.size(), 0, distance_to_root);
+
+      std::sort_heap(m_heap.begin(), m_heap.end(), Distance_less());
+      for(const Index_with_squared_distance& n : m_heap)
+        out(n.first, n.second);
+    }
+
+  private:
+    bool is_full() const { return m_heap.size() == m_k; }
+
+    void search_in_leaf(const std::size_t first, const std::size_t beyond)
+    {
+      // The distances to the points of the leaf are computed one dimension
+      // at a time, on contiguous coordinates, so that the compiler can
+      // vectorize the inner loop.
+      const std::size_t s = beyond - first;
+      FT* dist = m_leaf_distances.data();
+      std::fill_n(dist, s, FT(0));
+      for(int d=0; d<m_tree.dim_; ++d)
+      {
+        const FT* c = m_tree.coordinates(d) + first;
+        const FT val = m_query[d];
+        for(std::size_t i=0; i<s; ++i)
+        {
+          const FT diff = c[i] - val;
+          dist[i] += diff * diff;
+        }
+      }
+
+      for(std::size_t i=0; i<s; ++i)
+      {
+        if(!is_full())
+        {
+          m_heap.emplace_back(first + i, dist[i]);
+          std::push_heap(m_heap.begin(), m_heap.end(), Distance_less());
+        }
+        else if(dist[i] < m_heap.front().second)
+        {
+          std::pop_heap(m_heap.begin(), m_heap.end(), Distance_less());
+          m_heap.back() = Index_with_squared_distance(first + i, dist[i]);
+          std::push_heap(m_heap.begin(), m_heap.end(), Distance_less());
+        }
+      }
+    }
+
+    void search(const std::size_t n, const std::size_t first, const std::size_t beyond,
+                const int depth, const FT rd)
+    {
+      if(depth == m_tree.depth_)
+      {
+        search_in_leaf(first, beyond);
+        return;
+      }
+
+      const Node& node = m_tree.nodes[n];
+      const std::size_t middle = first + (beyond - first) / 2;
+      const int cd = node.cutting_dimension;
+      const FT val = m_query[cd];
+      const FT diff1 = val - node.upper_low;
+      const FT diff2 = val - node.lower_high;
+      const bool lower_first = (diff1 + diff2 < FT(0));
+      const FT new_off = lower_first ? diff1 : diff2;
+
+      if(lower_first)
+        search(2*n+1, first, middle, depth+1, rd);
+      else
+        search(2*n+2, middle, beyond, depth+1, rd);
+
+      const FT dst = m_dists[cd];
+      const FT new_rd = rd - dst * dst + new_off * new_off;
+      if(!is_full() || new_rd < m_heap.front().second)
+      {
+        m_dists[cd] = new_off;
+        if(lower_first)
+          search(2*n+2, middle, beyond, depth+1, new_rd);
+        else
+          search(2*n+1, first, middle, depth+1, new_rd);
+        m_dists[cd] = dst;
+      }
+    }
+  };
+
+  // returns the position of the first point of the leaf containing `q`
+  template <class QueryItem>
+  std::size_t leaf_position(const QueryItem& q) const
+  {
+    typename SearchTraits::Cartesian_const_iterator_d query_it =
+      traits().construct_cartesian_const_iterator_d_object()(q);
+    std::size_t n = 0, first = 0, beyond = size();
+    for(int depth=0; depth<depth_; ++depth)
+    {
+      const Node& node = nodes[n];
+      const std::size_t middle = first + (beyond - first) / 2;
+      if(*(query_it + node.cutting_dimension) < node.upper_low)
+      {
+        n = 2*n+1;
+        beyond = middle;
+      }
+      else
+      {
+        n = 2*n+2;
+        first = middle;
+      }
+    }
+    return first;
+  }
+
+  template <class OutputIterator, class FuzzyQueryItem>
+  OutputIterator search(OutputIterator it, const FuzzyQueryItem& q,
+                        const std::size_t n, const std::size_t first, const std::size_t beyond,
+                        const int depth, Kd_tree_rectangle<FT,D>& b) const
+  {
+    if(depth == depth_)
+    {
+      for(std::size_t i=first; i<beyond; ++i)
+        if(q.contains(pts[i]))
+          *it++ = pts[i];
+      return it;
+    }
+
+    const Node& node = nodes[n];
+    const std::size_t middle = first + (beyond - first) / 2;
+    const int cd = node.cutting_dimension;
+
+    // after splitting b denotes the lower part of b
+    Kd_tree_rectangle<FT,D> b_upper(b);
+    b.upper()[cd] = node.lower_high;
+    b_upper.lower()[cd] = node.upper_low;
+
+    if(q.outer_range_contains(b))
+      it = std::copy(pts.begin() + first, pts.begin() + middle, it);
+    else if(q.inner_range_intersects(b))
+      it = search(it, q, 2*n+1, first, middle, depth+1, b);
+    if(q.outer_range_contains(b_upper))
+      it = std::copy(pts.begin() + middle, pts.begin() + beyond, it);
+    else if(q.inner_range_intersects(b_upper))
+      it = search(it, q, 2*n+2, middle, beyond, depth+1, b_upper);
+    return it;
+  }
+
+public:
+  Compact_kd_tree(unsigned int bucket_size = 16, const SearchTraits& traits = SearchTraits())
+    : traits_(traits), bucket_size_(bucket_size), depth_(0), dim_(0), built_(false)
+  {
+    CGAL_precondition(bucket_size >= 2);
+  }
+
+  template <class InputIterator>
+  Compact_kd_tree(InputIterator first, InputIterator beyond,
+                  unsigned int bucket_size = 16, const SearchTraits& traits = SearchTraits())
+    : traits_(traits), bucket_size_(bucket_size), pts(first, beyond),
+      depth_(0), dim_(0), built_(false)
+  {
+    CGAL_precondition(bucket_size >= 2);
+  }
+
+  template <class PointRange>
+  Compact_kd_tree(const PointRange& points,
+                  unsigned int bucket_size = 16, const SearchTraits& traits = SearchTraits(),
+                  std::enable_if_t<boost::has_range_const_iterator<PointRange>::value>* = nullptr)
+    : traits_(traits), bucket_size_(bucket_size),
+      pts(std::begin(points), std::end(points)),
+      depth_(0), dim_(0), built_(false)
+  {
+    CGAL_precondition(bucket_size >= 2);
+  }
+
+  bool empty() const
+  {
+    return pts.empty();
+  }
+
+  size_type size() const
+  {
+    return pts.size();
+  }
+
+  void build()
+  {
+    build<Sequential_tag>();
+  }
+
+  template <typename ConcurrencyTag>
+  void build()
+  {
+#ifndef CGAL_LINKED_WITH_TBB
+    static_assert (!std::is_convertible<ConcurrencyTag, Parallel_tag>::value,
+                   "Parallel_tag is enabled but TBB is unavailable.");
+#endif
+    CGAL_assertion(!is_built());
+    CGAL_assertion(!pts.empty());
+
+    typename SearchTraits::Construct_cartesian_const_iterator_d construct_it =
+      traits_.construct_cartesian_const_iterator_d_object();
+    const std::size_t size = pts.size();
+    dim_ = static_cast<int>(std::distance(construct_it(pts[0]), construct_it(pts[0], 0)));
+
+    std::vector<FT> unsorted_coords(std::size_t(dim_) * size);
+    for(std::size_t i=0; i<size; ++i)
+    {
+      typename SearchTraits::Cartesian_const_iterator_d it = construct_it(pts[i]);
+      for(int d=0; d<dim_; ++d, ++it)
+        unsorted_coords[std::size_t(d) * size + i] = *it;
+    }
+
+    std::vector<FT> box(2 * dim_);
+    bbox = std::make_unique<Kd_tree_rectangle<FT,D> >(dim_);
+    for(int d=0; d<dim_; ++d)
+    {
+      const FT* c = unsorted_coords.data() + std::size_t(d) * size;
+      const auto minmax = std::minmax_element(c, c + size);
+      box[d] = bbox->lower()[d] = *minmax.first;
+      box[dim_+d] = bbox->upper()[d] = *minmax.second;
+    }
+    bbox->set_max_span();
+
+    // the leaves have at most `bucket_size_` points
+    depth_ = 0;
+    while(((size - 1) >> depth_) + 1 > bucket_size_)
+      ++depth_;
+    nodes.resize((std::size_t(1) << depth_) - 1);
+
+    std::vector<std::size_t> order(size);
+    std::iota(order.begin(), order.end(), std::size_t(0));
+    build_node<ConcurrencyTag>(0, 0, size, 0, box, order, unsorted_coords);
+
+    // reorder the points and their coordinates for spatial locality
+    std::vector<Point_d> ptstmp;
+    ptstmp.reserve(size);
+    for(std::size_t i=0; i<size; ++i)
+      ptstmp.push_back(pts[order[i]]);
+    pts.swap(ptstmp);
+
+    coords.resize(unsorted_coords.size());
+    for(int d=0; d<dim_; ++d)
+    {
+      const FT* c = unsorted_coords.data() + std::size_t(d) * size;
+      FT* sorted_c = coords.data() + std::size_t(d) * size;
+      for(std::size_t i=0; i<size; ++i)
+        sorted_c[i] = c[order[i]];
+    }
+
+    built_ = true;
+  }
+
+  bool is_built() const
+  {
+    return built_;
+  }
+
+  void invalidate_build()
+  {
+    if(is_built())
+    {
+      nodes.clear();
+      coords.clear();
+      bbox.reset();
+      built_ = false;
+    }
+  }
+
+  void clear()
+  {
+    invalidate_build();
+    pts.clear();
+  }
+
+  void insert(const Point_d& p)
+  {
+    invalidate_build();
+    pts.push_back(p);
+  }
+
+  template <class InputIterator>
+  void insert(InputIterator first, InputIterator beyond)
+  {
+    invalidate_build();
+    pts.insert(pts.end(), first, beyond);
+  }
+
+  void reserve(size_t size)
+  {
+    pts.reserve(size);
+  }
+
+  // Only correct when build() has been called
+  int dim() const
+  {
+    return dim_;
+  }
+
+  unsigned int bucket_size() const
+  {
+    return bucket_size_;
+  }
+
+  // Only correct when build() has been called
+  std::size_t max_leaf_size() const
+  {
+    return pts.empty() ? 0 : ((pts.size() - 1) >> depth_) + 1;
+  }
+
+  template <class QueryItem, class OutputIterator>
+  OutputIterator
+  k_nearest_neighbors(const QueryItem& q, unsigned int k, OutputIterator it) const
+  {
+    if(pts.empty())
+      return it;
+    if(!is_built())
+      const_build();
+    CGAL_precondition(k <= size());
+
+    K_neighbor_search search(*this, k);
+    search(q, [this, &it](std::size_t i, const FT& d) { *it++ = Point_with_squared_distance(pts[i], d); });
+    return it;
+  }
+
+  template <class ConcurrencyTag = Sequential_tag,
+            class QueryRange, class PointIterator, class FTIterator>
+  void
+  k_nearest_neighbors(const QueryRange& queries, unsigned int k,
+                      PointIterator neighbors, FTIterator squared_distances) const
+  {
+    typedef typename std::iterator_traits<decltype(std::begin(queries))>::value_type Query_item;
+
+    const std::vector<Query_item> points(std::begin(queries), std::end(queries));
+    if(points.empty())
+      return;
+    if(!is_built())
+      const_build();
+    CGAL_precondition(k > 0 && k <= size());
+
+    internal::for_each_query_in_tree_order<ConcurrencyTag>(
+      points,
+      [this](const Query_item& q) { return leaf_position(q); },
+      [&]()
+      {
+        return [this, search = K_neighbor_search(*this, k),
+                neighbors, squared_distances, k](const Query_item& q, const std::size_t id) mutable
+        {
+          PointIterator nit = neighbors + id*k;
+          FTIterator dit = squared_distances + id*k;
+          search(q, [this, &nit, &dit](std::size_t i, const FT& d) { *nit++ = pts[i]; *dit++ = d; });
+        };
+      });
+  }
+
+  template <class OutputIterator, class FuzzyQueryItem>
+  OutputIterator
+  search(OutputIterator it, const FuzzyQueryItem& q) const
+  {
+    if(!pts.empty()){
+
+      if(!is_built()){
+        const_build();
+      }
+      Kd_tree_rectangle<FT,D> b(*bbox);
+      if(q.outer_range_contains(b))
+        return std::copy(pts.begin(), pts.end(), it);
+      if(q.inner_range_intersects(b))
+        return search(it, q, 0, 0, size(), 0, b);
+    }
+    return it;
+  }
+
+  const SearchTraits&
+  traits() const
+  {
+    return traits_;
+  }
+
+  const Kd_tree_rectangle<FT,D>&
+  bounding_box() const
+  {
+    if(!is_built()){
+      const_build();
+    }
+    return *bbox;
+  }
+
+  const_iterator
+  begin() const
+  {
+    return pts.begin();
+  }
+
+  const_iterator
+  end() const
+  {
+    return pts.end();
+  }
+};
+
+} // namespace CGAL
+
+#include <CGAL/enable_warnings.h>
+
+#endif // CGAL_COMPACT_KD_TREE_H
@@ -29,6 +29,9 @@
 #include <CGAL/Kd_tree_node.h>
 #include <CGAL/Splitters.h>
 #include <CGAL/Spatial_searching/internal/Get_dimension_tag.h>
+#include <CGAL/Spatial_searching/internal/K_neighbor_batch_search.h>
+#include <CGAL/Euclidean_distance.h>
+#include <CGAL/tags.h>
 
 #include <boost/container/deque.hpp>
 #include <optional>
@@ -603,6 +606,18 @@ public:
   }
 
 
+  template <class ConcurrencyTag = Sequential_tag,
+            class Distance = typename internal::Spatial_searching_default_distance<SearchTraits>::type,
+            class QueryRange, class PointIterator, class FTIterator>
+  void
+  k_nearest_neighbors(const QueryRange& queries, unsigned int k,
+                      PointIterator neighbors, FTIterator transformed_distances,
+                      const Distance& distance = Distance()) const
+  {
+    internal::k_nearest_neighbors<ConcurrencyTag>(*this, queries, k, neighbors, transformed_distances, distance);
+  }
+
+
   template <class FuzzyQueryItem>
   std::optional<Point_d>
   search_any_point(const FuzzyQueryItem& q) const
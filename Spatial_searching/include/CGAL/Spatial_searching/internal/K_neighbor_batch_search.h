@@ -0,0 +1,304 @@
+// Copyright (c) 2026 GeometryFactory (France).
+// All rights reserved.
+//
+// This file is part of CGAL (www.cgal.org).
+//
+// $URL$
+// $Id$
+// SPDX-License-Identifier: GPL-3.0-or-later OR LicenseRef-Commercial
+//
+//
+// Author(s)     : GeometryFactory
+
+#ifndef CGAL_INTERNAL_K_NEIGHBOR_BATCH_SEARCH_H
+#define CGAL_INTERNAL_K_NEIGHBOR_BATCH_SEARCH_H
+
+#include <CGAL/license/Spatial_searching.h>
+
+#include <CGAL/Spatial_searching/internal/Search_helpers.h>
+#include <CGAL/assertions.h>
+#include <CGAL/tags.h>
+
+#ifdef CGAL_LINKED_WITH_TBB
+#include <tbb/blocked_range.h>
+#include <tbb/parallel_for.h>
+#endif
+
+#include <algorithm>
+#include <iterator>
+#include <numeric>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace CGAL {
+namespace internal {
+
+// Searches the k nearest neighbors of successive queries in a Kd_tree.
+// It follows the same traversal as `Orthogonal_k_neighbor_search` with an
+// exact search (`eps = 0`), but the buffers (the heap of the current
+// neighbors and the offsets to the query) are allocated once and reused
+// by all the queries handled by a searcher.
+template <class Tree, class Distance>
+class K_neighbor_batch_search
+{
+  typedef typename Tree::Traits                   SearchTraits;
+  typedef typename Tree::Point_d                  Point_d;
+  typedef typename Tree::FT                       FT;
+  typedef typename Tree::Node_const_handle        Node_const_handle;
+  typedef typename Tree::Leaf_node_const_handle   Leaf_node_const_handle;
+  typedef typename Tree::Internal_node_const_handle Internal_node_const_handle;
+  typedef typename Distance::Query_item           Query_item;
+  typedef std::pair<const Point_d*, FT>           Point_ptr_with_transformed_distance;
+
+  struct Distance_less
+  {
+    bool operator()(const Point_ptr_with_transformed_distance& p1,
+                    const Point_ptr_with_transformed_distance& p2) const
+    {
+      return p1.second < p2.second;
+    }
+  };
+
+  const Tree& m_tree;
+  const unsigned int m_k;
+  const Distance m_distance;
+  Distance_helper<Distance, SearchTraits> m_distance_helper;
+  int m_dim;
+
+  // the query being processed
+  const Query_item* m_query;
+  typename SearchTraits::Cartesian_const_iterator_d m_query_it;
+  std::vector<FT> m_dists;
+  // max-heap of the current neighbors, with at most `m_k` elements
+  std::vector<Point_ptr_with_transformed_distance> m_heap;
+
+public:
+  K_neighbor_batch_search(const Tree& tree, const unsigned int k, const Distance& distance)
+    : m_tree(tree), m_k(k), m_distance(distance),
+      m_distance_helper(m_distance, tree.traits()), m_dim(tree.dim())
+  {
+    CGAL_precondition(k > 0);
+    m_dists.resize(m_dim);
+    m_heap.reserve(k);
+  }
+
+  // writes the `k` nearest neighbors of `q` sorted by increasing distance,
+  // and their transformed distances to `q`
+  template <class PointIterator, class FTIterator>
+  void operator()(const Query_item& q, PointIterator neighbors, FTIterator transformed_distances)
+  {
+    m_query = &q;
+    m_query_it = m_tree.traits().construct_cartesian_const_iterator_d_object()(q);
+    std::fill(m_dists.begin(), m_dists.end(), FT(0));
+    m_heap.clear();
+
+    const FT distance_to_root = m_distance.min_distance_to_rectangle(q, m_tree.bounding_box(), m_dists);
+    search(m_tree.root(), distance_to_root);
+
+    std::sort_heap(m_heap.begin(), m_heap.end(), Distance_less());
+    for(const Point_ptr_with_transformed_distance& n : m_heap)
+    {
+      *neighbors++ = *(n.first);
+      *transformed_distances++ = n.second;
+    }
+  }
+
+private:
+  bool is_full() const { return m_heap.size() == m_k; }
+
+  void insert(const Point_d* p, const FT d)
+  {
+    if(!is_full())
+    {
+      m_heap.emplace_back(p, d);
+      std::push_heap(m_heap.begin(), m_heap.end(), Distance_less());
+    }
+    else if(d < m_heap.front().second)
+    {
+      std::pop_heap(m_heap.begin(), m_heap.end(), Distance_less());
+      m_heap.back() = Point_ptr_with_transformed_distance(p, d);
+      std::push_heap(m_heap.begin(), m_heap.end(), Distance_less());
+    }
+  }
+
+  // With cache
+  void search_in_leaf(Leaf_node_const_handle node, Tag_true)
+  {
+    typename Tree::iterator it = node->begin(), end = node->end();
+    typename std::vector<FT>::const_iterator cache_begin = m_tree.cache_begin() + m_dim*(it - m_tree.begin());
+    for(; it != end; ++it, cache_begin += m_dim)
+    {
+      const FT d = is_full()
+                   ? m_distance_helper.interruptible_transformed_distance(*m_query, *it, cache_begin,
+                                                                          cache_begin + m_dim, m_heap.front().second)
+                   : m_distance_helper.transformed_distance_from_coordinates(*m_query, *it, cache_begin,
+                                                                             cache_begin + m_dim);
+      insert(&(*it), d);
+    }
+  }
+
+  // Without cache
+  void search_in_leaf(Leaf_node_const_handle node, Tag_false)
+  {
+    for(typename Tree::iterator it = node->begin(), end = node->end(); it != end; ++it)
+    {
+      const FT d = is_full()
+                   ? m_distance_helper.interruptible_transformed_distance(*m_query, *it, m_heap.front().second)
+                   : m_distance.transformed_distance(*m_query, *it);
+      insert(&(*it), d);
+    }
+  }
+
+  void search(Node_const_handle n, const FT rd)
+  {
+    if(n->is_leaf())
+    {
+      Leaf_node_const_handle node = static_cast<Leaf_node_const_handle>(n);
+      if(node->size() > 0)
+      {
+        typename internal::Has_points_cache<Tree, internal::has_Enable_points_cache<Tree>::type::value>::type dummy;
+        search_in_leaf(node, dummy);
+      }
+      return;
+    }
+
+    Internal_node_const_handle node = static_cast<Internal_node_const_handle>(n);
+    const int new_cut_dim = node->cutting_dimension();
+    const FT val = *(m_query_it + new_cut_dim);
+    const FT diff1 = val - node->upper_low_value();
+    const FT diff2 = val - node->lower_high_value();
+    Node_const_handle best_child, other_child;
+    FT new_off;
+    if(diff1 + diff2 < FT(0))
+    {
+      new_off = diff1;
+      best_child = node->lower();
+      other_child = node->upper();
+    }
+    else
+    {
+      new_off = diff2;
+      best_child = node->upper();
+      other_child = node->lower();
+    }
+
+    search(best_child, rd);
+    const FT dst = m_dists[new_cut_dim];
+    const FT new_rd = m_distance.new_distance(rd, dst, new_off, new_cut_dim);
+    m_dists[new_cut_dim] = new_off;
+    if(!is_full() || new_rd < m_heap.front().second)
+      search(other_child, new_rd);
+    m_dists[new_cut_dim] = dst;
+  }
+};
+
+// returns the position, in the points of the tree, of the first point of the
+// leaf that contains `q`, so that close queries get close positions
+template <class Tree, class Query_item>
+std::size_t kd_tree_leaf_position(const Tree& tree, const Query_item& q)
+{
+  typename Tree::Traits::Cartesian_const_iterator_d query_it =
+    tree.traits().construct_cartesian_const_iterator_d_object()(q);
+  typename Tree::Node_const_handle n = tree.root();
+  while(!n->is_leaf())
+  {
+    typename Tree::Internal_node_const_handle node =
+      static_cast<typename Tree::Internal_node_const_handle>(n);
+    const typename Tree::FT val = *(query_it + node->cutting_dimension());
+    n = (val < node->cutting_value()) ? node->lower() : node->upper();
+  }
+  return static_cast<typename Tree::Leaf_node_const_handle>(n)->begin() - tree.begin();
+}
+
+// Calls `search(points[id], id)` for all the queries, with `search` a
+// functor returned by `make_searcher()`. The queries are processed in the
+// order of `position(points[id])`, so that successive queries visit the
+// same nodes of the tree, by blocks of consecutive queries sharing the
+// same functor, and the blocks are processed in parallel with `Parallel_tag`.
+template <class ConcurrencyTag, class Query_item, class Position, class Make_searcher>
+void for_each_query_in_tree_order(const std::vector<Query_item>& points,
+                                  const Position& position,
+                                  const Make_searcher& make_searcher)
+{
+#ifndef CGAL_LINKED_WITH_TBB
+  static_assert (!std::is_convertible<ConcurrencyTag, Parallel_tag>::value,
+                 "Parallel_tag is enabled but TBB is unavailable.");
+#endif
+
+  std::vector<std::size_t> positions(points.size());
+  std::vector<std::size_t> order(points.size());
+  std::iota(order.begin(), order.end(), std::size_t(0));
+
+#ifdef CGAL_LINKED_WITH_TBB
+  if(std::is_convertible<ConcurrencyTag, Parallel_tag>::value)
+  {
+    // number of consecutive queries handled by a searcher
+    const std::size_t block_size = 256;
+
+    tbb::parallel_for(tbb::blocked_range<std::size_t>(0, points.size()),
+                      [&](const tbb::blocked_range<std::size_t>& r)
+                      {
+                        for(std::size_t i=r.begin(); i!=r.end(); ++i)
+                          positions[i] = position(points[i]);
+                      });
+    std::sort(order.begin(), order.end(),
+              [&](std::size_t a, std::size_t b) { return positions[a] < positions[b]; });
+
+    tbb::parallel_for(tbb::blocked_range<std::size_t>(0, points.size(), block_size),
+                      [&](const tbb::blocked_range<std::size_t>& r)
+                      {
+                        auto search = make_searcher();
+                        for(std::size_t i=r.begin(); i!=r.end(); ++i)
+                          search(points[order[i]], order[i]);
+                      });
+    return;
+  }
+#endif
+
+  for(std::size_t i=0; i<points.size(); ++i)
+    positions[i] = position(points[i]);
+  std::sort(order.begin(), order.end(),
+            [&](std::size_t a, std::size_t b) { return positions[a] < positions[b]; });
+
+  auto search = make_searcher();
+  for(const std::size_t id : order)
+    search(points[id], id);
+}
+
+template <class ConcurrencyTag, class Tree, class Distance,
+          class QueryRange, class PointIterator, class FTIterator>
+void k_nearest_neighbors(const Tree& tree,
+                         const QueryRange& queries,
+                         const unsigned int k,
+                         PointIterator neighbors,
+                         FTIterator transformed_distances,
+                         const Distance& distance)
+{
+  typedef typename Distance::Query_item Query_item;
+
+  const std::vector<Query_item> points(std::begin(queries), std::end(queries));
+  if(points.empty())
+    return;
+  CGAL_precondition(k > 0 && k <= tree.size());
+
+  // builds the tree before the parallel section
+  tree.root();
+
+  for_each_query_in_tree_order<ConcurrencyTag>(
+    points,
+    [&tree](const Query_item& q) { return kd_tree_leaf_position(tree, q); },
+    [&]()
+    {
+      return [search = K_neighbor_batch_search<Tree, Distance>(tree, k, distance),
+              neighbors, transformed_distances, k](const Query_item& q, const std::size_t id) mutable
+      {
+        search(q, neighbors + id*k, transformed_distances + id*k);
+      };
+    });
+}
+
+} // namespace internal
+} // namespace CGAL
+
+#endif // CGAL_INTERNAL_K_NEIGHBOR_BATCH_SEARCH_H
@@ -0,0 +1,170 @@
+#include <CGAL/Simple_cartesian.h>
+#include <CGAL/Cartesian_d.h>
+#include <CGAL/point_generators_3.h>
+#include <CGAL/point_generators_d.h>
+#include <CGAL/Search_traits_3.h>
+#include <CGAL/Search_traits_adapter.h>
+#include <CGAL/Orthogonal_k_neighbor_search.h>
+#include <CGAL/Compact_kd_tree.h>
+#include <CGAL/Fuzzy_sphere.h>
+#include <CGAL/Fuzzy_iso_box.h>
+#include <CGAL/property_map.h>
+#include <CGAL/Random.h>
+
+#include <algorithm>
+#include <cassert>
+#include <iostream>
+#include <iterator>
+#include <utility>
+#include <vector>
+
+typedef CGAL::Simple_cartesian<double>                                   K;
+typedef K::Point_3                                                       Point;
+typedef CGAL::Search_traits_3<K>                                         Traits;
+
+typedef std::pair<Point, int>                                            Point_with_index;
+typedef CGAL::First_of_pair_property_map<Point_with_index>               Ppmap;
+typedef CGAL::Search_traits_adapter<Point_with_index, Ppmap, Traits>     Traits_with_index;
+
+typedef CGAL::Cartesian_d<double>                                        Kernel_d;
+typedef Kernel_d::Point_d                                                Point_d;
+
+// checks the neighbors computed by the compact tree against `Orthogonal_k_neighbor_search`
+template <class ConcurrencyTag, class SearchTraits, class PointRange, class QueryRange>
+void test_k_neighbors(const PointRange& points, const QueryRange& queries,
+                      const unsigned int k, const unsigned int bucket_size)
+{
+  typedef typename SearchTraits::Point_d Point_d;
+  typedef CGAL::Orthogonal_k_neighbor_search<SearchTraits> K_search;
+  typedef CGAL::Compact_kd_tree<SearchTraits> Compact_tree;
+
+  typename K_search::Tree tree(points.begin(), points.end());
+  Compact_tree compact_tree(points, bucket_size);
+  compact_tree.template build<ConcurrencyTag>();
+  assert(compact_tree.size() == points.size());
+  assert(compact_tree.max_leaf_size() <= bucket_size);
+
+  std::vector<Point_d> neighbors(queries.size() * k);
+  std::vector<double> distances(queries.size() * k);
+  compact_tree.template k_nearest_neighbors<ConcurrencyTag>(queries, k, neighbors.begin(), distances.begin());
+
+  for(std::size_t i=0; i<queries.size(); ++i)
+  {
+    std::vector<typename Compact_tree::Point_with_squared_distance> single;
+    compact_tree.k_nearest_neighbors(queries[i], k, std::back_inserter(single));
+    assert(single.size() == k);
+
+    K_search search(tree, queries[i], k);
+    std::size_t j = 0;
+    for(const auto& pwd : search)
+    {
+      // ties might be reported in another order, so only distances are compared
+      assert(CGAL::abs(distances[i*k + j] - pwd.second) <= 1e-12);
+      assert(single[j].second == distances[i*k + j]);
+      if(j > 0)
+        assert(distances[i*k + j - 1] <= distances[i*k + j]);
+      ++j;
+    }
+    assert(j == k);
+  }
+}
+
+template <class ConcurrencyTag>
+void test_all(const std::vector<Point>& points, const std::vector<Point>& queries)
+{
+  for(unsigned int bucket_size : {2u, 5u, 16u, 64u})
+  {
+    for(unsigned int k : {1u, 6u, 20u})
+    {
+      test_k_neighbors<ConcurrencyTag, Traits>(points, queries, k, bucket_size);
+      test_k_neighbors<ConcurrencyTag, Traits>(points, points, k, bucket_size);
+    }
+  }
+
+  // small trees
+  for(std::size_t n : {1, 2, 3, 17, 33})
+  {
+    std::vector<Point> small(points.begin(), points.begin() + n);
+    test_k_neighbors<ConcurrencyTag, Traits>(small, queries, 1, 2);
+    test_k_neighbors<ConcurrencyTag, Traits>(small, queries, static_cast<unsigned int>(n), 4);
+  }
+
+  // duplicated points
+  std::vector<Point> duplicates(100, points.front());
+  duplicates.insert(duplicates.end(), points.begin(), points.begin() + 100);
+  test_k_neighbors<ConcurrencyTag, Traits>(duplicates, queries, 10, 8);
+
+  // points with information
+  std::vector<Point_with_index> points_with_index;
+  for(std::size_t i=0; i<points.size(); ++i)
+    points_with_index.emplace_back(points[i], int(i));
+  test_k_neighbors<ConcurrencyTag, Traits_with_index>(points_with_index, queries, 10, 16);
+
+  // range queries
+  CGAL::Compact_kd_tree<Traits> compact_tree(points);
+  CGAL::Kd_tree<Traits> tree(points);
+  for(std::size_t i=0; i<20; ++i)
+  {
+    CGAL::Fuzzy_sphere<Traits> sphere(queries[i], 0.3);
+    std::vector<Point> result, reference;
+    compact_tree.search(std::back_inserter(result), sphere);
+    tree.search(std::back_inserter(reference), sphere);
+    std::sort(result.begin(), result.end());
+    std::sort(reference.begin(), reference.end());
+    assert(result == reference);
+
+    CGAL::Fuzzy_iso_box<Traits> box(queries[i], queries[i] + K::Vector_3(0.5, 0.5, 0.5));
+    result.clear();
+    reference.clear();
+    compact_tree.search(std::back_inserter(result), box);
+    tree.search(std::back_inserter(reference), box);
+    std::sort(result.begin(), result.end());
+    std::sort(reference.begin(), reference.end());
+    assert(result == reference);
+  }
+  CGAL::Fuzzy_iso_box<Traits> all(Point(-2, -2, -2), Point(2, 2, 2));
+  std::vector<Point> result;
+  compact_tree.search(std::back_inserter(result), all);
+  assert(result.size() == points.size());
+
+  // tree filled after its construction from a bucket size
+  CGAL::Compact_kd_tree<Traits> filled_tree(32);
+  filled_tree.insert(points.begin(), points.end());
+  filled_tree.template build<ConcurrencyTag>();
+  assert(filled_tree.size() == points.size());
+  assert(filled_tree.max_leaf_size() <= 32);
+  result.clear();
+  filled_tree.search(std::back_inserter(result), all);
+  assert(result.size() == points.size());
+}
+
+// points in dimension 5
+template <class ConcurrencyTag>
+void test_d()
+{
+  CGAL::Random_points_in_cube_d<Point_d> gen(5, 1.);
+  std::vector<Point_d> points, queries;
+  std::copy_n(gen, 2000, std::back_inserter(points));
+  std::copy_n(gen, 200, std::back_inserter(queries));
+  test_k_neighbors<ConcurrencyTag, Kernel_d>(points, queries, 8, 16);
+}
+
+int main()
+{
+  CGAL::Random rand(4);
+  std::vector<Point> points, queries;
+  std::copy_n(CGAL::Random_points_in_sphere_3<Point>(1., rand), 3000, std::back_inserter(points));
+  std::copy_n(CGAL::Random_points_in_cube_3<Point>(1.2, rand), 300, std::back_inserter(queries));
+
+  std::cout << "Sequential_tag" << std::endl;
+  test_all<CGAL::Sequential_tag>(points, queries);
+  test_d<CGAL::Sequential_tag>();
+#ifdef CGAL_LINKED_WITH_TBB
+  std::cout << "Parallel_tag" << std::endl;
+  test_all<CGAL::Parallel_tag>(points, queries);
+  test_d<CGAL::Parallel_tag>();
+#endif
+
+  std::cout << "done" << std::endl;
+  return EXIT_SUCCESS;
+}
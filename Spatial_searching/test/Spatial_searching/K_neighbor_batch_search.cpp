@@ -0,0 +1,111 @@
+#include <CGAL/Simple_cartesian.h>
+#include <CGAL/point_generators_3.h>
+#include <CGAL/Search_traits_3.h>
+#include <CGAL/Search_traits_adapter.h>
+#include <CGAL/Orthogonal_k_neighbor_search.h>
+#include <CGAL/property_map.h>
+#include <CGAL/Random.h>
+
+#include <algorithm>
+#include <cassert>
+#include <iostream>
+#include <iterator>
+#include <utility>
+#include <vector>
+
+typedef CGAL::Simple_cartesian<double>                                   K;
+typedef K::Point_3                                                       Point;
+typedef CGAL::Search_traits_3<K>                                         Traits;
+typedef CGAL::Orthogonal_k_neighbor_search<Traits>                       Neighbor_search;
+typedef Neighbor_search::Tree                                            Tree;
+
+typedef std::pair<Point, int>                                            Point_with_index;
+typedef CGAL::First_of_pair_property_map<Point_with_index>               Ppmap;
+typedef CGAL::Search_traits_adapter<Point_with_index, Ppmap, Traits>     Traits_with_index;
+typedef CGAL::Orthogonal_k_neighbor_search<Traits_with_index>            Neighbor_search_with_index;
+typedef Neighbor_search_with_index::Tree                                 Tree_with_index;
+
+// checks the results of the batched search against `Orthogonal_k_neighbor_search`
+template <class ConcurrencyTag, class K_search, class QueryRange>
+void test(const typename K_search::Tree& tree, const QueryRange& queries, const unsigned int k)
+{
+  typedef typename K_search::Point_d Point_d;
+
+  std::vector<Point_d> neighbors(queries.size() * k);
+  std::vector<double> distances(queries.size() * k);
+  tree.template k_nearest_neighbors<ConcurrencyTag>(queries, k, neighbors.begin(), distances.begin());
+
+  for(std::size_t i=0; i<queries.size(); ++i)
+  {
+    K_search search(tree, queries[i], k);
+    std::size_t j = i * k;
+    for(const auto& pwd : search)
+    {
+      // ties might be reported in another order, so only distances are compared
+      assert(distances[j] == pwd.second);
+      if(j > i * k)
+        assert(distances[j-1] <= distances[j]);
+      ++j;
+    }
+    assert(j == (i+1) * k);
+  }
+}
+
+template <class ConcurrencyTag>
+void test_all(const std::vector<Point>& points, const std::vector<Point>& queries)
+{
+  Tree tree(points.begin(), points.end());
+  tree.template build<ConcurrencyTag>();
+
+  for(unsigned int k : {1u, 6u, 20u})
+  {
+    test<ConcurrencyTag, Neighbor_search>(tree, queries, k);
+    test<ConcurrencyTag, Neighbor_search>(tree, points, k);
+  }
+
+  // the nearest neighbor of a point of the tree is itself
+  std::vector<Point> nearest(points.size());
+  std::vector<double> distances(points.size());
+  tree.template k_nearest_neighbors<ConcurrencyTag>(points, 1, nearest.begin(), distances.begin());
+  for(std::size_t i=0; i<points.size(); ++i)
+  {
+    assert(nearest[i] == points[i]);
+    assert(distances[i] == 0);
+  }
+
+  // all the points
+  std::vector<Point> all(points.size());
+  std::vector<double> all_distances(points.size());
+  tree.template k_nearest_neighbors<ConcurrencyTag>(std::vector<Point>(1, queries.front()),
+                                                    static_cast<unsigned int>(points.size()),
+                                                    all.begin(), all_distances.begin());
+  assert(std::is_sorted(all_distances.begin(), all_distances.end()));
+
+  // no query
+  tree.template k_nearest_neighbors<ConcurrencyTag>(std::vector<Point>(), 5, all.begin(), all_distances.begin());
+
+  // a tree built implicitly, with points with information
+  std::vector<Point_with_index> points_with_index;
+  for(std::size_t i=0; i<points.size(); ++i)
+    points_with_index.emplace_back(points[i], int(i));
+  Tree_with_index tree_with_index(points_with_index.begin(), points_with_index.end());
+  test<ConcurrencyTag, Neighbor_search_with_index>(tree_with_index, queries, 10);
+}
+
+int main()
+{
+  CGAL::Random rand(4);
+  std::vector<Point> points, queries;
+  std::copy_n(CGAL::Random_points_in_sphere_3<Point>(1., rand), 5000, std::back_inserter(points));
+  std::copy_n(CGAL::Random_points_in_cube_3<Point>(1.2, rand), 1000, std::back_inserter(queries));
+
+  std::cout << "Sequential_tag" << std::endl;
+  test_all<CGAL::Sequential_tag>(points, queries);
+#ifdef CGAL_LINKED_WITH_TBB
+  std::cout << "Parallel_tag" << std::endl;
+  test_all<CGAL::Parallel_tag>(points, queries);
+#endif
+
+  std::cout << "done" << std::endl;
+  return EXIT_SUCCESS;
+}
@@ -17,16 +17,21 @@
 #include <CGAL/IO/OFF/generic_copy_OFF.h>
 #include <CGAL/IO/helpers.h>
 #include <CGAL/IO/Generic_writer.h>
+#include <CGAL/IO/internal/read_by_blocks.h>
 
 #include <CGAL/array.h>
 #include <CGAL/assertions.h>
 #include <CGAL/Named_function_parameters.h>
 #include <CGAL/iterator.h>
 #include <CGAL/Kernel_traits.h>
+#include <CGAL/tags.h>
 #include <CGAL/use.h>
 
 #include <boost/range/value_type.hpp>
 
+#include <algorithm>
+#include <atomic>
+#include <cmath>
 #include <fstream>
 #include <iostream>
 #include <vector>
@@ -48,11 +53,166 @@ void integer_type_converter(S& p1, const T& p2)
   p1 = static_cast<S>(p2);
 }
 
+// decodes the color given by the `n` values of `values` after the coordinates of
+// a vertex or the indices of a face, as `File_scanner_OFF::scan_color()` does.
+// Returns `false` if the values do not define a color.
+inline bool color_from_values(const double* values, const std::size_t n, CGAL::IO::Color& color)
+{
+  if(n == 1)
+  {
+    const CGAL::IO::Color& c =
+      CGAL::File_scanner_OFF::get_indexed_color((std::max)(0, static_cast<int>(values[0])));
+    color = CGAL::IO::Color(c.red(), c.green(), c.blue());
+    return true;
+  }
+  if(n < 3)
+    return false;
+
+  // integer values are taken as is, and floating point values are in [0, 1]
+  const double scale = (std::floor(values[0]) == values[0] && std::floor(values[1]) == values[1] &&
+                        std::floor(values[2]) == values[2]) ? 1. : 255.;
+  color = CGAL::IO::Color(static_cast<unsigned char>(values[0] * scale),
+                          static_cast<unsigned char>(values[1] * scale),
+                          static_cast<unsigned char>(values[2] * scale));
+  return true;
+}
+
+// Reads the vertices and the faces of an ASCII OFF file whose items have no other
+// attributes than their coordinates, vertex indices, and colors (COFF). Each item is
+// expected on its own line. The lines are extracted by blocks, and the lines of a block
+// are parsed in parallel if `ConcurrencyTag` is `CGAL::Parallel_tag`.
+template <typename ConcurrencyTag, typename PointRange, typename PolygonRange,
+          typename VertexColorOutputIterator, typename FaceColorOutputIterator>
+bool read_OFF_by_blocks(std::istream& is,
+                        const CGAL::File_scanner_OFF& scanner,
+                        PointRange& points,
+                        PolygonRange& polygons,
+                        VertexColorOutputIterator& vc_out,
+                        FaceColorOutputIterator& fc_out,
+                        const bool verbose)
+{
+  typedef CGAL::IO::Color                                                Color;
+
+  const std::size_t block_size = 1 << 16;
+  const std::size_t nv = scanner.size_of_vertices();
+  const std::size_t nf = scanner.size_of_facets();
+  const std::size_t offset = scanner.index_offset();
+  const bool has_colors = scanner.has_colors();
+
+  std::vector<std::string> lines;
+  std::vector<Color> colors;
+  std::vector<char> has_color;
+  std::atomic<bool> ok(true);
+
+  // colors are decoded in parallel, and written in the order of the items
+  auto write_colors = [&](const std::size_t n, auto& out)
+  {
+    for(std::size_t i=0; i<n; ++i)
+    {
+      if(has_color[i])
+        *out++ = colors[i];
+    }
+  };
+
+  for(std::size_t first=0; first<nv; first+=block_size)
+  {
+    const std::size_t n = (std::min)(block_size, nv - first);
+    if(read_data_lines(is, lines, n) != n)
+    {
+      if(verbose)
+        std::cerr << "error while reading vertices: unexpected end of file." << std::endl;
+      return false;
+    }
+
+    colors.resize(n);
+    has_color.assign(n, false);
+    for_each_in_block<ConcurrencyTag>(n, [&](const std::size_t i)
+    {
+      double values[7];
+      const std::size_t nb = parse_numbers(lines[i].c_str(), values, has_colors ? 7 : 3);
+      if(nb < 3)
+      {
+        ok = false;
+        return;
+      }
+      fill_point(values[0], values[1], values[2], 1., points[first + i]);
+      if(nb > 3 && !(has_color[i] = color_from_values(values + 3, nb - 3, colors[i])))
+        ok = false;
+    });
+
+    if(!ok)
+    {
+      if(verbose)
+        std::cerr << "error while reading vertex." << std::endl;
+      return false;
+    }
+    write_colors(n, vc_out);
+  }
+
+  for(std::size_t first=0; first<nf; first+=block_size)
+  {
+    const std::size_t n = (std::min)(block_size, nf - first);
+    if(read_data_lines(is, lines, n) != n)
+    {
+      if(verbose)
+        std::cerr << "error while reading facets: unexpected end of file." << std::endl;
+      return false;
+    }
+
+    colors.resize(n);
+    has_color.assign(n, false);
+    for_each_in_block<ConcurrencyTag>(n, [&](const std::size_t i)
+    {
+      const char* line = lines[i].c_str();
+      std::size_t size, id;
+      if(!parse_index(line, size))
+      {
+        ok = false;
+        return;
+      }
+
+      CGAL::internal::resize(polygons[first + i], size);
+      for(std::size_t j=0; j<size; ++j)
+      {
+        if(!parse_index(line, id) || id < offset || id - offset >= nv)
+        {
+          ok = false;
+          return;
+        }
+        integer_type_converter(polygons[first + i][j], id - offset);
+      }
+
+      // the trailing values of a face are its color, and are ignored without a COFF header
+      if(has_colors)
+      {
+        double values[4];
+        const std::size_t nb = parse_numbers(line, values, 4);
+        if(nb > 0 && !(has_color[i] = color_from_values(values, nb, colors[i])))
+          ok = false;
+      }
+    });
+
+    if(!ok)
+    {
+      if(verbose)
+        std::cerr << "error while reading facet: missing or out of range index, or bad color." << std::endl;
+      return false;
+    }
+    write_colors(n, fc_out);
+  }
+
+  if(is.eof())
+    is.clear(is.rdstate() & ~std::ios_base::failbit); // set by getline
+
+  return !is.fail();
+}
+
 template <typename PointRange, typename PolygonRange,
           typename VertexNormalOutputIterator,
           typename VertexColorOutputIterator,
           typename VertexTextureOutputIterator,
-          typename FaceColorOutputIterator>
+          typename FaceColorOutputIterator,
+          typename ConcurrencyTag = CGAL::Sequential_tag>
 bool read_OFF(std::istream& is,
               PointRange& points,
               PolygonRange& polygons,
@@ -60,7 +220,8 @@ bool read_OFF(std::istream& is,
               VertexColorOutputIterator vc_out,
               VertexTextureOutputIterator vt_out,
               FaceColorOutputIterator fc_out,
-              const bool verbose = false)
+              const bool verbose = false,
+              const ConcurrencyTag = ConcurrencyTag())
 {
   typedef typename boost::range_value<PointRange>::type                               Point;
   typedef typename CGAL::Kernel_traits<Point>::Kernel                                 Kernel;
@@ -82,6 +243,12 @@ bool read_OFF(std::istream& is,
   points.resize(scanner.size_of_vertices());
   polygons.resize(scanner.size_of_facets());
 
+  // the lines of ASCII OFF files with at most colors can be parsed independently of each other
+  if(std::is_convertible<ConcurrencyTag, CGAL::Parallel_tag>::value &&
+     scanner.off() && scanner.ascii() && !scanner.has_normals() &&
+     !scanner.has_textures() && !scanner.is_homogeneous() && !scanner.n_dimensional())
+    return read_OFF_by_blocks<ConcurrencyTag>(is, scanner, points, polygons, vc_out, fc_out, verbose);
+
   for(std::size_t i=0; i<scanner.size_of_vertices(); ++i)
   {
     double x(0), y(0), z(0), w(0);
@@ -174,6 +341,14 @@ bool read_OFF(std::istream& is,
  *     \cgalParamType{Boolean}
  *     \cgalParamDefault{`false`}
  *   \cgalParamNEnd
+ *
+ *   \cgalParamNBegin{concurrency_tag}
+ *     \cgalParamDescription{a tag indicating if the lines of the file should be parsed using one or several threads}
+ *     \cgalParamType{Either `CGAL::Sequential_tag`, or `CGAL::Parallel_tag`, or `CGAL::Parallel_if_available_tag`}
+ *     \cgalParamDefault{`CGAL::Sequential_tag`}
+ *     \cgalParamExtra{Lines are parsed in parallel only for ASCII files without normals, textures,
+ *                     and homogeneous coordinates, whose vertices and facets are each written on their own line.}
+ *   \cgalParamNEnd
  * \cgalNamedParamsEnd
  *
  * \returns `true` if the reading was successful, `false` otherwise.
@@ -191,6 +366,10 @@ bool read_OFF(std::istream& is,
   using parameters::choose_parameter;
   using parameters::get_parameter;
 
+  typedef typename internal_np::Lookup_named_param_def<internal_np::concurrency_tag_t,
+                                                       CGAL_NP_CLASS,
+                                                       Sequential_tag>::type Concurrency_tag;
+
   return internal::read_OFF(is, points, polygons,
                             choose_parameter(get_parameter(np, internal_np::vertex_normal_output_iterator),
                                              CGAL::Emptyset_iterator()),
@@ -200,7 +379,8 @@ bool read_OFF(std::istream& is,
                                              CGAL::Emptyset_iterator()),
                             choose_parameter(get_parameter(np, internal_np::face_color_output_iterator),
                                              CGAL::Emptyset_iterator()),
-                            choose_parameter(get_parameter(np, internal_np::verbose), true));
+                            choose_parameter(get_parameter(np, internal_np::verbose), true),
+                            Concurrency_tag());
 }
 
 /*!
@@ -227,6 +407,14 @@ bool read_OFF(std::istream& is,
  *     \cgalParamType{Boolean}
  *     \cgalParamDefault{`false`}
  *   \cgalParamNEnd
+ *
+ *   \cgalParamNBegin{concurrency_tag}
+ *     \cgalParamDescription{a tag indicating if the lines of the file should be parsed using one or several threads}
+ *     \cgalParamType{Either `CGAL::Sequential_tag`, or `CGAL::Parallel_tag`, or `CGAL::Parallel_if_available_tag`}
+ *     \cgalParamDefault{`CGAL::Sequential_tag`}
+ *     \cgalParamExtra{Lines are parsed in parallel only for ASCII files without normals, textures,
+ *                     and homogeneous coordinates, whose vertices and facets are each written on their own line.}
+ *   \cgalParamNEnd
  * \cgalNamedParamsEnd
  *
  * \returns `true` if the reading was successful, `false` otherwise.
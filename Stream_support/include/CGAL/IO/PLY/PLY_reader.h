@@ -152,6 +152,9 @@ public:
 
   const std::string& name() const { return m_name; }
 
+  // 0 = ASCII, 1 = binary little endian, 2 = binary big endian
+  std::size_t format() const { return m_format; }
+
   virtual void get(std::istream& stream) const = 0;
 
   // The two following functions prevent the stream to only extract
@@ -0,0 +1,109 @@
+// Copyright (c) 2026 GeometryFactory (France).
+// All rights reserved.
+//
+// This file is part of CGAL (www.cgal.org)
+//
+// $URL$
+// $Id$
+// SPDX-License-Identifier: LGPL-3.0-or-later OR LicenseRef-Commercial
+//
+// Author(s)     : GeometryFactory
+
+#ifndef CGAL_IO_INTERNAL_READ_BY_BLOCKS_H
+#define CGAL_IO_INTERNAL_READ_BY_BLOCKS_H
+
+#include <CGAL/for_each.h>
+
+#include <algorithm>
+#include <cctype>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <string>
+#include <vector>
+
+namespace CGAL {
+namespace IO {
+namespace internal {
+
+// Helpers to read the items of a file by blocks: a block of items is
+// first extracted from the stream, then its items are decoded
+// independently of each other, possibly in parallel.
+
+// applies `f` to the integers of `[0, n)`, possibly in parallel
+template <typename ConcurrencyTag, typename Function>
+void for_each_in_block(const std::size_t n, const Function& f)
+{
+  CGAL::internal::for_each_index<ConcurrencyTag>(n, f);
+}
+
+// decodes a number stored in binary, in the endianness of the
+// machine if `swap` is `false`, and in the other one otherwise
+template <typename Type>
+Type read_binary_number(const char* data, const bool swap)
+{
+  char buffer[sizeof(Type)];
+  if(swap)
+    std::reverse_copy(data, data + sizeof(Type), buffer);
+  else
+    std::copy(data, data + sizeof(Type), buffer);
+
+  Type t;
+  std::memcpy(&t, buffer, sizeof(Type));
+  return t;
+}
+
+// parses at most `n` numbers at the beginning of `line`, and returns the number of numbers parsed
+inline std::size_t parse_numbers(const char* line, double* values, const std::size_t n)
+{
+  std::size_t nb = 0;
+  for(; nb<n; ++nb)
+  {
+    char* end;
+    values[nb] = std::strtod(line, &end);
+    if(end == line)
+      break;
+    line = end;
+  }
+  return nb;
+}
+
+// parses a non-negative integer at the beginning of `line`, and moves `line` after it.
+// Returns `false` if `line` does not start with such an integer.
+inline bool parse_index(const char*& line, std::size_t& value)
+{
+  char* end;
+  const long long l = std::strtoll(line, &end, 10);
+  if(end == line || l < 0 || (*end != '\0' && !std::isspace(static_cast<unsigned char>(*end))))
+    return false;
+  value = static_cast<std::size_t>(l);
+  line = end;
+  return true;
+}
+
+// reads at most `n` lines containing data, that is lines which are not empty,
+// made of whitespaces or only commented out with `#`, and whose comments are removed.
+// Returns the number of lines read.
+inline std::size_t read_data_lines(std::istream& is, std::vector<std::string>& lines, const std::size_t n)
+{
+  if(lines.size() < n)
+    lines.resize(n);
+
+  std::size_t nb = 0;
+  while(nb < n && std::getline(is, lines[nb]))
+  {
+    std::string& line = lines[nb];
+    const std::size_t pos = line.find('#');
+    if(pos != std::string::npos)
+      line.resize(pos);
+    if(line.find_first_not_of(" \t\r\n\f\v") != std::string::npos)
+      ++nb;
+  }
+  return nb;
+}
+
+} // namespace internal
+} // namespace IO
+} // namespace CGAL
+
+#endif // CGAL_IO_INTERNAL_READ_BY_BLOCKS_H
@@ -313,6 +313,15 @@ bool read_OFF_with_or_without_vnormals(std::istream& is,
 ///     \cgalParamDefault{If this parameter is unused, face colors (if they exist)
 ///                       will be written in an internal property map called `f:color`.}
 ///   \cgalParamNEnd
+///
+///   \cgalParamNBegin{concurrency_tag}
+///     \cgalParamDescription{a tag indicating if the mesh should be built using one or several threads}
+///     \cgalParamType{Either `CGAL::Sequential_tag`, or `CGAL::Parallel_tag`, or `CGAL::Parallel_if_available_tag`}
+///     \cgalParamDefault{`CGAL::Sequential_tag`}
+///     \cgalParamExtra{If `CGAL::Parallel_tag` is used, the lines of ASCII files without normals, textures,
+///                     and homogeneous coordinates are parsed in parallel, and the connectivity of `sm`
+///                     is built at once by sorting the halfedges of all the faces.}
+///   \cgalParamNEnd
 /// \cgalNamedParamsEnd
 ///
 /// \pre The data in the stream must represent a two-manifold. If this is not the case
@@ -17,12 +17,17 @@
 #ifndef DOXYGEN_RUNNING
 
 #include <CGAL/assertions.h>
+#include <CGAL/for_each.h>
 #include <CGAL/property_map.h>
+#include <CGAL/tags.h>
+#include <CGAL/use.h>
 
 #include <algorithm>
 #include <optional>
 #include <string>
+#include <type_traits>
 #include <typeinfo>
+#include <utility>
 #include <vector>
 
 namespace CGAL {
@@ -65,6 +70,14 @@ public:
     /// Let two elements swap their storage place.
     virtual void swap(size_t i0, size_t i1) = 0;
 
+    /// Reorder the elements, the i-th element being the `new_to_old[i]`-th one,
+    /// possibly in parallel.
+    virtual void permute(const std::vector<size_t>& new_to_old, bool parallel) = 0;
+
+    /// Let the elements of each pair swap their storage place, the pairs being disjoint,
+    /// possibly in parallel.
+    virtual void swap(const std::vector<std::pair<size_t, size_t> >& pairs, bool parallel) = 0;
+
     /// Return a deep copy of self.
     virtual Base_property_array* clone () const = 0;
 
@@ -164,6 +177,45 @@ public: // virtual interface of Base_property_array
         data_[i1]=d;
     }
 
+    virtual void permute(const std::vector<size_t>& new_to_old, bool parallel)
+    {
+        CGAL_assertion(new_to_old.size() == data_.size());
+        vector_type permuted(data_.size(), value_);
+        auto move_element = [&](const std::size_t i) -> bool
+        {
+            permuted[i] = std::move(data_[new_to_old[i]]);
+            return true;
+        };
+
+        // the elements of `std::vector<bool>` cannot be written concurrently
+#ifdef CGAL_LINKED_WITH_TBB
+        if (parallel && !std::is_same<T, bool>::value)
+            CGAL::for_each<Parallel_tag>(CGAL::make_counting_range<std::size_t>(0, data_.size()), move_element);
+        else
+#endif
+            CGAL::for_each<Sequential_tag>(CGAL::make_counting_range<std::size_t>(0, data_.size()), move_element);
+        CGAL_USE(parallel);
+        data_.swap(permuted);
+    }
+
+    virtual void swap(const std::vector<std::pair<size_t, size_t> >& pairs, bool parallel)
+    {
+        auto swap_elements = [&](const std::pair<size_t, size_t>& p) -> bool
+        {
+            swap(p.first, p.second);
+            return true;
+        };
+
+        // the elements of `std::vector<bool>` cannot be written concurrently
+#ifdef CGAL_LINKED_WITH_TBB
+        if (parallel && !std::is_same<T, bool>::value)
+            CGAL::for_each<Parallel_tag>(pairs, swap_elements);
+        else
+#endif
+            CGAL::for_each<Sequential_tag>(pairs, swap_elements);
+        CGAL_USE(parallel);
+    }
+
     virtual Base_property_array* clone() const
     {
         Property_array<T>* p = new Property_array<T>(this->name_, this->value_);
@@ -458,6 +510,7 @@ public:
         for (std::size_t i=0; i<parrays_.size(); ++i)
             parrays_[i]->resize(n);
         size_ = n;
+        capacity_ = (std::max)(n, capacity_);
     }
 
     // resize the vector of properties to n, deleting all other properties
@@ -481,10 +534,17 @@ public:
     // add a new element to each vector
     void push_back()
     {
+        grow(1);
         for (std::size_t i=0; i<parrays_.size(); ++i)
             parrays_[i]->push_back();
         ++size_;
-        capacity_ = ((std::max)(size_, capacity_));
+    }
+
+    // add n new elements to each vector, each vector being resized once
+    void push_back(size_t n)
+    {
+        grow(n);
+        resize(size_ + n);
     }
 
     // reset element to its default property values
@@ -501,6 +561,20 @@ public:
             parrays_[i]->swap(i0, i1);
     }
 
+    // reorder the elements of all arrays, the i-th element being the new_to_old[i]-th one
+    void permute(const std::vector<size_t>& new_to_old, bool parallel)
+    {
+        for (std::size_t i=0; i<parrays_.size(); ++i)
+            parrays_[i]->permute(new_to_old, parallel);
+    }
+
+    // let the elements of each pair swap their storage place in all arrays, the pairs being disjoint
+    void swap(const std::vector<std::pair<size_t, size_t> >& pairs, bool parallel)
+    {
+        for (std::size_t i=0; i<parrays_.size(); ++i)
+            parrays_[i]->swap(pairs, parallel);
+    }
+
     // swap content with other Property_container
     void swap (Property_container& other)
     {
@@ -510,6 +584,14 @@ public:
     }
 
 private:
+    // ensures that all arrays can hold n more elements. When the capacity is exceeded,
+    // it is doubled for all arrays at once, so that their reallocations are not interleaved.
+    void grow(size_t n)
+    {
+        if (size_ + n > capacity_)
+            reserve((std::max)(size_ + n, 2 * capacity_));
+    }
+
     std::vector<Base_property_array*>  parrays_;
     size_t  size_ = 0;
     size_t  capacity_ = 0;
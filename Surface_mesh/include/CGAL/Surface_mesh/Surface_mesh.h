@@ -27,9 +27,16 @@
 #include <CGAL/boost/graph/iterator.h>
 #include <CGAL/boost/graph/named_params_helper.h>
 #include <CGAL/boost/graph/internal/helpers.h>
+#include <CGAL/boost/graph/internal/add_polygons_with_edge_table.h>
 #include <CGAL/Named_function_parameters.h>
 #include <CGAL/circulator.h>
 #include <CGAL/Handle_hash_function.h>
+#include <CGAL/Dimension.h>
+#include <CGAL/Kernel_traits.h>
+#include <CGAL/for_each.h>
+#include <CGAL/hilbert_sort.h>
+#include <CGAL/Spatial_sort_traits_adapter_2.h>
+#include <CGAL/Spatial_sort_traits_adapter_3.h>
 #include <CGAL/IO/Verbose_ostream.h>
 #include <CGAL/Iterator_range.h>
 #include <CGAL/property_map.h>
@@ -38,6 +45,7 @@
 #include <boost/iterator/iterator_facade.hpp>
 
 #include <algorithm>
+#include <atomic>
 #include <cstddef>
 #include <functional>
 #include <iterator>
@@ -1090,6 +1098,40 @@ public:
         return add_face(v);
     }
 
+    /// adds a new vertex for each point of `points`, resizing the vertex properties once.
+    /// Removed vertices are not recycled, so that the new vertices have consecutive indices.
+    /// \tparam PointRange a model of `ConstRange` with value type `Point`
+    /// \returns the index `first` of the vertex of the first point, the vertex of the `i`-th point
+    /// being `Vertex_index(first + i)`.
+    template <typename PointRange>
+    Vertex_index add_vertices(const PointRange& points)
+    {
+      const size_type first = num_vertices();
+      vprops_.push_back(static_cast<std::size_t>(std::distance(std::begin(points), std::end(points))));
+      size_type i = first;
+      for(const auto& p : points)
+        vpoint_[Vertex_index(i++)] = p;
+      return Vertex_index(first);
+    }
+
+    /// adds the faces described by `polygons` at once.
+    /// Instead of adding the faces one by one as `add_face()` does, the opposite halfedges of all the
+    /// polygons are paired first, the halfedge, edge, and face properties are then resized once,
+    /// and the connectivity of each element is finally set independently of the others.
+    /// The vertices of the polygons must be isolated, for example created with `add_vertices()`.
+    /// Removed faces and edges are not recycled.
+    ///
+    /// \tparam ConcurrencyTag enables sequential versus parallel algorithm.
+    ///         Possible values are `Sequential_tag`, `Parallel_tag`, and `Parallel_if_available_tag`.
+    /// \tparam PolygonRange a model of `RandomAccessRange` whose value type is a model of `RandomAccessRange`
+    ///         with value type `Vertex_index`, or an integer type `i` standing for `Vertex_index(i)`.
+    ///
+    /// \returns `true` if the faces were added, with consecutive indices after the existing faces, in the order of `polygons`.
+    /// Returns `false`, without modifying the mesh, if a vertex of the polygons is not an isolated vertex of the mesh,
+    /// or if the polygons do not describe an oriented 2-manifold surface, possibly with boundaries.
+    template <typename ConcurrencyTag = Sequential_tag, typename PolygonRange>
+    bool add_faces(const PolygonRange& polygons);
+
     ///@}
 
 
@@ -1399,6 +1441,36 @@ public:
     template <typename Visitor>
     void collect_garbage(Visitor& visitor);
 
+    /// really removes vertices, halfedges, edges, and faces which are marked removed,
+    /// as `collect_garbage()` does, the elements being moved and the connectivity being updated
+    /// in parallel if `ConcurrencyTag` is `Parallel_tag`.
+    ///
+    /// If `spatial_reordering` is `true`, the vertices are also sorted along a Hilbert curve
+    /// of their points, and the edges and faces in the order of their vertices, so that elements
+    /// which are close on the surface are likely to be close in memory, which makes traversals faster.
+    /// In that case, the elements are reordered even if there is no garbage.
+    ///
+    /// \tparam ConcurrencyTag enables sequential versus parallel algorithm.
+    ///         Possible values are `Sequential_tag`, `Parallel_tag`, and `Parallel_if_available_tag`.
+    ///
+    /// \pre If `spatial_reordering` is `true`, `P` is a 2D or 3D point type of a \cgal kernel.
+    ///
+    /// \attention By garbage collecting elements get new indices.
+    /// In case you store indices in an auxiliary data structure
+    /// or in a property these indices are potentially no longer
+    /// referring to the right elements.
+    template <typename ConcurrencyTag>
+    void collect_garbage(const bool spatial_reordering = false);
+
+    //undocumented convenience function that allows to get old-index->new-index information
+    template <typename ConcurrencyTag, typename Visitor>
+    void collect_garbage(Visitor& visitor, const bool spatial_reordering);
+
+    //undocumented function that removes the garbage and puts the vertices in the order of `vertex_order`,
+    //which contains each vertex not marked as removed once, the edges and faces following their vertices
+    template <typename ConcurrencyTag, typename Visitor>
+    void collect_garbage(Visitor& visitor, const std::vector<Vertex_index>& vertex_order);
+
     /// controls the recycling or not of simplices previously marked as removed
     /// upon addition of new elements.
     /// When set to `true` (default value), new elements are first picked in the garbage (if any)
@@ -2205,6 +2277,11 @@ private: //--------------------------------------------------- helper functions
     /// if `v` is a border vertex.
     void adjust_incoming_halfedge(Vertex_index v);
 
+    /// removes the garbage, with the vertices in the order of `vertex_order` if it is not null,
+    /// and in the order of `collect_garbage(Visitor&)` otherwise.
+    template <typename ConcurrencyTag, typename Visitor>
+    void collect_garbage_impl(Visitor& visitor, const std::vector<Vertex_index>* vertex_order);
+
 private: //------------------------------------------------------- private data
     Properties::Property_container<Self, Vertex_index> vprops_;
     Properties::Property_container<Self, Halfedge_index> hprops_;
@@ -2525,6 +2602,56 @@ Surface_mesh<P>::add_face(const Range& r)
   return CGAL::Euler::add_face(r, *this);
 }
 
+template <typename P>
+template <typename ConcurrencyTag, typename PolygonRange>
+bool
+Surface_mesh<P>::add_faces(const PolygonRange& polygons)
+{
+  // the vertices are addressed by their index
+  const std::size_t nv = num_vertices();
+  std::vector<Vertex_index> vertices(nv);
+  std::atomic<bool> valid(true);
+  CGAL::internal::for_each_index<ConcurrencyTag>(nv, [&](const std::size_t i)
+  {
+    vertices[i] = Vertex_index(size_type(i));
+  });
+  CGAL::internal::for_each_index<ConcurrencyTag>(polygons.size(), [&](const std::size_t f)
+  {
+    for(const auto& id : polygons[f])
+    {
+      const std::size_t i = static_cast<std::size_t>(id);
+      if(i >= nv || is_removed(vertices[i]) || !is_isolated(vertices[i]))
+        valid = false;
+    }
+  });
+  if(!valid)
+    return false;
+
+  // the elements are appended, each property array being resized once
+  auto create_elements = [this](const std::size_t nf, const std::size_t ne,
+                                std::vector<Face_index>& faces, std::vector<Halfedge_index>& edge_halfedges)
+  {
+    const size_type first_face = num_faces(), first_edge = num_edges();
+    fprops_.push_back(nf);
+    eprops_.push_back(ne);
+    hprops_.push_back(2 * ne);
+
+    faces.resize(nf);
+    CGAL::internal::for_each_index<ConcurrencyTag>(nf, [&](const std::size_t f)
+    {
+      faces[f] = Face_index(size_type(first_face + f));
+    });
+    edge_halfedges.resize(ne);
+    CGAL::internal::for_each_index<ConcurrencyTag>(ne, [&](const std::size_t e)
+    {
+      edge_halfedges[e] = halfedge(Edge_index(size_type(first_edge + e)));
+    });
+  };
+
+  std::vector<Face_index> faces;
+  return internal::add_polygons_with_edge_table<ConcurrencyTag>(polygons, vertices, *this, faces, create_elements);
+}
+
   /// @endcond
 
 //-----------------------------------------------------------------------------
@@ -2732,6 +2859,273 @@ collect_garbage()
   collect_garbage(visitor);
 }
 
+#ifndef DOXYGEN_RUNNING
+namespace collect_garbage_internal {
+
+// returns the order of the elements after the sequential garbage collection, which swaps
+// each removed element among the first ones with a kept element, starting from the end
+template <typename IsRemoved>
+std::vector<std::size_t> order_by_swaps(const std::size_t n, const IsRemoved& is_removed)
+{
+  std::vector<std::size_t> new_to_old(n);
+  for(std::size_t i=0; i<n; ++i)
+    new_to_old[i] = i;
+
+  std::size_t i0 = 0, i1 = n;
+  for(;;)
+  {
+    while(i0 < i1 && !is_removed(i0))
+      ++i0;
+    while(i0 < i1 && is_removed(i1 - 1))
+      --i1;
+    if(i0 + 1 >= i1)
+      break;
+    std::swap(new_to_old[i0], new_to_old[i1 - 1]);
+    ++i0;
+    --i1;
+  }
+  return new_to_old;
+}
+
+// returns the pairs of elements swapped by `order_by_swaps()`
+inline std::vector<std::pair<std::size_t, std::size_t> > swapped_pairs(const std::vector<std::size_t>& new_to_old)
+{
+  std::vector<std::pair<std::size_t, std::size_t> > pairs;
+  for(std::size_t i=0; i<new_to_old.size(); ++i)
+    if(i < new_to_old[i])
+      pairs.emplace_back(i, new_to_old[i]);
+  return pairs;
+}
+
+// returns the order of the elements sorted by their key, which is in `[0, max_key]`,
+// the elements with equal keys keeping their order
+inline std::vector<std::size_t> order_by_keys(const std::vector<std::size_t>& keys, const std::size_t max_key)
+{
+  std::vector<std::size_t> offsets(max_key + 2, 0);
+  for(std::size_t k : keys)
+    ++offsets[k + 1];
+  for(std::size_t k=0; k<=max_key; ++k)
+    offsets[k + 1] += offsets[k];
+
+  std::vector<std::size_t> new_to_old(keys.size());
+  for(std::size_t i=0; i<keys.size(); ++i)
+    new_to_old[offsets[keys[i]]++] = i;
+  return new_to_old;
+}
+
+template <typename Point, typename PointMap, int dimension = Ambient_dimension<Point>::value>
+struct Spatial_sort_traits;
+
+template <typename Point, typename PointMap>
+struct Spatial_sort_traits<Point, PointMap, 2>
+{
+  typedef Spatial_sort_traits_adapter_2<typename Kernel_traits<Point>::Kernel, PointMap> type;
+};
+
+template <typename Point, typename PointMap>
+struct Spatial_sort_traits<Point, PointMap, 3>
+{
+  typedef Spatial_sort_traits_adapter_3<typename Kernel_traits<Point>::Kernel, PointMap> type;
+};
+
+} // namespace collect_garbage_internal
+#endif
+
+template <typename P>
+template <typename ConcurrencyTag>
+void
+Surface_mesh<P>::
+collect_garbage(const bool spatial_reordering)
+{
+  collect_garbage_internal::Dummy_visitor visitor;
+  collect_garbage<ConcurrencyTag>(visitor, spatial_reordering);
+}
+
+template <typename P>
+template <typename ConcurrencyTag, typename Visitor>
+void
+Surface_mesh<P>::
+collect_garbage(Visitor& visitor, const bool spatial_reordering)
+{
+    if (!spatial_reordering)
+    {
+      collect_garbage_impl<ConcurrencyTag>(visitor, nullptr);
+      return;
+    }
+
+    std::vector<Vertex_index> kept;
+    kept.reserve(number_of_vertices());
+    for (Vertex_index v : vertices())
+        kept.push_back(v);
+
+    typedef typename collect_garbage_internal::Spatial_sort_traits<P, Property_map<Vertex_index, P> >::type Traits;
+    hilbert_sort<ConcurrencyTag>(kept.begin(), kept.end(), Traits(vpoint_));
+
+    collect_garbage_impl<ConcurrencyTag>(visitor, &kept);
+}
+
+template <typename P>
+template <typename ConcurrencyTag, typename Visitor>
+void
+Surface_mesh<P>::
+collect_garbage(Visitor& visitor, const std::vector<Vertex_index>& vertex_order)
+{
+    CGAL_precondition(vertex_order.size() == number_of_vertices());
+    collect_garbage_impl<ConcurrencyTag>(visitor, &vertex_order);
+}
+
+template <typename P>
+template <typename ConcurrencyTag, typename Visitor>
+void
+Surface_mesh<P>::
+collect_garbage_impl(Visitor& visitor, const std::vector<Vertex_index>* vertex_order)
+{
+    const bool parallel = std::is_convertible<ConcurrencyTag, Parallel_tag>::value;
+    const bool reordering = (vertex_order != nullptr);
+    if (!parallel && !reordering)
+    {
+      collect_garbage(visitor);
+      return;
+    }
+    if (!has_garbage() && !reordering)
+    {
+      return;
+    }
+
+    auto for_each_index = [](const std::size_t n, const auto& f)
+    {
+      CGAL::internal::for_each_index<ConcurrencyTag>(n, f);
+    };
+
+    const std::size_t nV = num_vertices(), nE = num_edges(), nF = num_faces();
+    const std::size_t nV_kept = nV - number_of_removed_vertices(),
+                      nE_kept = nE - number_of_removed_edges(),
+                      nF_kept = nF - number_of_removed_faces();
+
+    // the order of the elements after the garbage collection, the kept elements coming first
+    std::vector<std::size_t> v_order, e_order, f_order;
+    if (reordering)
+    {
+        v_order.reserve(nV);
+        for (Vertex_index v : *vertex_order)
+            v_order.push_back(v);
+        for (std::size_t i=0; i<nV; ++i)
+            if (vremoved_[Vertex_index(size_type(i))])
+                v_order.push_back(i);
+
+        // the edges and faces follow their first vertex, the removed ones coming last
+        std::vector<std::size_t> rank(nV);
+        for_each_index(nV, [&](const std::size_t i) { rank[v_order[i]] = i; });
+
+        std::vector<std::size_t> e_keys(nE), f_keys(nF);
+        for_each_index(nE, [&](const std::size_t i)
+        {
+            const Edge_index e = Edge_index(size_type(i));
+            e_keys[i] = eremoved_[e] ? nV : (std::min)(rank[vertex(e, 0)], rank[vertex(e, 1)]);
+        });
+        for_each_index(nF, [&](const std::size_t i)
+        {
+            const Face_index f = Face_index(size_type(i));
+            std::size_t key = nV;
+            if (!fremoved_[f])
+            {
+                const Halfedge_index h0 = halfedge(f);
+                Halfedge_index h = h0;
+                do
+                {
+                    key = (std::min)(key, rank[target(h)]);
+                    h = next(h);
+                }
+                while (h != h0);
+            }
+            f_keys[i] = key;
+        });
+        e_order = collect_garbage_internal::order_by_keys(e_keys, nV);
+        f_order = collect_garbage_internal::order_by_keys(f_keys, nV);
+    }
+    else
+    {
+        v_order = collect_garbage_internal::order_by_swaps(nV, [&](const std::size_t i) { return vremoved_[Vertex_index(size_type(i))]; });
+        e_order = collect_garbage_internal::order_by_swaps(nE, [&](const std::size_t i) { return eremoved_[Edge_index(size_type(i))]; });
+        f_order = collect_garbage_internal::order_by_swaps(nF, [&](const std::size_t i) { return fremoved_[Face_index(size_type(i))]; });
+    }
+
+    std::vector<std::size_t> h_order(2 * nE);
+    for_each_index(nE, [&](const std::size_t i)
+    {
+        h_order[2 * i] = 2 * e_order[i];
+        h_order[2 * i + 1] = 2 * e_order[i] + 1;
+    });
+
+    // really move the elements
+    if (reordering)
+    {
+        // each array is rewritten at once
+        vprops_.permute(v_order, parallel);
+        hprops_.permute(h_order, parallel);
+        eprops_.permute(e_order, parallel);
+        fprops_.permute(f_order, parallel);
+    }
+    else
+    {
+        // only the swapped elements are moved, in place
+        vprops_.swap(collect_garbage_internal::swapped_pairs(v_order), parallel);
+        hprops_.swap(collect_garbage_internal::swapped_pairs(h_order), parallel);
+        eprops_.swap(collect_garbage_internal::swapped_pairs(e_order), parallel);
+        fprops_.swap(collect_garbage_internal::swapped_pairs(f_order), parallel);
+    }
+
+    // setup index mapping
+    Property_map<Vertex_index, Vertex_index>      vmap = add_property_map<Vertex_index, Vertex_index>("v:garbage-collection").first;
+    Property_map<Halfedge_index, Halfedge_index>  hmap = add_property_map<Halfedge_index, Halfedge_index>("h:garbage-collection").first;
+    Property_map<Face_index, Face_index>          fmap = add_property_map<Face_index, Face_index>("f:garbage-collection").first;
+    for_each_index(nV, [&](const std::size_t i) { vmap[Vertex_index(size_type(v_order[i]))] = Vertex_index(size_type(i)); });
+    for_each_index(2 * nE, [&](const std::size_t i) { hmap[Halfedge_index(size_type(h_order[i]))] = Halfedge_index(size_type(i)); });
+    for_each_index(nF, [&](const std::size_t i) { fmap[Face_index(size_type(f_order[i]))] = Face_index(size_type(i)); });
+
+    // update vertex connectivity
+    for_each_index(nV_kept, [&](const std::size_t i)
+    {
+        const Vertex_index v = Vertex_index(size_type(i));
+        if (!is_isolated(v))
+            set_halfedge(v, hmap[halfedge(v)]);
+    });
+
+    // update halfedge connectivity
+    for_each_index(2 * nE_kept, [&](const std::size_t i)
+    {
+        const Halfedge_index h = Halfedge_index(size_type(i));
+        set_target(h, vmap[target(h)]);
+        set_next(h, hmap[next(h)]);
+        if (!is_border(h))
+            set_face(h, fmap[face(h)]);
+    });
+
+    // update indices of faces
+    for_each_index(nF_kept, [&](const std::size_t i)
+    {
+        const Face_index f = Face_index(size_type(i));
+        set_halfedge(f, hmap[halfedge(f)]);
+    });
+
+    //apply visitor before invalidating the maps
+    visitor(vmap, hmap, fmap);
+    // remove index maps
+    remove_property_map<Vertex_index>(vmap);
+    remove_property_map<Halfedge_index>(hmap);
+    remove_property_map<Face_index>(fmap);
+
+    // finally resize arrays
+    vprops_.resize(nV_kept); vprops_.shrink_to_fit();
+    hprops_.resize(2 * nE_kept); hprops_.shrink_to_fit();
+    eprops_.resize(nE_kept); eprops_.shrink_to_fit();
+    fprops_.resize(nF_kept); fprops_.shrink_to_fit();
+
+    removed_vertices_ = removed_edges_ = removed_faces_ = 0;
+    vertices_freelist_ = edges_freelist_ = faces_freelist_ = -1;
+    garbage_ = false;
+}
+
 
 template <typename P>
 void
@@ -0,0 +1,219 @@
+#include <CGAL/Surface_mesh.h>
+#include <CGAL/Simple_cartesian.h>
+#include <CGAL/boost/graph/generators.h>
+#include <CGAL/boost/graph/Euler_operations.h>
+#include <CGAL/use.h>
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <iostream>
+#include <random>
+#include <vector>
+
+typedef CGAL::Simple_cartesian<double> K;
+typedef K::Point_3 Point_3;
+typedef CGAL::Surface_mesh<Point_3> Sm;
+typedef Sm::Vertex_index Vertex_index;
+typedef Sm::Halfedge_index Halfedge_index;
+typedef Sm::Edge_index Edge_index;
+typedef Sm::Face_index Face_index;
+
+// a grid whose elements are labeled with their index, with some removed elements
+Sm make_mesh_with_garbage()
+{
+  Sm m;
+  CGAL::make_grid(30, 30, m);
+
+  Sm::Property_map<Vertex_index, int> vlabel = m.add_property_map<Vertex_index, int>("v:label").first;
+  Sm::Property_map<Halfedge_index, int> hlabel = m.add_property_map<Halfedge_index, int>("h:label").first;
+  Sm::Property_map<Edge_index, int> elabel = m.add_property_map<Edge_index, int>("e:label").first;
+  Sm::Property_map<Face_index, int> flabel = m.add_property_map<Face_index, int>("f:label").first;
+  for(Vertex_index v : m.vertices())
+    vlabel[v] = int(v);
+  for(Halfedge_index h : m.halfedges())
+    hlabel[h] = int(h);
+  for(Edge_index e : m.edges())
+    elabel[e] = int(e);
+  for(Face_index f : m.faces())
+    flabel[f] = int(f);
+
+  std::vector<Face_index> to_remove;
+  for(Face_index f : m.faces())
+    if(int(f) % 7 == 3)
+      to_remove.push_back(f);
+  for(Face_index f : to_remove)
+    CGAL::Euler::remove_face(m.halfedge(f), m);
+  m.remove_vertex(m.add_vertex(Point_3(1, 2, 3)));
+  m.add_vertex(Point_3(4, 5, 6));
+
+  assert(m.has_garbage());
+  return m;
+}
+
+struct Index_maps
+{
+  std::vector<Vertex_index> vmap;
+  std::vector<Halfedge_index> hmap;
+  std::vector<Face_index> fmap;
+  const Sm& old;
+
+  Index_maps(const Sm& old) : old(old) { }
+
+  template <typename VMap, typename HMap, typename FMap>
+  void operator()(const VMap& v, const HMap& h, const FMap& f)
+  {
+    for(std::size_t i=0; i<old.num_vertices(); ++i)
+      vmap.push_back(v[Vertex_index(Sm::size_type(i))]);
+    for(std::size_t i=0; i<old.num_halfedges(); ++i)
+      hmap.push_back(h[Halfedge_index(Sm::size_type(i))]);
+    for(std::size_t i=0; i<old.num_faces(); ++i)
+      fmap.push_back(f[Face_index(Sm::size_type(i))]);
+  }
+};
+
+// checks that `m` is `old` without its garbage, and that the maps are consistent
+void check_same_elements(const Sm& old, const Sm& m, const Index_maps& maps)
+{
+  assert(m.is_valid(false));
+  assert(!m.has_garbage());
+  assert(m.number_of_vertices() == old.number_of_vertices());
+  assert(m.number_of_edges() == old.number_of_edges());
+  assert(m.number_of_faces() == old.number_of_faces());
+  assert(m.num_vertices() == m.number_of_vertices() && m.num_faces() == m.number_of_faces());
+
+  Sm::Property_map<Vertex_index, int> old_vlabel = old.property_map<Vertex_index, int>("v:label").value();
+  Sm::Property_map<Vertex_index, int> vlabel = m.property_map<Vertex_index, int>("v:label").value();
+  Sm::Property_map<Halfedge_index, int> old_hlabel = old.property_map<Halfedge_index, int>("h:label").value();
+  Sm::Property_map<Halfedge_index, int> hlabel = m.property_map<Halfedge_index, int>("h:label").value();
+  Sm::Property_map<Face_index, int> old_flabel = old.property_map<Face_index, int>("f:label").value();
+  Sm::Property_map<Face_index, int> flabel = m.property_map<Face_index, int>("f:label").value();
+
+  for(Vertex_index v : old.vertices())
+  {
+    const Vertex_index nv = maps.vmap[v];
+    assert(m.point(nv) == old.point(v) && vlabel[nv] == old_vlabel[v]);
+  }
+  for(Halfedge_index h : old.halfedges())
+  {
+    const Halfedge_index nh = maps.hmap[h];
+    assert(hlabel[nh] == old_hlabel[h]);
+    assert(m.target(nh) == maps.vmap[old.target(h)]);
+    assert(m.next(nh) == maps.hmap[old.next(h)]);
+    assert(m.is_border(nh) == old.is_border(h));
+    if(!old.is_border(h))
+      assert(m.face(nh) == maps.fmap[old.face(h)]);
+  }
+  for(Face_index f : old.faces())
+    assert(flabel[maps.fmap[f]] == old_flabel[f]);
+}
+
+// `m` with its vertices and faces in a random order
+Sm shuffled_mesh(const Sm& m)
+{
+  std::vector<Vertex_index> vertices(m.vertices().begin(), m.vertices().end());
+  std::mt19937 gen(0);
+  std::shuffle(vertices.begin(), vertices.end(), gen);
+  std::vector<Point_3> points;
+  std::vector<std::size_t> new_id(m.num_vertices());
+  for(Vertex_index v : vertices)
+  {
+    new_id[v] = points.size();
+    points.push_back(m.point(v));
+  }
+
+  std::vector<std::vector<std::size_t> > polygons;
+  for(Face_index f : m.faces())
+  {
+    polygons.emplace_back();
+    for(Vertex_index v : CGAL::vertices_around_face(m.halfedge(f), m))
+      polygons.back().push_back(new_id[v]);
+  }
+  std::shuffle(polygons.begin(), polygons.end(), gen);
+
+  Sm shuffled;
+  shuffled.add_vertices(points);
+  bool ok = shuffled.add_faces(polygons);
+  assert(ok);
+  CGAL_USE(ok);
+  return shuffled;
+}
+
+// the average distance between the indices of the vertices of an edge
+double average_index_gap(const Sm& m)
+{
+  double sum = 0;
+  for(Edge_index e : m.edges())
+    sum += std::abs(double(m.vertex(e, 0)) - double(m.vertex(e, 1)));
+  return sum / double(m.number_of_edges());
+}
+
+// whether the faces are sorted by the smallest index of their vertices
+bool follow_their_first_vertex(const Sm& m)
+{
+  std::size_t previous = 0;
+  for(Face_index f : m.faces())
+  {
+    std::size_t key = m.num_vertices();
+    for(Vertex_index v : CGAL::vertices_around_face(m.halfedge(f), m))
+      key = (std::min)(key, std::size_t(v));
+    if(key < previous)
+      return false;
+    previous = key;
+  }
+  return true;
+}
+
+template <typename ConcurrencyTag>
+void test()
+{
+  const Sm old = make_mesh_with_garbage();
+
+  // the same result as the sequential garbage collection
+  Sm m_seq(old), m(old);
+  m_seq.collect_garbage();
+  Index_maps maps(old);
+  m.collect_garbage<ConcurrencyTag>(maps, false);
+  check_same_elements(old, m, maps);
+  assert(m.num_halfedges() == m_seq.num_halfedges());
+  for(Halfedge_index h : m.halfedges())
+  {
+    assert(m.target(h) == m_seq.target(h) && m.next(h) == m_seq.next(h) && m.face(h) == m_seq.face(h));
+    assert(m.point(m.target(h)) == m_seq.point(m_seq.target(h)));
+  }
+
+  // with a spatial reordering
+  Sm sorted(old);
+  Index_maps sorted_maps(old);
+  sorted.collect_garbage<ConcurrencyTag>(sorted_maps, true);
+  check_same_elements(old, sorted, sorted_maps);
+
+  // without garbage
+  Sm sorted_again(sorted);
+  sorted_again.collect_garbage<ConcurrencyTag>(true);
+  assert(sorted_again.is_valid(false));
+  assert(sorted_again.number_of_faces() == sorted.number_of_faces());
+  assert(follow_their_first_vertex(sorted) && follow_their_first_vertex(sorted_again));
+
+  // a mesh whose elements are in a random order
+  Sm shuffled = shuffled_mesh(m_seq);
+  const double gap = average_index_gap(shuffled);
+  shuffled.collect_garbage<ConcurrencyTag>(true);
+  assert(shuffled.is_valid(false));
+  assert(shuffled.number_of_faces() == m_seq.number_of_faces());
+  assert(follow_their_first_vertex(shuffled));
+  assert(average_index_gap(shuffled) < 0.25 * gap);
+}
+
+int main()
+{
+  std::cout << "Sequential" << std::endl;
+  test<CGAL::Sequential_tag>();
+#ifdef CGAL_LINKED_WITH_TBB
+  std::cout << "Parallel" << std::endl;
+  test<CGAL::Parallel_tag>();
+#endif
+
+  std::cout << "done" << std::endl;
+  return 0;
+}
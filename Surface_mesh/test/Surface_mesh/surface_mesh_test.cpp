@@ -264,6 +264,75 @@ void move () {
   assert(num_faces(m2) == nf);
 }
 
+void bulk_construction () {
+  // a grid of (n+1)x(n+1) vertices, whose quads are split in two triangles
+  const std::size_t n = 20;
+  std::vector<Point_3> points;
+  std::vector<std::array<std::size_t, 3> > triangles;
+  for(std::size_t i=0; i<=n; ++i)
+    for(std::size_t j=0; j<=n; ++j)
+      points.emplace_back(double(i), double(j), 0.);
+  for(std::size_t i=0; i<n; ++i)
+    for(std::size_t j=0; j<n; ++j)
+    {
+      const std::size_t v = i * (n + 1) + j;
+      triangles.push_back({ v, v + n + 1, v + 1 });
+      triangles.push_back({ v + 1, v + n + 1, v + n + 2 });
+    }
+
+  Sm m;
+  Sm::Property_map<Sm::Vertex_index, int> label = m.add_property_map<Sm::Vertex_index, int>("v:label", 7).first;
+  Sm::Vertex_index first = m.add_vertices(points);
+  assert(first == Sm::Vertex_index(0) && m.number_of_vertices() == points.size());
+  assert(m.point(Sm::Vertex_index(5)) == points[5] && label[Sm::Vertex_index(5)] == 7);
+  assert(m.is_isolated(Sm::Vertex_index(5)));
+
+  bool ok = m.add_faces<CGAL::Parallel_if_available_tag>(triangles);
+  assert(ok);
+  assert(m.is_valid(false));
+  assert(m.number_of_faces() == triangles.size());
+  assert(m.number_of_edges() == 3 * n * n + 2 * n);
+  for(std::size_t f=0; f<triangles.size(); ++f)
+  {
+    Sm::Halfedge_index h = m.halfedge(Sm::Face_index(Sm::size_type(f)));
+    std::array<std::size_t, 3> t = triangles[f];
+    std::rotate(t.begin(), std::find(t.begin(), t.end(), std::size_t(m.source(h))), t.end());
+    assert(t[1] == std::size_t(m.target(h)) && t[2] == std::size_t(m.target(m.next(h))));
+  }
+
+  // the same mesh, built face by face
+  Sm m2;
+  for(const Point_3& p : points)
+    m2.add_vertex(p);
+  for(const std::array<std::size_t, 3>& t : triangles)
+    m2.add_face(Sm::Vertex_index(Sm::size_type(t[0])), Sm::Vertex_index(Sm::size_type(t[1])), Sm::Vertex_index(Sm::size_type(t[2])));
+  assert(m2.number_of_edges() == m.number_of_edges() && m2.number_of_halfedges() == m.number_of_halfedges());
+
+  // a tetrahedron next to the grid, given with vertex indices
+  const std::vector<Point_3> tetrahedron_points = { Point_3(0, 0, 1), Point_3(1, 0, 1), Point_3(0, 1, 1), Point_3(0, 0, 2) };
+  first = m.add_vertices(tetrahedron_points);
+  assert(first == Sm::Vertex_index(Sm::size_type(points.size())));
+  const Sm::Vertex_index a(first), b(first + 1), c(first + 2), d(first + 3);
+  std::vector<std::vector<Sm::Vertex_index> > tetrahedron = { { a, b, c }, { a, c, d }, { a, d, b }, { b, d, c } };
+  ok = m.add_faces(tetrahedron);
+  assert(ok && m.is_valid(false));
+  assert(m.number_of_faces() == triangles.size() + 4 && m.number_of_edges() == 3 * n * n + 2 * n + 6);
+
+  // the vertices are not isolated anymore
+  const Sm::size_type nf = m.number_of_faces(), ne = m.number_of_edges();
+  ok = m.add_faces(std::vector<std::vector<Sm::Vertex_index> >{ { a, b, c } });
+  assert(!ok);
+  // an out of range vertex
+  ok = m.add_faces(std::vector<std::vector<std::size_t> >{ { 0, 1, 1000000 } });
+  assert(!ok);
+  // a non-manifold edge
+  first = m.add_vertices(tetrahedron_points);
+  ok = m.add_faces(std::vector<std::vector<std::size_t> >{ { first, first + 1, first + 2 },
+                                                           { first + 1, first, first + 3 },
+                                                           { first, first + 1, first + 3 } });
+  assert(!ok);
+  assert(m.number_of_faces() == nf && m.number_of_edges() == ne && m.is_valid(false));
+}
 
 int main()
 {
@@ -279,6 +348,7 @@ int main()
   point_position_accessor();
   properties();
   move();
+  bulk_construction();
   std::cout << "done" << std::endl;
   return 0;
 }
@@ -10,14 +10,23 @@ It can be used to represent an orientable 2D triangulation
 embedded in a space of any dimension.
 
 The vertices and faces are stored in two nested containers, which are
-implemented using `Compact_container`. The class may offer some
-flexibility for the choice of container in the future, in the form of
-additional template parameters.
+implemented using `Compact_container`, or `Concurrent_compact_container`
+if `ConcurrencyTag` is `Parallel_tag`.
 
 \tparam VertexBase must be a model of `TriangulationDSVertexBase_2`. The default is `Triangulation_ds_vertex_base_2<TDS>`.
 
 \tparam FaceBase  must be a model of `TriangulationDSFaceBase_2`. The default is `Triangulation_ds_face_base_2<TDS>`.
 
+\tparam ConcurrencyTag enables the use of a concurrent
+container to store vertices and faces. It can be `Sequential_tag` (use of a
+`Compact_container` to store vertices and faces) or `Parallel_tag`
+(use of a `Concurrent_compact_container`). If it is
+`Parallel_tag`, the following functions can be called concurrently:
+`create_vertex()`, `create_face()`, `delete_vertex()`, and `delete_face()`,
+and the range insertion functions of `Delaunay_triangulation_2` and
+`Constrained_Delaunay_triangulation_2` insert points and constraints in parallel.
+`Sequential_tag` is the default value.
+
 \cgalModels{TriangulationDataStructure_2}
 
 \cgalHeading{Modifiers}
@@ -37,14 +46,17 @@ guarantee the combinatorial validity of the resulting data structure.
 \image html tds-insert_degree_2.png "Insertion and removal of degree 2 vertices. "
 \image latex tds-insert_degree_2.png "Insertion and removal of degree 2 vertices. "
 */
-template< typename VertexBase, typename FaceBase >
+template< typename VertexBase, typename FaceBase, typename ConcurrencyTag >
 class Triangulation_data_structure_2 {
 public:
 /// \name Types
 
 /// @{
 
-  typedef Triangulation_data_structure_2<VertexBase,FaceBase>  Tds;
+  typedef Triangulation_data_structure_2<VertexBase,FaceBase,ConcurrencyTag>  Tds;
+
+  /// The concurrency tag.
+  typedef ConcurrencyTag  Concurrency_tag;
 
   /// The vertex type.
   ///
@@ -65,12 +77,14 @@ public:
 /// @{
 
 /*!
-Vertex container type.
+Vertex container type. If `ConcurrencyTag` is `Parallel_tag`, a
+`Concurrent_compact_container` is used instead of a `Compact_container`.
 */
 typedef Compact_container<Vertex> Vertex_range;
 
 /*!
-Face container type.
+Face container type. If `ConcurrencyTag` is `Parallel_tag`, a
+`Concurrent_compact_container` is used instead of a `Compact_container`.
 */
 typedef Compact_container<Face> Face_range;
 
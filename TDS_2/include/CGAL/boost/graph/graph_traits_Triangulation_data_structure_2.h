@@ -35,8 +35,8 @@
 
 namespace boost {
 
-template <class VB, class FB>
-struct graph_traits<CGAL::Triangulation_data_structure_2<VB, FB> >
+template <class VB, class FB, class Ct>
+struct graph_traits<CGAL::Triangulation_data_structure_2<VB, FB, Ct> >
 {
   struct TDS2_graph_traversal_category :
       public virtual bidirectional_graph_tag,
@@ -44,7 +44,7 @@ struct graph_traits<CGAL::Triangulation_data_structure_2<VB, FB> >
       public virtual edge_list_graph_tag,
       public virtual vertex_list_graph_tag { };
 
-  typedef CGAL::Triangulation_data_structure_2<VB,FB> Triangulation_data_structure;
+  typedef CGAL::Triangulation_data_structure_2<VB,FB,Ct> Triangulation_data_structure;
 
   typedef typename Triangulation_data_structure::Vertex_handle                        vertex_descriptor;
   typedef CGAL::internal::TDS2_halfedge_descriptor<Triangulation_data_structure>      halfedge_descriptor;
@@ -80,161 +80,161 @@ struct graph_traits<CGAL::Triangulation_data_structure_2<VB, FB> >
   static halfedge_descriptor null_halfedge()   { return halfedge_descriptor(); }
 };
 
-template <class VB, class FB>
-struct graph_traits<const CGAL::Triangulation_data_structure_2<VB, FB> >
-  : public graph_traits< CGAL::Triangulation_data_structure_2<VB, FB> >
+template <class VB, class FB, class Ct>
+struct graph_traits<const CGAL::Triangulation_data_structure_2<VB, FB, Ct> >
+  : public graph_traits< CGAL::Triangulation_data_structure_2<VB, FB, Ct> >
 { };
 
 } // namespace boost
 
 namespace CGAL {
 
-template <class VB, class FB>
-typename boost::graph_traits< Triangulation_data_structure_2<VB,FB> >::halfedge_descriptor
-next(typename boost::graph_traits< Triangulation_data_structure_2<VB,FB> >::halfedge_descriptor e,
-     const Triangulation_data_structure_2<VB,FB>& )
+template <class VB, class FB, class Ct>
+typename boost::graph_traits< Triangulation_data_structure_2<VB,FB,Ct> >::halfedge_descriptor
+next(typename boost::graph_traits< Triangulation_data_structure_2<VB,FB,Ct> >::halfedge_descriptor e,
+     const Triangulation_data_structure_2<VB,FB,Ct>& )
 {
-  typedef typename boost::graph_traits< Triangulation_data_structure_2<VB,FB> >::halfedge_descriptor halfedge_descriptor;
-  return halfedge_descriptor(e.first, Triangulation_data_structure_2<VB,FB>::ccw(e.second));
+  typedef typename boost::graph_traits< Triangulation_data_structure_2<VB,FB,Ct> >::halfedge_descriptor halfedge_descriptor;
+  return halfedge_descriptor(e.first, Triangulation_data_structure_2<VB,FB,Ct>::ccw(e.second));
 }
 
-template <class VB, class FB>
-typename boost::graph_traits< Triangulation_data_structure_2<VB,FB> >::halfedge_descriptor
-prev(typename boost::graph_traits< Triangulation_data_structure_2<VB,FB> >::halfedge_descriptor e,
-     const Triangulation_data_structure_2<VB,FB>& )
+template <class VB, class FB, class Ct>
+typename boost::graph_traits< Triangulation_data_structure_2<VB,FB,Ct> >::halfedge_descriptor
+prev(typename boost::graph_traits< Triangulation_data_structure_2<VB,FB,Ct> >::halfedge_descriptor e,
+     const Triangulation_data_structure_2<VB,FB,Ct>& )
 {
-  typedef typename boost::graph_traits< Triangulation_data_structure_2<VB,FB> >::halfedge_descriptor halfedge_descriptor;
-  return halfedge_descriptor(e.first, Triangulation_data_structure_2<VB,FB>::cw(e.second));
+  typedef typename boost::graph_traits< Triangulation_data_structure_2<VB,FB,Ct> >::halfedge_descriptor halfedge_descriptor;
+  return halfedge_descriptor(e.first, Triangulation_data_structure_2<VB,FB,Ct>::cw(e.second));
 }
 
-template <class VB, class FB>
-typename boost::graph_traits< Triangulation_data_structure_2<VB,FB> >::halfedge_descriptor
-opposite(typename boost::graph_traits< Triangulation_data_structure_2<VB,FB> >::halfedge_descriptor e,
-         const Triangulation_data_structure_2<VB,FB>& g)
+template <class VB, class FB, class Ct>
+typename boost::graph_traits< Triangulation_data_structure_2<VB,FB,Ct> >::halfedge_descriptor
+opposite(typename boost::graph_traits< Triangulation_data_structure_2<VB,FB,Ct> >::halfedge_descriptor e,
+         const Triangulation_data_structure_2<VB,FB,Ct>& g)
 {
-  typedef typename Triangulation_data_structure_2<VB,FB>::Edge Edge;
-  typedef typename boost::graph_traits< Triangulation_data_structure_2<VB,FB> >::halfedge_descriptor halfedge_descriptor;
+  typedef typename Triangulation_data_structure_2<VB,FB,Ct>::Edge Edge;
+  typedef typename boost::graph_traits< Triangulation_data_structure_2<VB,FB,Ct> >::halfedge_descriptor halfedge_descriptor;
   return halfedge_descriptor(g.mirror_edge(Edge(e.first, e.second)));
 }
 
-template <class VB, class FB>
-typename boost::graph_traits< Triangulation_data_structure_2<VB,FB> >::vertex_descriptor
-source(typename boost::graph_traits< Triangulation_data_structure_2<VB,FB> >::edge_descriptor e,
-       const Triangulation_data_structure_2<VB,FB>& )
+template <class VB, class FB, class Ct>
+typename boost::graph_traits< Triangulation_data_structure_2<VB,FB,Ct> >::vertex_descriptor
+source(typename boost::graph_traits< Triangulation_data_structure_2<VB,FB,Ct> >::edge_descriptor e,
+       const Triangulation_data_structure_2<VB,FB,Ct>& )
 {
-  return e.first->vertex(Triangulation_data_structure_2<VB,FB>::ccw(e.second));
+  return e.first->vertex(Triangulation_data_structure_2<VB,FB,Ct>::ccw(e.second));
 }
 
-template <class VB, class FB>
-typename boost::graph_traits< Triangulation_data_structure_2<VB,FB> >::vertex_descriptor
-target(typename boost::graph_traits< Triangulation_data_structure_2<VB,FB> >::edge_descriptor e,
-       const Triangulation_data_structure_2<VB,FB>& )
+template <class VB, class FB, class Ct>
+typename boost::graph_traits< Triangulation_data_structure_2<VB,FB,Ct> >::vertex_descriptor
+target(typename boost::graph_traits< Triangulation_data_structure_2<VB,FB,Ct> >::edge_descriptor e,
+       const Triangulation_data_structure_2<VB,FB,Ct>& )
 {
-  return e.first->vertex(Triangulation_data_structure_2<VB,FB>::cw(e.second));
+  return e.first->vertex(Triangulation_data_structure_2<VB,FB,Ct>::cw(e.second));
 }
 
-template <class VB, class FB>
-typename boost::graph_traits< Triangulation_data_structure_2<VB,FB> >::vertex_descriptor
-source(typename boost::graph_traits< Triangulation_data_structure_2<VB,FB> >::halfedge_descriptor e,
-       const Triangulation_data_structure_2<VB,FB>& )
+template <class VB, class FB, class Ct>
+typename boost::graph_traits< Triangulation_data_structure_2<VB,FB,Ct> >::vertex_descriptor
+source(typename boost::graph_traits< Triangulation_data_structure_2<VB,FB,Ct> >::halfedge_descriptor e,
+       const Triangulation_data_structure_2<VB,FB,Ct>& )
 {
-  return e.first->vertex(Triangulation_data_structure_2<VB,FB>::ccw(e.second));
+  return e.first->vertex(Triangulation_data_structure_2<VB,FB,Ct>::ccw(e.second));
 }
 
-template <class VB, class FB>
-typename boost::graph_traits< Triangulation_data_structure_2<VB,FB> >::vertex_descriptor
-target(typename boost::graph_traits< Triangulation_data_structure_2<VB,FB> >::halfedge_descriptor e,
-       const Triangulation_data_structure_2<VB,FB>& )
+template <class VB, class FB, class Ct>
+typename boost::graph_traits< Triangulation_data_structure_2<VB,FB,Ct> >::vertex_descriptor
+target(typename boost::graph_traits< Triangulation_data_structure_2<VB,FB,Ct> >::halfedge_descriptor e,
+       const Triangulation_data_structure_2<VB,FB,Ct>& )
 {
-  return e.first->vertex(Triangulation_data_structure_2<VB,FB>::cw(e.second));
+  return e.first->vertex(Triangulation_data_structure_2<VB,FB,Ct>::cw(e.second));
 }
 
-template <class VB, class FB>
-typename boost::graph_traits< Triangulation_data_structure_2<VB,FB> >::face_descriptor
-face(typename boost::graph_traits< Triangulation_data_structure_2<VB,FB> >::halfedge_descriptor e,
-     const Triangulation_data_structure_2<VB,FB>&)
+template <class VB, class FB, class Ct>
+typename boost::graph_traits< Triangulation_data_structure_2<VB,FB,Ct> >::face_descriptor
+face(typename boost::graph_traits< Triangulation_data_structure_2<VB,FB,Ct> >::halfedge_descriptor e,
+     const Triangulation_data_structure_2<VB,FB,Ct>&)
 {
   return e.first;
 }
 
-template <class VB, class FB>
-typename boost::graph_traits< Triangulation_data_structure_2<VB,FB> >::halfedge_descriptor
-halfedge(typename boost::graph_traits< Triangulation_data_structure_2<VB,FB> >::face_descriptor f,
-         const Triangulation_data_structure_2<VB,FB>&)
+template <class VB, class FB, class Ct>
+typename boost::graph_traits< Triangulation_data_structure_2<VB,FB,Ct> >::halfedge_descriptor
+halfedge(typename boost::graph_traits< Triangulation_data_structure_2<VB,FB,Ct> >::face_descriptor f,
+         const Triangulation_data_structure_2<VB,FB,Ct>&)
 {
-  typedef typename boost::graph_traits< Triangulation_data_structure_2<VB,FB> >::halfedge_descriptor halfedge_descriptor;
+  typedef typename boost::graph_traits< Triangulation_data_structure_2<VB,FB,Ct> >::halfedge_descriptor halfedge_descriptor;
   return halfedge_descriptor(f,0);
 }
 
-template <class VB, class FB>
-typename boost::graph_traits< Triangulation_data_structure_2<VB,FB> >::halfedge_descriptor
-halfedge(typename boost::graph_traits< Triangulation_data_structure_2<VB,FB> >::vertex_descriptor v,
-         const Triangulation_data_structure_2<VB,FB>& )
+template <class VB, class FB, class Ct>
+typename boost::graph_traits< Triangulation_data_structure_2<VB,FB,Ct> >::halfedge_descriptor
+halfedge(typename boost::graph_traits< Triangulation_data_structure_2<VB,FB,Ct> >::vertex_descriptor v,
+         const Triangulation_data_structure_2<VB,FB,Ct>& )
 {
-  typedef typename boost::graph_traits< Triangulation_data_structure_2<VB,FB> >::halfedge_descriptor halfedge_descriptor;
-  typedef typename boost::graph_traits< Triangulation_data_structure_2<VB,FB> >::face_descriptor face_descriptor;
+  typedef typename boost::graph_traits< Triangulation_data_structure_2<VB,FB,Ct> >::halfedge_descriptor halfedge_descriptor;
+  typedef typename boost::graph_traits< Triangulation_data_structure_2<VB,FB,Ct> >::face_descriptor face_descriptor;
   face_descriptor fd = v->face();
   int i = fd->index(v);
-  return halfedge_descriptor(fd,Triangulation_data_structure_2<VB,FB>::ccw(i));
+  return halfedge_descriptor(fd,Triangulation_data_structure_2<VB,FB,Ct>::ccw(i));
 }
 
-template <class VB, class FB>
-typename boost::graph_traits< Triangulation_data_structure_2<VB,FB> >::halfedge_descriptor
-halfedge(typename boost::graph_traits< Triangulation_data_structure_2<VB,FB> >::edge_descriptor e,
-         const Triangulation_data_structure_2<VB,FB>&)
+template <class VB, class FB, class Ct>
+typename boost::graph_traits< Triangulation_data_structure_2<VB,FB,Ct> >::halfedge_descriptor
+halfedge(typename boost::graph_traits< Triangulation_data_structure_2<VB,FB,Ct> >::edge_descriptor e,
+         const Triangulation_data_structure_2<VB,FB,Ct>&)
 {
-  typedef typename boost::graph_traits< Triangulation_data_structure_2<VB,FB> >::halfedge_descriptor halfedge_descriptor;
+  typedef typename boost::graph_traits< Triangulation_data_structure_2<VB,FB,Ct> >::halfedge_descriptor halfedge_descriptor;
   return halfedge_descriptor(e.first, e.second);
 }
 
-template <class VB, class FB>
-typename boost::graph_traits< Triangulation_data_structure_2<VB,FB> >::edge_descriptor
-edge(typename boost::graph_traits< Triangulation_data_structure_2<VB,FB> >::halfedge_descriptor e,
-     const Triangulation_data_structure_2<VB,FB>&)
+template <class VB, class FB, class Ct>
+typename boost::graph_traits< Triangulation_data_structure_2<VB,FB,Ct> >::edge_descriptor
+edge(typename boost::graph_traits< Triangulation_data_structure_2<VB,FB,Ct> >::halfedge_descriptor e,
+     const Triangulation_data_structure_2<VB,FB,Ct>&)
 {
-  typedef typename boost::graph_traits< Triangulation_data_structure_2<VB,FB> >::edge_descriptor edge_descriptor;
+  typedef typename boost::graph_traits< Triangulation_data_structure_2<VB,FB,Ct> >::edge_descriptor edge_descriptor;
   return edge_descriptor(e.first,e.second);
 }
 
-template <class VB, class FB>
-inline Iterator_range<typename boost::graph_traits< Triangulation_data_structure_2<VB,FB> >::vertex_iterator>
-vertices(const Triangulation_data_structure_2<VB,FB>& g)
+template <class VB, class FB, class Ct>
+inline Iterator_range<typename boost::graph_traits< Triangulation_data_structure_2<VB,FB,Ct> >::vertex_iterator>
+vertices(const Triangulation_data_structure_2<VB,FB,Ct>& g)
 {
-  typedef typename boost::graph_traits< Triangulation_data_structure_2<VB,FB> >::vertex_iterator Iter;
+  typedef typename boost::graph_traits< Triangulation_data_structure_2<VB,FB,Ct> >::vertex_iterator Iter;
   return make_range(Iter(g.vertices_begin()), Iter(g.vertices_end()));
 }
 
-template <class VB, class FB>
-inline Iterator_range<typename boost::graph_traits< Triangulation_data_structure_2<VB,FB> >::edge_iterator>
-edges(const Triangulation_data_structure_2<VB,FB>& g)
+template <class VB, class FB, class Ct>
+inline Iterator_range<typename boost::graph_traits< Triangulation_data_structure_2<VB,FB,Ct> >::edge_iterator>
+edges(const Triangulation_data_structure_2<VB,FB,Ct>& g)
 {
-  typedef typename boost::graph_traits<Triangulation_data_structure_2<VB,FB> >::edge_iterator Iter;
+  typedef typename boost::graph_traits<Triangulation_data_structure_2<VB,FB,Ct> >::edge_iterator Iter;
   return make_range(Iter(g.edges_begin()), Iter(g.edges_end()));
 }
 
-template <class VB, class FB>
-inline Iterator_range<typename boost::graph_traits< Triangulation_data_structure_2<VB,FB> >::halfedge_iterator >
-halfedges(const Triangulation_data_structure_2<VB,FB>& g)
+template <class VB, class FB, class Ct>
+inline Iterator_range<typename boost::graph_traits< Triangulation_data_structure_2<VB,FB,Ct> >::halfedge_iterator >
+halfedges(const Triangulation_data_structure_2<VB,FB,Ct>& g)
 {
-  typedef typename boost::graph_traits< Triangulation_data_structure_2<VB,FB> >::halfedge_iterator Iter;
+  typedef typename boost::graph_traits< Triangulation_data_structure_2<VB,FB,Ct> >::halfedge_iterator Iter;
   return make_range(Iter(g.edges_begin()), Iter(g.edges_end()));
 }
 
-template <class VB, class FB>
-inline Iterator_range<typename boost::graph_traits< Triangulation_data_structure_2<VB,FB> >::face_iterator >
-faces(const Triangulation_data_structure_2<VB,FB>& g)
+template <class VB, class FB, class Ct>
+inline Iterator_range<typename boost::graph_traits< Triangulation_data_structure_2<VB,FB,Ct> >::face_iterator >
+faces(const Triangulation_data_structure_2<VB,FB,Ct>& g)
 {
-  typedef typename boost::graph_traits< Triangulation_data_structure_2<VB,FB> >::face_iterator Iter;
+  typedef typename boost::graph_traits< Triangulation_data_structure_2<VB,FB,Ct> >::face_iterator Iter;
   return make_range(Iter(g.faces_begin()), Iter(g.faces_end()));
 }
 
-template <class VB, class FB>
-typename boost::graph_traits< Triangulation_data_structure_2<VB,FB> >::degree_size_type
-out_degree(typename boost::graph_traits< Triangulation_data_structure_2<VB,FB> >::vertex_descriptor u,
-           const Triangulation_data_structure_2<VB,FB>& g)
+template <class VB, class FB, class Ct>
+typename boost::graph_traits< Triangulation_data_structure_2<VB,FB,Ct> >::degree_size_type
+out_degree(typename boost::graph_traits< Triangulation_data_structure_2<VB,FB,Ct> >::vertex_descriptor u,
+           const Triangulation_data_structure_2<VB,FB,Ct>& g)
 {
-  typename boost::graph_traits< Triangulation_data_structure_2<VB,FB> >::degree_size_type deg = 0;
-  typename Triangulation_data_structure_2<VB,FB>::Edge_circulator c = g.incident_edges(u), done(c);
+  typename boost::graph_traits< Triangulation_data_structure_2<VB,FB,Ct> >::degree_size_type deg = 0;
+  typename Triangulation_data_structure_2<VB,FB,Ct>::Edge_circulator c = g.incident_edges(u), done(c);
   if ( c != 0) {
     do {
       ++deg;
@@ -243,75 +243,75 @@ out_degree(typename boost::graph_traits< Triangulation_data_structure_2<VB,FB> >
   return deg;
 }
 
-template <class VB, class FB>
-inline Iterator_range<typename boost::graph_traits< Triangulation_data_structure_2<VB,FB> >::out_edge_iterator >
-out_edges(typename boost::graph_traits< Triangulation_data_structure_2<VB,FB> >::vertex_descriptor u,
-          const Triangulation_data_structure_2<VB,FB>& g)
+template <class VB, class FB, class Ct>
+inline Iterator_range<typename boost::graph_traits< Triangulation_data_structure_2<VB,FB,Ct> >::out_edge_iterator >
+out_edges(typename boost::graph_traits< Triangulation_data_structure_2<VB,FB,Ct> >::vertex_descriptor u,
+          const Triangulation_data_structure_2<VB,FB,Ct>& g)
 {
-  typename Triangulation_data_structure_2<VB,FB>::Edge_circulator ec(u,u->face());
-  typename boost::graph_traits< Triangulation_data_structure_2<VB,FB> >::degree_size_type out_deg = out_degree(u,g);
-  typedef typename boost::graph_traits< Triangulation_data_structure_2<VB,FB> >::out_edge_iterator Iter;
+  typename Triangulation_data_structure_2<VB,FB,Ct>::Edge_circulator ec(u,u->face());
+  typename boost::graph_traits< Triangulation_data_structure_2<VB,FB,Ct> >::degree_size_type out_deg = out_degree(u,g);
+  typedef typename boost::graph_traits< Triangulation_data_structure_2<VB,FB,Ct> >::out_edge_iterator Iter;
 
   return make_range(Iter(ec), Iter(ec,out_deg));
 }
 
-template <class VB, class FB>
-inline Iterator_range<typename boost::graph_traits< Triangulation_data_structure_2<VB,FB> >::in_edge_iterator >
-in_edges(typename boost::graph_traits< Triangulation_data_structure_2<VB,FB> >::vertex_descriptor u,
-         const Triangulation_data_structure_2<VB,FB>& g)
+template <class VB, class FB, class Ct>
+inline Iterator_range<typename boost::graph_traits< Triangulation_data_structure_2<VB,FB,Ct> >::in_edge_iterator >
+in_edges(typename boost::graph_traits< Triangulation_data_structure_2<VB,FB,Ct> >::vertex_descriptor u,
+         const Triangulation_data_structure_2<VB,FB,Ct>& g)
 {
-  typename Triangulation_data_structure_2<VB,FB>::Edge_circulator ec(u,u->face());
-  typename boost::graph_traits< Triangulation_data_structure_2<VB,FB> >::degree_size_type out_deg = out_degree(u,g);
-  typedef typename boost::graph_traits< Triangulation_data_structure_2<VB,FB> >::in_edge_iterator Iter;
+  typename Triangulation_data_structure_2<VB,FB,Ct>::Edge_circulator ec(u,u->face());
+  typename boost::graph_traits< Triangulation_data_structure_2<VB,FB,Ct> >::degree_size_type out_deg = out_degree(u,g);
+  typedef typename boost::graph_traits< Triangulation_data_structure_2<VB,FB,Ct> >::in_edge_iterator Iter;
   return make_range(Iter(ec), Iter(ec,out_deg));
 }
 
-template <class VB, class FB>
-inline Iterator_range<typename boost::graph_traits< Triangulation_data_structure_2<VB,FB> >::adjacency_iterator>
-adjacent_vertices(typename boost::graph_traits< Triangulation_data_structure_2<VB,FB> >::vertex_descriptor u,
-                  const Triangulation_data_structure_2<VB,FB>& g)
+template <class VB, class FB, class Ct>
+inline Iterator_range<typename boost::graph_traits< Triangulation_data_structure_2<VB,FB,Ct> >::adjacency_iterator>
+adjacent_vertices(typename boost::graph_traits< Triangulation_data_structure_2<VB,FB,Ct> >::vertex_descriptor u,
+                  const Triangulation_data_structure_2<VB,FB,Ct>& g)
 {
-  typename Triangulation_data_structure_2<VB,FB>::Vertex_circulator vc = out_edge_iterator(u,u.face());
-  typename boost::graph_traits< Triangulation_data_structure_2<VB,FB> >::degree_size_type out_deg = out_degree(u,g);
-  typedef typename boost::graph_traits< Triangulation_data_structure_2<VB,FB> >::adjacency_iterator Iter;
+  typename Triangulation_data_structure_2<VB,FB,Ct>::Vertex_circulator vc = out_edge_iterator(u,u.face());
+  typename boost::graph_traits< Triangulation_data_structure_2<VB,FB,Ct> >::degree_size_type out_deg = out_degree(u,g);
+  typedef typename boost::graph_traits< Triangulation_data_structure_2<VB,FB,Ct> >::adjacency_iterator Iter;
   return make_range( Iter(vc), Iter(vc,out_deg) );
 }
 
-template <class VB, class FB>
-typename boost::graph_traits< Triangulation_data_structure_2<VB,FB> >::vertices_size_type
-num_vertices(const Triangulation_data_structure_2<VB,FB>& g)
+template <class VB, class FB, class Ct>
+typename boost::graph_traits< Triangulation_data_structure_2<VB,FB,Ct> >::vertices_size_type
+num_vertices(const Triangulation_data_structure_2<VB,FB,Ct>& g)
 {
   return g.number_of_vertices();
 }
 
-template <class VB, class FB>
-typename boost::graph_traits< Triangulation_data_structure_2<VB,FB> >::edges_size_type
-num_edges(const Triangulation_data_structure_2<VB,FB>& g)
+template <class VB, class FB, class Ct>
+typename boost::graph_traits< Triangulation_data_structure_2<VB,FB,Ct> >::edges_size_type
+num_edges(const Triangulation_data_structure_2<VB,FB,Ct>& g)
 {
   return  g.number_of_vertices() + g.number_of_faces() - 2;
 }
 
-template <class VB, class FB>
-typename boost::graph_traits< Triangulation_data_structure_2<VB,FB> >::halfedges_size_type
-num_halfedges(const Triangulation_data_structure_2<VB,FB>& g)
+template <class VB, class FB, class Ct>
+typename boost::graph_traits< Triangulation_data_structure_2<VB,FB,Ct> >::halfedges_size_type
+num_halfedges(const Triangulation_data_structure_2<VB,FB,Ct>& g)
 {
   return num_edges(g) * 2;
 }
 
-template <class VB, class FB>
-typename boost::graph_traits< Triangulation_data_structure_2<VB,FB> >::faces_size_type
-num_faces(const Triangulation_data_structure_2<VB,FB>& g)
+template <class VB, class FB, class Ct>
+typename boost::graph_traits< Triangulation_data_structure_2<VB,FB,Ct> >::faces_size_type
+num_faces(const Triangulation_data_structure_2<VB,FB,Ct>& g)
 {
   return g.number_of_faces();
 }
 
-template <class VB, class FB>
-typename boost::graph_traits< Triangulation_data_structure_2<VB,FB> >::degree_size_type
-in_degree(typename boost::graph_traits< Triangulation_data_structure_2<VB,FB> >::vertex_descriptor u,
-          const Triangulation_data_structure_2<VB,FB>& g)
+template <class VB, class FB, class Ct>
+typename boost::graph_traits< Triangulation_data_structure_2<VB,FB,Ct> >::degree_size_type
+in_degree(typename boost::graph_traits< Triangulation_data_structure_2<VB,FB,Ct> >::vertex_descriptor u,
+          const Triangulation_data_structure_2<VB,FB,Ct>& g)
 {
-  typename boost::graph_traits< Triangulation_data_structure_2<VB,FB> >::degree_size_type deg = 0;
-  typename Triangulation_data_structure_2<VB,FB>::Edge_circulator c = g.incident_edges(u), done(c);
+  typename boost::graph_traits< Triangulation_data_structure_2<VB,FB,Ct> >::degree_size_type deg = 0;
+  typename Triangulation_data_structure_2<VB,FB,Ct>::Edge_circulator c = g.incident_edges(u), done(c);
   if ( c != 0) {
     do {
       ++deg;
@@ -320,13 +320,13 @@ in_degree(typename boost::graph_traits< Triangulation_data_structure_2<VB,FB> >:
   return deg;
 }
 
-template <class VB, class FB>
-typename boost::graph_traits< Triangulation_data_structure_2<VB,FB> >::degree_size_type
-degree(typename boost::graph_traits< Triangulation_data_structure_2<VB,FB> >::vertex_descriptor u,
-       const Triangulation_data_structure_2<VB,FB>& g)
+template <class VB, class FB, class Ct>
+typename boost::graph_traits< Triangulation_data_structure_2<VB,FB,Ct> >::degree_size_type
+degree(typename boost::graph_traits< Triangulation_data_structure_2<VB,FB,Ct> >::vertex_descriptor u,
+       const Triangulation_data_structure_2<VB,FB,Ct>& g)
 {
-  typename boost::graph_traits< Triangulation_data_structure_2<VB,FB> >::degree_size_type deg = 0;
-  typename Triangulation_data_structure_2<VB,FB>::Edge_circulator c = g.incident_edges(u), done(c);
+  typename boost::graph_traits< Triangulation_data_structure_2<VB,FB,Ct> >::degree_size_type deg = 0;
+  typename Triangulation_data_structure_2<VB,FB,Ct>::Edge_circulator c = g.incident_edges(u), done(c);
   if ( c != 0) {
     do {
       ++deg;
@@ -26,47 +26,47 @@ namespace CGAL {
 namespace internal {
 
 // property maps
-template <class VB, class FB>
+template <class VB, class FB, class Ct>
 class TDS2_vertex_point_map
 {
 public:
   typedef boost::lvalue_property_map_tag                                      category;
   typedef typename VB::Point                                                  value_type;
   typedef value_type&                                                         reference;
-  typedef typename CGAL::Triangulation_data_structure_2<VB,FB>::Vertex_handle key_type;
+  typedef typename CGAL::Triangulation_data_structure_2<VB,FB,Ct>::Vertex_handle key_type;
 
-  friend reference get(TDS2_vertex_point_map<VB,FB>, key_type vh) { return vh->point(); }
-  friend void put(TDS2_vertex_point_map<VB,FB>, key_type vh, const value_type& p) { vh->point() = p; }
+  friend reference get(TDS2_vertex_point_map<VB,FB,Ct>, key_type vh) { return vh->point(); }
+  friend void put(TDS2_vertex_point_map<VB,FB,Ct>, key_type vh, const value_type& p) { vh->point() = p; }
   reference operator[](key_type vh) const { return vh->point(); }
 };
 
-template <class VB, class FB>
+template <class VB, class FB, class Ct>
 class TDS2_edge_weight_map
 {
 public:
   typedef boost::readable_property_map_tag                           category;
   typedef typename VB::FT                                            value_type;
   typedef value_type                                                 reference;
-  typedef typename CGAL::Triangulation_data_structure_2<VB,FB>::Edge key_type;
+  typedef typename CGAL::Triangulation_data_structure_2<VB,FB,Ct>::Edge key_type;
 
-  TDS2_edge_weight_map(const CGAL::Triangulation_data_structure_2<VB,FB>& tds_) : tds(tds_) { }
+  TDS2_edge_weight_map(const CGAL::Triangulation_data_structure_2<VB,FB,Ct>& tds_) : tds(tds_) { }
 
   value_type operator[](key_type e) const { return approximate_sqrt(tds.segment(e).squared_length()); }
 
   friend inline value_type get(const TDS2_edge_weight_map& m, const key_type k) { return m[k]; }
 
 private:
-  const CGAL::Triangulation_data_structure_2<VB,FB>& tds;
+  const CGAL::Triangulation_data_structure_2<VB,FB,Ct>& tds;
 };
 
-template <class VB, class FB>
+template <class VB, class FB, class Ct>
 class TDS2_vertex_id_map
 {
 public:
   typedef boost::readable_property_map_tag                                    category;
   typedef int                                                                 value_type;
   typedef int                                                                 reference;
-  typedef typename CGAL::Triangulation_data_structure_2<VB,FB>::Vertex_handle key_type;
+  typedef typename CGAL::Triangulation_data_structure_2<VB,FB,Ct>::Vertex_handle key_type;
 
   TDS2_vertex_id_map() {}
 
@@ -75,10 +75,10 @@ public:
   friend inline value_type get(const TDS2_vertex_id_map& m, const key_type k) { return m[k]; }
 };
 
-template <class VB, class FB>
+template <class VB, class FB, class Ct>
 class TDS2_halfedge_id_map
 {
-  typedef typename CGAL::Triangulation_data_structure_2<VB,FB>     TDS;
+  typedef typename CGAL::Triangulation_data_structure_2<VB,FB,Ct>     TDS;
 
 public:
   typedef boost::readable_property_map_tag                         category;
@@ -106,10 +106,10 @@ public:
   friend inline value_type get(const TDS2_halfedge_id_map& m, const key_type k) { return m[k]; }
 };
 
-template <class VB, class FB>
+template <class VB, class FB, class Ct>
 class TDS2_edge_id_map
 {
-  typedef typename CGAL::Triangulation_data_structure_2<VB,FB>       TDS;
+  typedef typename CGAL::Triangulation_data_structure_2<VB,FB,Ct>       TDS;
 
 public:
   typedef boost::readable_property_map_tag                           category;
@@ -135,10 +135,10 @@ public:
   friend inline value_type get(const TDS2_edge_id_map& m, const key_type k) { return m[k]; }
 };
 
-template <class VB, class FB>
+template <class VB, class FB, class Ct>
 class TDS2_face_id_map
 {
-  typedef typename CGAL::Triangulation_data_structure_2<VB,FB>     TDS;
+  typedef typename CGAL::Triangulation_data_structure_2<VB,FB,Ct>     TDS;
 
 public:
   typedef boost::readable_property_map_tag                         category;
@@ -153,138 +153,138 @@ public:
   friend inline value_type get(const TDS2_face_id_map& m, const key_type k) { return m[k]; }
 };
 
-template <class VB, class FB, class Tag>
+template <class VB, class FB, class Ct, class Tag>
 struct TDS2_property_map { };
 
-template <class VB, class FB>
-struct TDS2_property_map<VB, FB, boost::vertex_point_t>
+template <class VB, class FB, class Ct>
+struct TDS2_property_map<VB, FB, Ct, boost::vertex_point_t>
 {
-  typedef internal::TDS2_vertex_point_map<VB,FB> type;
-  typedef internal::TDS2_vertex_point_map<VB,FB> const_type;
+  typedef internal::TDS2_vertex_point_map<VB,FB,Ct> type;
+  typedef internal::TDS2_vertex_point_map<VB,FB,Ct> const_type;
 };
 
-template <class VB, class FB>
-struct TDS2_property_map<VB, FB, boost::edge_weight_t>
+template <class VB, class FB, class Ct>
+struct TDS2_property_map<VB, FB, Ct, boost::edge_weight_t>
 {
-  typedef internal::TDS2_edge_weight_map<VB,FB> type;
-  typedef internal::TDS2_edge_weight_map<VB,FB> const_type;
+  typedef internal::TDS2_edge_weight_map<VB,FB,Ct> type;
+  typedef internal::TDS2_edge_weight_map<VB,FB,Ct> const_type;
 };
 
-template <class VB, class FB>
-struct TDS2_property_map<VB, FB, boost::vertex_index_t>
+template <class VB, class FB, class Ct>
+struct TDS2_property_map<VB, FB, Ct, boost::vertex_index_t>
 {
-  typedef internal::TDS2_vertex_id_map<VB,FB> type;
-  typedef internal::TDS2_vertex_id_map<VB,FB> const_type;
+  typedef internal::TDS2_vertex_id_map<VB,FB,Ct> type;
+  typedef internal::TDS2_vertex_id_map<VB,FB,Ct> const_type;
 };
 
-template <class VB, class FB>
-struct TDS2_property_map<VB, FB, boost::halfedge_index_t>
+template <class VB, class FB, class Ct>
+struct TDS2_property_map<VB, FB, Ct, boost::halfedge_index_t>
 {
-  typedef internal::TDS2_vertex_id_map<VB,FB> type;
-  typedef internal::TDS2_vertex_id_map<VB,FB> const_type;
+  typedef internal::TDS2_vertex_id_map<VB,FB,Ct> type;
+  typedef internal::TDS2_vertex_id_map<VB,FB,Ct> const_type;
 };
 
-template <class VB, class FB>
-struct TDS2_property_map<VB, FB, boost::edge_index_t>
+template <class VB, class FB, class Ct>
+struct TDS2_property_map<VB, FB, Ct, boost::edge_index_t>
 {
-  typedef internal::TDS2_edge_id_map<VB,FB> type;
-  typedef internal::TDS2_edge_id_map<VB,FB> const_type;
+  typedef internal::TDS2_edge_id_map<VB,FB,Ct> type;
+  typedef internal::TDS2_edge_id_map<VB,FB,Ct> const_type;
 };
 
-template <class VB, class FB>
-struct TDS2_property_map<VB, FB, boost::face_index_t>
+template <class VB, class FB, class Ct>
+struct TDS2_property_map<VB, FB, Ct, boost::face_index_t>
 {
-  typedef internal::TDS2_vertex_id_map<VB,FB> type;
-  typedef internal::TDS2_vertex_id_map<VB,FB> const_type;
+  typedef internal::TDS2_vertex_id_map<VB,FB,Ct> type;
+  typedef internal::TDS2_vertex_id_map<VB,FB,Ct> const_type;
 };
 
 } // end namespace internal
 
-template <class VB, class FB >
-struct graph_has_property<CGAL::Triangulation_data_structure_2<VB, FB>, boost::vertex_point_t>
+template <class VB, class FB, class Ct >
+struct graph_has_property<CGAL::Triangulation_data_structure_2<VB, FB, Ct>, boost::vertex_point_t>
   : CGAL::Tag_true{};
-template<class VB, class FB >
-struct graph_has_property<CGAL::Triangulation_data_structure_2<VB, FB>, boost::edge_weight_t>
+template<class VB, class FB, class Ct >
+struct graph_has_property<CGAL::Triangulation_data_structure_2<VB, FB, Ct>, boost::edge_weight_t>
   : CGAL::Tag_true{};
 
-template<class VB, class FB >
-struct graph_has_property<CGAL::Triangulation_data_structure_2<VB, FB>, boost::vertex_index_t>
+template<class VB, class FB, class Ct >
+struct graph_has_property<CGAL::Triangulation_data_structure_2<VB, FB, Ct>, boost::vertex_index_t>
   : CGAL::Boolean_tag<
       CGAL::internal::Has_member_id<
-        typename CGAL::Triangulation_data_structure_2<VB, FB>::Vertex
+        typename CGAL::Triangulation_data_structure_2<VB, FB, Ct>::Vertex
       >::value
     >
 {};
-template<class VB, class FB >
-struct graph_has_property<CGAL::Triangulation_data_structure_2<VB, FB>, boost::halfedge_index_t>
+template<class VB, class FB, class Ct >
+struct graph_has_property<CGAL::Triangulation_data_structure_2<VB, FB, Ct>, boost::halfedge_index_t>
   : CGAL::Boolean_tag<
       CGAL::internal::Has_member_id<
-        typename CGAL::Triangulation_data_structure_2<VB, FB>::Face
+        typename CGAL::Triangulation_data_structure_2<VB, FB, Ct>::Face
       >::value
     >
 {};
-template<class VB, class FB >
-struct graph_has_property<CGAL::Triangulation_data_structure_2<VB, FB>, boost::edge_index_t>
+template<class VB, class FB, class Ct >
+struct graph_has_property<CGAL::Triangulation_data_structure_2<VB, FB, Ct>, boost::edge_index_t>
   : CGAL::Boolean_tag<
       CGAL::internal::Has_member_id<
-        typename CGAL::Triangulation_data_structure_2<VB, FB>::Face
+        typename CGAL::Triangulation_data_structure_2<VB, FB, Ct>::Face
       >::value
     >
 {};
-template<class VB, class FB >
-struct graph_has_property<CGAL::Triangulation_data_structure_2<VB, FB>, boost::face_index_t>
+template<class VB, class FB, class Ct >
+struct graph_has_property<CGAL::Triangulation_data_structure_2<VB, FB, Ct>, boost::face_index_t>
   : CGAL::Boolean_tag<
       CGAL::internal::Has_member_id<
-        typename CGAL::Triangulation_data_structure_2<VB, FB>::Face
+        typename CGAL::Triangulation_data_structure_2<VB, FB, Ct>::Face
       >::value
     >
 {};
 
-template <class VB, class FB>
-inline internal::TDS2_vertex_point_map<VB,FB>
-get(boost::vertex_point_t, const Triangulation_data_structure_2<VB,FB>&)
+template <class VB, class FB, class Ct>
+inline internal::TDS2_vertex_point_map<VB,FB,Ct>
+get(boost::vertex_point_t, const Triangulation_data_structure_2<VB,FB,Ct>&)
 {
-  internal::TDS2_vertex_point_map<VB,FB> m;
+  internal::TDS2_vertex_point_map<VB,FB,Ct> m;
   return m;
 }
 
-template <class VB, class FB>
-inline internal::TDS2_edge_weight_map<VB,FB>
-get(boost::edge_weight_t, const Triangulation_data_structure_2<VB,FB>& g)
+template <class VB, class FB, class Ct>
+inline internal::TDS2_edge_weight_map<VB,FB,Ct>
+get(boost::edge_weight_t, const Triangulation_data_structure_2<VB,FB,Ct>& g)
 {
-  internal::TDS2_edge_weight_map<VB,FB> m(g);
+  internal::TDS2_edge_weight_map<VB,FB,Ct> m(g);
   return m;
 }
 
-template <class VB, class FB>
-inline internal::TDS2_vertex_id_map<VB,FB>
-get(boost::vertex_index_t, const Triangulation_data_structure_2<VB,FB>&)
+template <class VB, class FB, class Ct>
+inline internal::TDS2_vertex_id_map<VB,FB,Ct>
+get(boost::vertex_index_t, const Triangulation_data_structure_2<VB,FB,Ct>&)
 {
-  internal::TDS2_vertex_id_map<VB,FB> m;
+  internal::TDS2_vertex_id_map<VB,FB,Ct> m;
   return m;
 }
 
-template <class VB, class FB>
-inline internal::TDS2_halfedge_id_map<VB,FB>
-get(boost::halfedge_index_t, const Triangulation_data_structure_2<VB,FB>&)
+template <class VB, class FB, class Ct>
+inline internal::TDS2_halfedge_id_map<VB,FB,Ct>
+get(boost::halfedge_index_t, const Triangulation_data_structure_2<VB,FB,Ct>&)
 {
-  internal::TDS2_halfedge_id_map<VB,FB> m;
+  internal::TDS2_halfedge_id_map<VB,FB,Ct> m;
   return m;
 }
 
-template <class VB, class FB>
-inline internal::TDS2_edge_id_map<VB,FB>
-get(boost::edge_index_t, const Triangulation_data_structure_2<VB,FB>&)
+template <class VB, class FB, class Ct>
+inline internal::TDS2_edge_id_map<VB,FB,Ct>
+get(boost::edge_index_t, const Triangulation_data_structure_2<VB,FB,Ct>&)
 {
-  internal::TDS2_edge_id_map<VB,FB> m;
+  internal::TDS2_edge_id_map<VB,FB,Ct> m;
   return m;
 }
 
-template <class VB, class FB>
-inline internal::TDS2_face_id_map<VB,FB>
-get(boost::face_index_t, const Triangulation_data_structure_2<VB,FB>&)
+template <class VB, class FB, class Ct>
+inline internal::TDS2_face_id_map<VB,FB,Ct>
+get(boost::face_index_t, const Triangulation_data_structure_2<VB,FB,Ct>&)
 {
-  internal::TDS2_face_id_map<VB,FB> m;
+  internal::TDS2_face_id_map<VB,FB,Ct> m;
   return m;
 }
 
@@ -293,18 +293,18 @@ get(boost::face_index_t, const Triangulation_data_structure_2<VB,FB>&)
 namespace boost {
 
 #define CGAL_PM_SPECIALIZATION(TAG) \
-template <class VB, class FB> \
-struct property_map<CGAL::Triangulation_data_structure_2<VB,FB>, TAG> \
+template <class VB, class FB, class Ct> \
+struct property_map<CGAL::Triangulation_data_structure_2<VB,FB,Ct>, TAG> \
 { \
-  typedef typename CGAL::internal::TDS2_property_map<VB, FB, TAG> map_gen; \
+  typedef typename CGAL::internal::TDS2_property_map<VB, FB, Ct, TAG> map_gen; \
   typedef typename map_gen::type type; \
   typedef typename map_gen::const_type const_type; \
 }; \
 \
-template <class VB, class FB> \
-struct property_map<const CGAL::Triangulation_data_structure_2<VB,FB>, TAG> \
+template <class VB, class FB, class Ct> \
+struct property_map<const CGAL::Triangulation_data_structure_2<VB,FB,Ct>, TAG> \
 { \
-  typedef typename CGAL::internal::TDS2_property_map<VB, FB, TAG> map_gen; \
+  typedef typename CGAL::internal::TDS2_property_map<VB, FB, Ct, TAG> map_gen; \
   typedef typename map_gen::type type; \
   typedef typename map_gen::const_type const_type; \
 };
@@ -322,21 +322,21 @@ CGAL_PM_SPECIALIZATION(face_index_t)
 
 namespace CGAL {
 
-template <class VB, class FB, class PropertyTag, class Key>
+template <class VB, class FB, class Ct, class PropertyTag, class Key>
 inline
 typename boost::property_traits<
-typename boost::property_map<Triangulation_data_structure_2<VB,FB>,PropertyTag>::const_type>::value_type
-get(PropertyTag p, const Triangulation_data_structure_2<VB,FB>& g, const Key& key)
+typename boost::property_map<Triangulation_data_structure_2<VB,FB,Ct>,PropertyTag>::const_type>::value_type
+get(PropertyTag p, const Triangulation_data_structure_2<VB,FB,Ct>& g, const Key& key)
 {
   return get(get(p, g), key);
 }
 
-template <class VB, class FB, class PropertyTag, class Key,class Value>
+template <class VB, class FB, class Ct, class PropertyTag, class Key,class Value>
 inline void
-put(PropertyTag p, Triangulation_data_structure_2<VB,FB>& g,
+put(PropertyTag p, Triangulation_data_structure_2<VB,FB,Ct>& g,
     const Key& key, const Value& value)
 {
-  typedef typename boost::property_map<Triangulation_data_structure_2<VB,FB>, PropertyTag>::type Map;
+  typedef typename boost::property_map<Triangulation_data_structure_2<VB,FB,Ct>, PropertyTag>::type Map;
   Map pmap = get(p, g);
   put(pmap, key, value);
 }
@@ -346,13 +346,13 @@ put(PropertyTag p, Triangulation_data_structure_2<VB,FB>& g,
 namespace boost {
 
 // What are those needed for ???
-template <typename VB, typename FB>
-struct edge_property_type<CGAL::Triangulation_data_structure_2<VB,FB> > {
+template <typename VB, typename FB, typename Ct>
+struct edge_property_type<CGAL::Triangulation_data_structure_2<VB,FB,Ct> > {
   typedef void type;
 };
 
-template <typename VB, typename FB>
-struct vertex_property_type<CGAL::Triangulation_data_structure_2<VB,FB> > {
+template <typename VB, typename FB, typename Ct>
+struct vertex_property_type<CGAL::Triangulation_data_structure_2<VB,FB,Ct> > {
   typedef void type;
 };
 
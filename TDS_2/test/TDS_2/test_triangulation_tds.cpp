@@ -29,6 +29,15 @@
 #include <CGAL/_test_cls_tds_2.h>
 #include <CGAL/boost/graph/IO/Tds_2_off.h>
 
+#ifdef CGAL_LINKED_WITH_TBB
+#include <CGAL/Simple_cartesian.h>
+#include <CGAL/Projection_traits_xy_3.h>
+#include <CGAL/Triangulation_vertex_base_2.h>
+#include <CGAL/Triangulation_face_base_2.h>
+#include <CGAL/boost/graph/graph_traits_Triangulation_data_structure_2.h>
+#include <sstream>
+#endif
+
 
 
 typedef CGAL::Triangulation_ds_vertex_base_2<>     Vb;
@@ -59,5 +68,29 @@ int main()
    typedef CGAL::Triangulation_data_structure_using_list_2<Vb,Fb> Cls3;
 
   _test_cls_tds_2( Cls3());
+
+#ifdef CGAL_LINKED_WITH_TBB
+  std::cout << "Testing a concurrency-safe Triangulation_data_structure_2 as a graph"
+            << std::endl;
+  // the vertices of an OFF file are 3D points
+  typedef CGAL::Projection_traits_xy_3<CGAL::Simple_cartesian<double> > K;
+  typedef CGAL::Triangulation_data_structure_2<CGAL::Triangulation_vertex_base_2<K>,
+                                               CGAL::Triangulation_face_base_2<K>,
+                                               CGAL::Parallel_tag> Cls4;
+  Cls4 tds4;
+  std::istringstream tetrahedron("OFF\n4 4 0\n0 0 0\n1 0 0\n0 1 0\n0 0 1\n"
+                                 "3 0 2 1\n3 0 1 3\n3 0 3 2\n3 1 2 3\n");
+  CGAL::IO::off_file_input(tetrahedron, tds4);
+  assert(tds4.is_valid());
+  assert(num_vertices(tds4) == 4 && num_edges(tds4) == 6 && num_faces(tds4) == 4);
+  for(auto h : halfedges(tds4))
+  {
+    assert(opposite(opposite(h, tds4), tds4) == h);
+    assert(next(prev(h, tds4), tds4) == h);
+    assert(source(next(h, tds4), tds4) == target(h, tds4));
+  }
+  for(auto v : vertices(tds4))
+    assert(get(boost::vertex_point, tds4, v) == v->point());
+#endif
   return 0;
 }
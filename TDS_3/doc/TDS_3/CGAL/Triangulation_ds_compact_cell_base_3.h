@@ -0,0 +1,28 @@
+
+namespace CGAL {
+
+/*!
+\ingroup PkgTDS3Classes
+
+The class `Triangulation_ds_compact_cell_base_3<>` is a model for the concept
+`TriangulationDSCellBase_3` to be used by
+`Triangulation_data_structure_3`, which stores the vertices and neighbors
+of the cell as 32-bit indices instead of handles.
+
+It must be used together with `Triangulation_ds_compact_vertex_base_3`
+(see Section \ref tds3compact).
+
+\cgalModels{TriangulationDSCellBase_3}
+
+\tparam TDS should not be specified (see Section \ref tds3cyclic and examples)
+
+\sa `CGAL::Triangulation_ds_cell_base_3`
+\sa `CGAL::Triangulation_ds_compact_vertex_base_3`
+
+*/
+template< typename TDS = void >
+class Triangulation_ds_compact_cell_base_3 {
+public:
+
+}; /* end Triangulation_ds_compact_cell_base_3 */
+} /* end namespace CGAL */
@@ -0,0 +1,26 @@
+namespace CGAL {
+
+/*!
+\ingroup PkgTDS3Classes
+
+The class `Triangulation_ds_compact_vertex_base_3` can be used as the base vertex
+for a 3D-triangulation data structure, it is a model of the concept
+`TriangulationDSVertexBase_3`, which stores its incident cell as a 32-bit
+index instead of a handle.
+
+It must be used together with `Triangulation_ds_compact_cell_base_3`
+(see Section \ref tds3compact).
+
+\cgalModels{TriangulationDSVertexBase_3}
+
+\tparam TDS should not be specified (see Section \ref tds3cyclic and examples)
+
+\sa `CGAL::Triangulation_ds_vertex_base_3`
+\sa `CGAL::Triangulation_ds_compact_cell_base_3`
+
+*/
+template< typename TDS = void >
+class Triangulation_ds_compact_vertex_base_3 {
+
+}; /* end Triangulation_ds_compact_vertex_base_3 */
+} /* end namespace CGAL */
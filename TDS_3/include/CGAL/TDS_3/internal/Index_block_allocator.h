@@ -0,0 +1,244 @@
+// Copyright (c) 2026 GeometryFactory (France).  All rights reserved.
+//
+// This file is part of CGAL (www.cgal.org)
+//
+// $URL$
+// $Id$
+// SPDX-License-Identifier: GPL-3.0-or-later OR LicenseRef-Commercial
+//
+// Author(s)     : GeometryFactory
+
+#ifndef CGAL_INTERNAL_TDS_3_INDEX_BLOCK_ALLOCATOR_H
+#define CGAL_INTERNAL_TDS_3_INDEX_BLOCK_ALLOCATOR_H
+
+#include <CGAL/license/TDS_3.h>
+
+#include <CGAL/assertions.h>
+
+#include <boost/mpl/has_xxx.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <mutex>
+#include <new>
+
+namespace CGAL { namespace internal {
+
+// The compact vertex and cell bases of the TDS define the nested type
+// `Index_storage`: their elements must then be allocated in `Index_blocks`.
+BOOST_MPL_HAS_XXX_TRAIT_NAMED_DEF(Has_index_storage, Index_storage, false)
+
+// Storage of the blocks of the `Compact_container`s of `T` whose elements
+// can be referred to by a 32-bit index instead of a pointer.
+//
+// Each block is aligned on `block_alignment` and contains a header storing
+// the id of the block, followed by at most `2^offset_bits` elements.  The
+// header is not at the beginning of the block but in one of its first cache
+// lines, chosen from the address of the block, as the headers of all blocks
+// would otherwise be mapped to the same cache set.  The
+// blocks of all the containers of `T` are registered in a global table, so that
+//  - the index of an element is `(block id, offset in the block)`, both found
+//    from its address alone;
+//  - the address of an element is found from its index by a table lookup.
+// The two low bits of an index are zero, as required by `Compact_container`
+// for the pointer it squats, and the index `0` refers to the first boundary
+// element of the block `0` and is used for the null handle.
+template <class T>
+class Index_blocks
+{
+public:
+  typedef std::uint32_t   Index;
+
+private:
+  static constexpr std::size_t block_alignment = std::size_t(1) << 16;
+  static constexpr std::size_t header_size = (std::max)(alignof(T), sizeof(Index));
+  static constexpr std::size_t nb_header_positions = 16;
+  static constexpr std::size_t max_header_position = (nb_header_positions - 1) * 64;
+
+  static constexpr unsigned int compute_offset_bits()
+  {
+    unsigned int b = 0;
+    while(max_header_position + header_size + (std::size_t(2) << b) * sizeof(T) <= block_alignment)
+      ++b;
+    return b;
+  }
+
+  static const char* block_base(const void* p)
+  {
+    return reinterpret_cast<const char*>(
+      reinterpret_cast<std::uintptr_t>(p) & ~std::uintptr_t(block_alignment - 1));
+  }
+
+  static std::size_t header_position(const void* base)
+  {
+    return ((reinterpret_cast<std::uintptr_t>(base) / block_alignment) % nb_header_positions) * 64;
+  }
+
+public:
+  static constexpr unsigned int offset_bits = compute_offset_bits();
+  static constexpr unsigned int id_bits = (std::min)(30u - offset_bits, 22u);
+
+  static_assert(offset_bits >= 5, "The elements are too large for the index storage");
+  static_assert(block_alignment % alignof(T) == 0,
+                "The alignment of the elements is not supported by the index storage");
+
+  // largest number of elements of a block
+  static constexpr std::size_t max_size() { return std::size_t(1) << offset_bits; }
+
+  static T* allocate(std::size_t n)
+  {
+    if(n > max_size())
+      throw std::bad_array_new_length();
+
+    const std::size_t c = cache_index(n);
+    if(c < nb_cached_sizes)
+    {
+      std::lock_guard<std::mutex> lock(mutex);
+      if(cached[c] != nullptr)
+      {
+        T* first = cached[c];
+        std::memcpy(&cached[c], first, sizeof(T*));
+        --nb_cached[c];
+        return first;
+      }
+    }
+
+    char* base = static_cast<char*>(::operator new(max_header_position + header_size + n * sizeof(T),
+                                                   std::align_val_t(block_alignment)));
+    char* header = base + header_position(base);
+    T* first = reinterpret_cast<T*>(header + header_size);
+
+    std::lock_guard<std::mutex> lock(mutex);
+    const Index nb_ids = Index(1) << id_bits;
+    Index i = 0;
+    while(i < nb_ids && blocks[(next_id + i) % nb_ids] != nullptr)
+      ++i;
+    if(i == nb_ids)
+    {
+      ::operator delete(base, std::align_val_t(block_alignment));
+      throw std::bad_alloc();
+    }
+    const Index id = (next_id + i) % nb_ids;
+    next_id = (id + 1) % nb_ids;
+    *reinterpret_cast<Index*>(header) = id;
+    blocks[id] = first;
+    return first;
+  }
+
+  static void deallocate(T* p, std::size_t n)
+  {
+    const std::size_t c = cache_index(n);
+    if(c < nb_cached_sizes)
+    {
+      std::lock_guard<std::mutex> lock(mutex);
+      if(nb_cached[c] < max_nb_cached)
+      {
+        std::memcpy(p, &cached[c], sizeof(T*));
+        cached[c] = p;
+        ++nb_cached[c];
+        return;
+      }
+    }
+
+    const char* header = reinterpret_cast<const char*>(p) - header_size;
+    {
+      std::lock_guard<std::mutex> lock(mutex);
+      blocks[*reinterpret_cast<const Index*>(header)] = nullptr;
+    }
+    ::operator delete(const_cast<char*>(block_base(p)), std::align_val_t(block_alignment));
+  }
+
+  // index of the element at `p` (`0` if `p` is null)
+  static Index index(const T* p)
+  {
+    if(p == nullptr)
+      return 0;
+    const char* base = block_base(p);
+    const char* header = base + header_position(base);
+    const Index id = *reinterpret_cast<const Index*>(header);
+    const T* first = reinterpret_cast<const T*>(header + header_size);
+    const Index offset = Index(p - first);
+    CGAL_assertion(blocks[id] == first);
+    return (id << (offset_bits + 2)) | (offset << 2);
+  }
+
+  // address of the element of index `i` (null if `i` is `0`)
+  static T* address(Index i)
+  {
+    if(i == 0)
+      return nullptr;
+    return blocks[i >> (offset_bits + 2)] + ((i >> 2) & ((Index(1) << offset_bits) - 1));
+  }
+
+private:
+  // The small blocks, which are constantly allocated and deallocated by the
+  // temporary triangulations of the removal of a vertex, are recycled: the
+  // deallocated blocks of `16*(c+1)` elements are kept in the list `cached[c]`,
+  // linked by their first element.
+  static constexpr std::size_t nb_cached_sizes = 16;
+  static constexpr std::size_t max_nb_cached = 16;
+
+  static std::size_t cache_index(std::size_t n)
+  {
+    return (n % 16 == 0 && n != 0 && sizeof(T) >= sizeof(T*)) ? n / 16 - 1 : nb_cached_sizes;
+  }
+
+  inline static T* blocks[std::size_t(1) << id_bits] = {};
+  inline static Index next_id = 0;
+  inline static T* cached[nb_cached_sizes] = {};
+  inline static std::size_t nb_cached[nb_cached_sizes] = {};
+  inline static std::mutex mutex;
+};
+
+// Allocator of the blocks of a `Compact_container` in `Index_blocks`.
+// It does not depend on the size of `T` until it is used, as `T` is incomplete
+// when the container type is defined in the TDS.
+template <class T>
+class Index_block_allocator
+{
+public:
+  typedef T               value_type;
+  typedef T*              pointer;
+  typedef const T*        const_pointer;
+  typedef std::size_t     size_type;
+  typedef std::ptrdiff_t  difference_type;
+
+  template <class U>
+  struct rebind { typedef Index_block_allocator<U> other; };
+
+  Index_block_allocator() noexcept {}
+  template <class U>
+  Index_block_allocator(const Index_block_allocator<U>&) noexcept {}
+
+  size_type max_size() const noexcept { return Index_blocks<T>::max_size(); }
+
+  T* allocate(size_type n) { return Index_blocks<T>::allocate(n); }
+  void deallocate(T* p, size_type n) { Index_blocks<T>::deallocate(p, n); }
+
+  friend bool operator==(const Index_block_allocator&, const Index_block_allocator&) { return true; }
+  friend bool operator!=(const Index_block_allocator&, const Index_block_allocator&) { return false; }
+};
+
+// The pointer squatted by `Compact_container` in an element that stores
+// 32-bit indices is split in two of them.
+inline void* join_pointer(std::uint32_t low, std::uint32_t high)
+{
+  if constexpr(sizeof(void*) > sizeof(std::uint32_t))
+    return reinterpret_cast<void*>(std::uintptr_t((std::uint64_t(high) << 32) | low));
+  else
+    return reinterpret_cast<void*>(std::uintptr_t(low));
+}
+
+inline void split_pointer(void* p, std::uint32_t& low, std::uint32_t& high)
+{
+  const std::uintptr_t u = reinterpret_cast<std::uintptr_t>(p);
+  low = std::uint32_t(u);
+  if constexpr(sizeof(void*) > sizeof(std::uint32_t))
+    high = std::uint32_t(std::uint64_t(u) >> 32);
+}
+
+}} // namespace CGAL::internal
+
+#endif // CGAL_INTERNAL_TDS_3_INDEX_BLOCK_ALLOCATOR_H
@@ -37,6 +37,7 @@
 #include <CGAL/utility.h>
 #include <CGAL/iterator.h>
 #include <CGAL/STL_Extension/internal/Has_member_visited.h>
+#include <CGAL/TDS_3/internal/Index_block_allocator.h>
 
 #include <CGAL/Unique_hash_map.h>
 #include <CGAL/assertions.h>
@@ -48,6 +49,8 @@
 
 #include <CGAL/Triangulation_ds_cell_base_3.h>
 #include <CGAL/Triangulation_ds_vertex_base_3.h>
+#include <CGAL/Triangulation_ds_compact_cell_base_3.h>
+#include <CGAL/Triangulation_ds_compact_vertex_base_3.h>
 #include <CGAL/Triangulation_simplex_3.h>
 
 #include <CGAL/TDS_3/internal/Triangulation_ds_iterators_3.h>
@@ -122,6 +125,26 @@ private:
 
 public:
 
+  // The compact vertex and cell bases store 32-bit indices instead of handles:
+  // their elements are then allocated in blocks which can be referred to by an index.
+  static constexpr bool has_index_storage = internal::Has_index_storage<Cb>::value;
+  static_assert(has_index_storage == internal::Has_index_storage<Vb>::value,
+                "The vertex and cell bases must either both or none be compact bases.");
+  static_assert(!(has_index_storage && std::is_convertible<Concurrency_tag, Parallel_tag>::value),
+                "The compact vertex and cell bases cannot be used with `Parallel_tag`.");
+
+private:
+  template <typename T>
+  using Sequential_range = typename std::conditional
+  <
+    has_index_storage,
+    Compact_container<T, internal::Index_block_allocator<T>,
+                      Bounded_addition_size_policy<CGAL_INIT_COMPACT_CONTAINER_BLOCK_SIZE,
+                                                   CGAL_INCREMENT_COMPACT_CONTAINER_BLOCK_SIZE> >,
+    Compact_container<T>
+  >::type;
+
+public:
   // Cells
   // N.B.: Concurrent_compact_container requires TBB
 #ifdef CGAL_LINKED_WITH_TBB
@@ -129,7 +152,7 @@ public:
   <
     std::is_convertible<Concurrency_tag, Parallel_tag>::value,
     Concurrent_compact_container<Cell, tbb::scalable_allocator<Cell> >,
-    Compact_container<Cell>
+    Sequential_range<Cell>
   >::type                                                Cell_range;
 
 # else
@@ -137,7 +160,7 @@ public:
     (!(std::is_convertible<Concurrency_tag, Parallel_tag>::value),
      "In CGAL triangulations, `Parallel_tag` can only be used with the Intel TBB library. "
      "Make TBB available in the build system and then define the macro `CGAL_LINKED_WITH_TBB`.");
-  typedef Compact_container<Cell>                        Cell_range;
+  typedef Sequential_range<Cell>                         Cell_range;
 #endif
 
   // Vertices
@@ -147,11 +170,11 @@ public:
   <
     std::is_convertible<Concurrency_tag, Parallel_tag>::value,
     Concurrent_compact_container<Vertex, tbb::scalable_allocator<Vertex> >,
-    Compact_container<Vertex>
+    Sequential_range<Vertex>
   >::type                                                Vertex_range;
 
 # else
-  typedef Compact_container<Vertex>                      Vertex_range;
+  typedef Sequential_range<Vertex>                       Vertex_range;
 #endif
 
 
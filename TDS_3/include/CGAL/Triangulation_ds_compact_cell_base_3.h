@@ -0,0 +1,249 @@
+// Copyright (c) 2026 GeometryFactory (France).  All rights reserved.
+//
+// This file is part of CGAL (www.cgal.org)
+//
+// $URL$
+// $Id$
+// SPDX-License-Identifier: GPL-3.0-or-later OR LicenseRef-Commercial
+//
+// Author(s)     : GeometryFactory
+
+// cell of a triangulation data structure of any dimension <=3,
+// storing 32-bit indices instead of handles
+
+#ifndef CGAL_TRIANGULATION_DS_COMPACT_CELL_BASE_3_H
+#define CGAL_TRIANGULATION_DS_COMPACT_CELL_BASE_3_H
+
+#include <CGAL/license/TDS_3.h>
+
+
+#include <CGAL/basic.h>
+#include <CGAL/assertions.h>
+#include <CGAL/TDS_3/internal/Dummy_tds_3.h>
+#include <CGAL/TDS_3/internal/Index_block_allocator.h>
+
+#include <cstdint>
+
+namespace CGAL {
+
+template < typename TDS = void >
+class Triangulation_ds_compact_cell_base_3
+{
+public:
+  typedef TDS                           Triangulation_data_structure;
+  typedef typename TDS::Vertex_handle   Vertex_handle;
+  typedef typename TDS::Cell_handle     Cell_handle;
+  typedef typename TDS::Vertex          Vertex;
+  typedef typename TDS::Cell            Cell;
+  typedef typename TDS::Cell_data       TDS_data;
+
+  // The vertices and cells are allocated in index blocks by the TDS.
+  typedef Tag_true                      Index_storage;
+
+  template <typename TDS2>
+  struct Rebind_TDS { typedef Triangulation_ds_compact_cell_base_3<TDS2> Other; };
+
+private:
+  typedef internal::Index_blocks<Vertex>   Vertex_blocks;
+  typedef internal::Index_blocks<Cell>     Cell_blocks;
+  typedef std::uint32_t                    Index;
+
+  static Index index_of(Vertex_handle v) { return Vertex_blocks::index(v.operator->()); }
+  static Index index_of(Cell_handle c) { return Cell_blocks::index(c.operator->()); }
+
+public:
+  Triangulation_ds_compact_cell_base_3()
+    : N{0, 0, 0, 0}, V{0, 0, 0, 0}
+  {}
+
+  Triangulation_ds_compact_cell_base_3(Vertex_handle v0, Vertex_handle v1,
+                                       Vertex_handle v2, Vertex_handle v3)
+    : N{0, 0, 0, 0}, V{index_of(v0), index_of(v1), index_of(v2), index_of(v3)}
+  {}
+
+  Triangulation_ds_compact_cell_base_3(Vertex_handle v0, Vertex_handle v1,
+                                       Vertex_handle v2, Vertex_handle v3,
+                                       Cell_handle   n0, Cell_handle   n1,
+                                       Cell_handle   n2, Cell_handle   n3)
+    : N{index_of(n0), index_of(n1), index_of(n2), index_of(n3)},
+      V{index_of(v0), index_of(v1), index_of(v2), index_of(v3)}
+  {}
+
+  // ACCESS FUNCTIONS
+
+  Vertex_handle vertex(int i) const
+  {
+    CGAL_precondition( i >= 0 && i <= 3 );
+    CGAL_assume( i >= 0 && i <= 3 );
+    return Vertex_handle(Vertex_blocks::address(V[i]));
+  }
+
+  bool has_vertex(Vertex_handle v) const
+  {
+    const Index iv = index_of(v);
+    return (V[0] == iv) || (V[1] == iv) || (V[2]== iv) || (V[3]== iv);
+  }
+
+  bool has_vertex(Vertex_handle v, int & i) const
+    {
+      const Index iv = index_of(v);
+      if (iv == V[0]) { i = 0; return true; }
+      if (iv == V[1]) { i = 1; return true; }
+      if (iv == V[2]) { i = 2; return true; }
+      if (iv == V[3]) { i = 3; return true; }
+      return false;
+    }
+
+  int index(Vertex_handle v) const
+  {
+    const Index iv = index_of(v);
+    if (iv == V[0]) { return 0; }
+    if (iv == V[1]) { return 1; }
+    if (iv == V[2]) { return 2; }
+    CGAL_assertion( iv == V[3] );
+    return 3;
+  }
+
+  Cell_handle neighbor(int i) const
+  {
+    CGAL_precondition( i >= 0 && i <= 3);
+    return Cell_handle(Cell_blocks::address(N[i]));
+  }
+
+  bool has_neighbor(Cell_handle n) const
+  {
+    const Index in = index_of(n);
+    return (N[0] == in) || (N[1] == in) || (N[2] == in) || (N[3] == in);
+  }
+
+  bool has_neighbor(Cell_handle n, int & i) const
+  {
+    const Index in = index_of(n);
+    if(in == N[0]){ i = 0; return true; }
+    if(in == N[1]){ i = 1; return true; }
+    if(in == N[2]){ i = 2; return true; }
+    if(in == N[3]){ i = 3; return true; }
+    return false;
+  }
+
+  int index(Cell_handle n) const
+  {
+    const Index in = index_of(n);
+    if (in == N[0]) return 0;
+    if (in == N[1]) return 1;
+    if (in == N[2]) return 2;
+    CGAL_assertion( in == N[3] );
+    return 3;
+  }
+
+  // SETTING
+
+  void set_vertex(int i, Vertex_handle v)
+  {
+    CGAL_precondition( i >= 0 && i <= 3);
+    V[i] = index_of(v);
+  }
+
+  void set_neighbor(int i, Cell_handle n)
+  {
+    CGAL_precondition( i >= 0 && i <= 3);
+    CGAL_precondition( this != n.operator->() );
+    N[i] = index_of(n);
+  }
+
+  void set_vertices()
+  {
+    V[0] = V[1] = V[2] = V[3] = 0;
+  }
+
+  void set_vertices(Vertex_handle v0, Vertex_handle v1,
+                    Vertex_handle v2, Vertex_handle v3)
+  {
+    V[0] = index_of(v0);
+    V[1] = index_of(v1);
+    V[2] = index_of(v2);
+    V[3] = index_of(v3);
+  }
+
+  void set_neighbors()
+  {
+    N[0] = N[1] = N[2] = N[3] = 0;
+  }
+
+  void set_neighbors(Cell_handle n0, Cell_handle n1,
+                     Cell_handle n2, Cell_handle n3)
+  {
+    CGAL_precondition( this != n0.operator->() );
+    CGAL_precondition( this != n1.operator->() );
+    CGAL_precondition( this != n2.operator->() );
+    CGAL_precondition( this != n3.operator->() );
+    N[0] = index_of(n0);
+    N[1] = index_of(n1);
+    N[2] = index_of(n2);
+    N[3] = index_of(n3);
+  }
+
+  // CHECKING
+
+  // the following trivial is_valid allows
+  // the user of derived cell base classes
+  // to add their own purpose checking
+  bool is_valid(bool = false, int = 0) const
+  { return true; }
+
+  // For use by Compact_container: the pointer is stored in N[0] and N[1].
+  // The two low bits of an index are zero, so that a used cell is
+  // recognized by N[0] alone.
+  void * for_compact_container() const
+  {
+    if ((N[0] & 3) == 0)
+      return nullptr;
+    return internal::join_pointer(N[0], N[1]);
+  }
+  void for_compact_container(void* p) { internal::split_pointer(p, N[0], N[1]); }
+
+  // TDS internal data access functions.
+        TDS_data& tds_data()       { return _tds_data; }
+  const TDS_data& tds_data() const { return _tds_data; }
+
+private:
+
+  Index         N[4];
+  Index         V[4];
+  TDS_data      _tds_data;
+};
+
+template < class TDS >
+inline
+std::istream&
+operator>>(std::istream &is, Triangulation_ds_compact_cell_base_3<TDS> &)
+  // non combinatorial information. Default = nothing
+{
+  return is;
+}
+
+template < class TDS >
+inline
+std::ostream&
+operator<<(std::ostream &os, const Triangulation_ds_compact_cell_base_3<TDS> &)
+  // non combinatorial information. Default = nothing
+{
+  return os;
+}
+
+// Specialization for void.
+template <>
+class Triangulation_ds_compact_cell_base_3<void>
+{
+public:
+  typedef internal::Dummy_tds_3                         Triangulation_data_structure;
+  typedef Triangulation_data_structure::Vertex_handle   Vertex_handle;
+  typedef Triangulation_data_structure::Cell_handle     Cell_handle;
+  typedef Tag_true                                      Index_storage;
+  template <typename TDS2>
+  struct Rebind_TDS { typedef Triangulation_ds_compact_cell_base_3<TDS2> Other; };
+};
+
+} //namespace CGAL
+
+#endif // CGAL_TRIANGULATION_DS_COMPACT_CELL_BASE_3_H
@@ -0,0 +1,128 @@
+// Copyright (c) 2026 GeometryFactory (France).  All rights reserved.
+//
+// This file is part of CGAL (www.cgal.org)
+//
+// $URL$
+// $Id$
+// SPDX-License-Identifier: GPL-3.0-or-later OR LicenseRef-Commercial
+//
+// Author(s)     : GeometryFactory
+
+#ifndef CGAL_TRIANGULATION_DS_COMPACT_VERTEX_BASE_3_H
+#define CGAL_TRIANGULATION_DS_COMPACT_VERTEX_BASE_3_H
+
+#include <CGAL/license/TDS_3.h>
+
+
+#include <CGAL/basic.h>
+#include <CGAL/TDS_3/internal/Dummy_tds_3.h>
+#include <CGAL/TDS_3/internal/Index_block_allocator.h>
+
+#include <cstdint>
+
+namespace CGAL {
+
+template < typename TDS = void >
+class Triangulation_ds_compact_vertex_base_3
+{
+public:
+  typedef TDS                          Triangulation_data_structure;
+  typedef typename TDS::Vertex_handle  Vertex_handle;
+  typedef typename TDS::Cell_handle    Cell_handle;
+  typedef typename TDS::Cell           Cell;
+
+  // The vertices and cells are allocated in index blocks by the TDS.
+  typedef Tag_true                     Index_storage;
+
+  template <typename TDS2>
+  struct Rebind_TDS { typedef Triangulation_ds_compact_vertex_base_3<TDS2> Other; };
+
+private:
+  typedef internal::Index_blocks<Cell>  Cell_blocks;
+
+public:
+  Triangulation_ds_compact_vertex_base_3()
+    : _c(0), visited_for_vertex_extractor(false)
+  {}
+
+  Triangulation_ds_compact_vertex_base_3(Cell_handle c)
+    : _c(Cell_blocks::index(c.operator->())), visited_for_vertex_extractor(false)
+  {}
+
+  Cell_handle cell() const
+  { return Cell_handle(Cell_blocks::address(_c)); }
+
+  void set_cell(Cell_handle c)
+  {
+    _c = Cell_blocks::index(c.operator->());
+  }
+
+  // the following trivial is_valid allows
+  // the user of derived cell base classes
+  // to add their own purpose checking
+  bool is_valid(bool = false, int = 0) const
+  {
+    return _c != 0;
+  }
+
+  // For use by the Compact_container: the pointer is stored in _c and in
+  // the word of the flag, which is only used by a used vertex.
+  // The two low bits of an index are zero, so that a used vertex is
+  // recognized by _c alone.
+  void *   for_compact_container() const
+  {
+    if ((_c & 3) == 0)
+      return nullptr;
+    return internal::join_pointer(_c, _high);
+  }
+  void for_compact_container(void* p)
+  { internal::split_pointer(p, _c, _high); }
+
+private:
+  std::uint32_t _c;
+
+  // The typedef and the bool are used by Triangulation_data_structure::Vertex_extractor
+  // The names are chooses complicated so that we do not have to document them
+  // (privacy by obfuscation)
+  public:
+  typedef bool Has_visited_for_vertex_extractor;
+  union {
+    bool visited_for_vertex_extractor;
+    std::uint32_t _high;
+  };
+};
+
+template < class TDS >
+inline
+std::istream&
+operator>>(std::istream &is, Triangulation_ds_compact_vertex_base_3<TDS> &)
+  // no combinatorial information.
+{
+  return is;
+}
+
+template < class TDS >
+inline
+std::ostream&
+operator<<(std::ostream &os, const Triangulation_ds_compact_vertex_base_3<TDS> &)
+  // no combinatorial information.
+{
+  return os;
+}
+
+// Specialization for void.
+template <>
+class Triangulation_ds_compact_vertex_base_3<void>
+{
+public:
+  typedef internal::Dummy_tds_3                         Triangulation_data_structure;
+  typedef Triangulation_data_structure::Vertex_handle   Vertex_handle;
+  typedef Triangulation_data_structure::Cell_handle     Cell_handle;
+  typedef Tag_true                                      Index_storage;
+  template <typename TDS2>
+  struct Rebind_TDS { typedef Triangulation_ds_compact_vertex_base_3<TDS2> Other; };
+};
+
+} //namespace CGAL
+
+#endif // CGAL_TRIANGULATION_DS_COMPACT_VERTEX_BASE_3_H
@@ -15,6 +15,9 @@
 #include <CGAL/_test_cls_tds_3.h>
 
 typedef CGAL::Triangulation_data_structure_3<>               Tds;
+typedef CGAL::Triangulation_data_structure_3<
+          CGAL::Triangulation_ds_compact_vertex_base_3<>,
+          CGAL::Triangulation_ds_compact_cell_base_3<> >     Compact_tds;
 
 // Explicit instantiation :
 template class CGAL::Triangulation_data_structure_3<>;
@@ -22,5 +25,8 @@ template class CGAL::Triangulation_data_structure_3<>;
 int main()
 {
   _test_cls_tds_3(Tds());
+
+  static_assert(sizeof(Compact_tds::Cell) < sizeof(Tds::Cell));
+  _test_cls_tds_3(Compact_tds());
   return 0;
 }
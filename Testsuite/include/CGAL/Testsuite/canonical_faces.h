@@ -0,0 +1,53 @@
+// Copyright (c) 2026 GeometryFactory (France).
+// All rights reserved.
+//
+// This file is part of CGAL (www.cgal.org)
+//
+// $URL$
+// $Id$
+// SPDX-License-Identifier: LGPL-3.0-or-later OR LicenseRef-Commercial
+//
+// Author(s)     : GeometryFactory
+
+#ifndef CGAL_TESTSUITE_CANONICAL_FACES_H
+#define CGAL_TESTSUITE_CANONICAL_FACES_H
+
+#include <CGAL/boost/graph/iterator.h>
+#include <CGAL/boost/graph/properties.h>
+
+#include <boost/graph/graph_traits.hpp>
+
+#include <algorithm>
+#include <vector>
+
+namespace CGAL { namespace Testsuite {
+
+  // the faces of `m` as sequences of points starting with the smallest one, sorted.
+  // Two meshes have the same canonical faces if they are the same up to the order
+  // of their elements.
+  template <typename PolygonMesh>
+  std::vector<std::vector<typename boost::property_traits<
+    typename boost::property_map<PolygonMesh, CGAL::vertex_point_t>::const_type>::value_type> >
+  canonical_faces(const PolygonMesh& m)
+  {
+    typedef typename boost::property_map<PolygonMesh, CGAL::vertex_point_t>::const_type VPM;
+    typedef typename boost::property_traits<VPM>::value_type Point;
+
+    const VPM vpm = get(CGAL::vertex_point, m);
+    std::vector<std::vector<Point> > out;
+    for(typename boost::graph_traits<PolygonMesh>::face_descriptor f : faces(m))
+    {
+      std::vector<Point> face;
+      for(typename boost::graph_traits<PolygonMesh>::vertex_descriptor v : vertices_around_face(halfedge(f, m), m))
+        face.push_back(get(vpm, v));
+      std::rotate(face.begin(), std::min_element(face.begin(), face.end()), face.end());
+      out.push_back(face);
+    }
+    std::sort(out.begin(), out.end());
+    return out;
+  }
+
+  } // namespace Testsuite
+} // namespace CGAL
+
+#endif // CGAL_TESTSUITE_CANONICAL_FACES_H
@@ -0,0 +1,58 @@
+// Copyright (c) 2026 GeometryFactory (France).
+// All rights reserved.
+//
+// This file is part of CGAL (www.cgal.org)
+//
+// $URL$
+// $Id$
+// SPDX-License-Identifier: LGPL-3.0-or-later OR LicenseRef-Commercial
+//
+// Author(s)     : GeometryFactory
+
+#ifndef CGAL_TESTSUITE_SHUFFLE_POLYGON_MESH_H
+#define CGAL_TESTSUITE_SHUFFLE_POLYGON_MESH_H
+
+#include <CGAL/Polygon_mesh_processing/polygon_mesh_to_polygon_soup.h>
+#include <CGAL/Polygon_mesh_processing/polygon_soup_to_polygon_mesh.h>
+#include <CGAL/boost/graph/helpers.h>
+#include <CGAL/boost/graph/properties.h>
+
+#include <algorithm>
+#include <random>
+#include <vector>
+
+namespace CGAL { namespace Testsuite {
+
+  // rebuilds `m` with its vertices and faces in a random order, as after
+  // `Polygon_mesh_processing::polygon_soup_to_polygon_mesh()` on an unsorted soup
+  template <typename PolygonMesh>
+  void shuffle_polygon_mesh(PolygonMesh& m, const unsigned int seed = 0)
+  {
+    typedef typename boost::property_traits<
+      typename boost::property_map<PolygonMesh, CGAL::vertex_point_t>::const_type>::value_type Point;
+
+    std::vector<Point> points;
+    std::vector<std::vector<std::size_t> > polygons;
+    CGAL::Polygon_mesh_processing::polygon_mesh_to_polygon_soup(m, points, polygons);
+
+    std::mt19937 gen(seed);
+    std::vector<std::size_t> new_ids(points.size());
+    for(std::size_t i=0; i<points.size(); ++i)
+      new_ids[i] = i;
+    std::shuffle(new_ids.begin(), new_ids.end(), gen);
+    std::vector<Point> new_points(points.size());
+    for(std::size_t i=0; i<points.size(); ++i)
+      new_points[new_ids[i]] = points[i];
+    for(std::vector<std::size_t>& polygon : polygons)
+      for(std::size_t& id : polygon)
+        id = new_ids[id];
+    std::shuffle(polygons.begin(), polygons.end(), gen);
+
+    CGAL::clear(m);
+    CGAL::Polygon_mesh_processing::polygon_soup_to_polygon_mesh(new_points, polygons, m);
+  }
+
+  } // namespace Testsuite
+} // namespace CGAL
+
+#endif // CGAL_TESTSUITE_SHUFFLE_POLYGON_MESH_H
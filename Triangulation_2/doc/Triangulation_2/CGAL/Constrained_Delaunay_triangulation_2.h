@@ -154,6 +154,9 @@ Vertex_handle push_back(const Point& p);
 /*!
 Inserts the points in the range `[first,last)`.
 Returns the number of inserted points.
+If the concurrency tag of the triangulation data structure is `Parallel_tag`,
+the points are inserted in parallel; the points lying on a constrained edge are
+inserted sequentially afterwards.
 \tparam PointIterator must be an `InputIterator` with the value type `Point`.
 */
 template < class PointIterator >
@@ -166,6 +169,8 @@ Returns the number of inserted points.
 Note that this function is not guaranteed to insert the points
 following the order of `PointWithInfoIterator`, as `spatial_sort()`
 is used to improve efficiency.
+If the concurrency tag of the triangulation data structure is `Parallel_tag`,
+the points are inserted in parallel.
 Given a pair `(p,i)`, the vertex `v` storing `p` also stores `i`, that is
 `v.point() == p` and `v.info() == i`. If several pairs have the same point,
 only one vertex is created, and one of the objects of type `Vertex::Info` will be stored in the vertex.
@@ -211,6 +216,9 @@ is used to improve efficiency.
 More precisely, all endpoints are inserted prior to the segments and according to the order provided by the spatial sort.
 Once endpoints have been inserted, the segments are inserted in the order of the input iterator,
 using the vertex handles of its endpoints.
+If the concurrency tag of the triangulation data structure is `Parallel_tag`,
+the endpoints and then the segments are inserted in parallel. The segments that pass
+through a vertex or intersect another constraint are inserted sequentially afterwards.
 
 \return the number of inserted points.
 \tparam ConstraintIterator must be an `InputIterator` with the value type `std::pair<Point,Point>` or `Segment`.
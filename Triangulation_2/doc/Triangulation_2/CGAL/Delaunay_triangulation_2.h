@@ -149,6 +149,8 @@ Returns the number of inserted points.
 Note that this function is not guaranteed to insert the points
 following the order of `PointInputIterator`, as `spatial_sort()`
 is used to improve efficiency.
+If the concurrency tag of the triangulation data structure is `Parallel_tag`,
+the points are inserted in parallel.
 \tparam PointInputIterator must be an input iterator with the value type `Point`.
 */
 template < class PointInputIterator >
@@ -160,6 +162,8 @@ inserts the points in the iterator range `[first,last)`. Returns the number of i
 Note that this function is not guaranteed to insert the points
 following the order of `PointWithInfoInputIterator`, as `spatial_sort()`
 is used to improve efficiency.
+If the concurrency tag of the triangulation data structure is `Parallel_tag`,
+the points are inserted in parallel.
 Given a pair `(p,i)`, the vertex `v` storing `p` also stores `i`, that is
 `v.point() == p` and `v.info() == i`. If several pairs have the same point,
 only one vertex is created, and one of the objects of type `Vertex::Info` will be stored in the vertex.
@@ -19,6 +19,7 @@
 #include <CGAL/assertions.h>
 #include <CGAL/Constrained_triangulation_2.h>
 #include <CGAL/Triangulation_2/insert_constraints.h>
+#include <CGAL/Triangulation_2/internal/Parallel_insertion_2.h>
 
 #ifndef CGAL_TRIANGULATION_2_DONT_INSERT_RANGE_OF_POINTS_WITH_INFO
 #include <CGAL/Spatial_sort_traits_adapter_2.h>
@@ -340,6 +341,14 @@ public:
       size_type n = number_of_vertices();
 
       std::vector<Point> points (first, last);
+
+#ifdef CGAL_LINKED_WITH_TBB
+      if constexpr (internal::Is_parallel_tds_2<Tds>::value) {
+        parallel_insert(points, [](std::size_t, Vertex_handle) {});
+        return number_of_vertices() - n;
+      }
+#endif
+
       spatial_sort (points.begin(), points.end(), geom_traits());
       Face_handle f;
       for (typename std::vector<Point>::const_iterator p = points.begin(), end = points.end();
@@ -395,6 +404,13 @@ private:
       indices.push_back(index++);
     }
 
+#ifdef CGAL_LINKED_WITH_TBB
+    if constexpr (internal::Is_parallel_tds_2<Tds>::value) {
+      parallel_insert(points, [&](std::size_t i, Vertex_handle v) { v->info() = infos[i]; });
+      return number_of_vertices() - n;
+    }
+#endif
+
     using Pmap = typename Pointer_property_map<Point>::type;
     using Search_traits = Spatial_sort_traits_adapter_2<Geom_traits,Pmap>;
 
@@ -459,6 +475,14 @@ public:
       return insert(points_first, points_beyond);
     }
     std::vector<Point> points(points_first, points_beyond);
+#ifdef CGAL_LINKED_WITH_TBB
+    if constexpr (internal::Is_parallel_tds_2<Tds>::value) {
+      std::vector<std::pair<std::size_t, std::size_t> > constraints;
+      for(IndicesIterator it = indices_first; it != indices_beyond; ++it)
+        constraints.emplace_back(it->first, it->second);
+      return parallel_insert_constraints(points, constraints);
+    }
+#endif
     return internal::insert_constraints(*this,points, indices_first, indices_beyond);
   }
 
@@ -467,9 +491,60 @@ public:
   std::size_t insert_constraints(ConstraintIterator first,
                                  ConstraintIterator beyond)
   {
+#ifdef CGAL_LINKED_WITH_TBB
+    if constexpr (internal::Is_parallel_tds_2<Tds>::value) {
+      std::vector<Point> points;
+      std::vector<std::pair<std::size_t, std::size_t> > constraints;
+      for(ConstraintIterator it = first; it != beyond; ++it) {
+        constraints.emplace_back(points.size(), points.size() + 1);
+        points.push_back(Ctr::get_source(*it));
+        points.push_back(Ctr::get_target(*it));
+      }
+      return parallel_insert_constraints(points, constraints);
+    }
+#endif
     return internal::insert_constraints(*this,first,beyond);
   }
 
+private:
+#ifdef CGAL_LINKED_WITH_TBB
+  template <class OnVertex>
+  void parallel_insert(const std::vector<Point>& points, const OnVertex& on_vertex)
+  {
+    std::vector<std::size_t> indices(points.size());
+    std::iota(indices.begin(), indices.end(), std::size_t(0));
+    using Pmap = typename Pointer_property_map<Point>::const_type;
+    using Search_traits = Spatial_sort_traits_adapter_2<Geom_traits,Pmap>;
+    spatial_sort<Parallel_tag>(indices.begin(), indices.end(),
+                               Search_traits(make_property_map(points),geom_traits()));
+
+    internal::Parallel_insertion_2<CDt, true>(*this, points).insert(points, indices, on_vertex);
+  }
+
+  std::size_t
+  parallel_insert_constraints(const std::vector<Point>& points,
+                              const std::vector<std::pair<std::size_t, std::size_t> >& constraints)
+  {
+    size_type n = number_of_vertices();
+
+    std::vector<Vertex_handle> vertices(points.size());
+    std::vector<std::size_t> indices(points.size());
+    std::iota(indices.begin(), indices.end(), std::size_t(0));
+    using Pmap = typename Pointer_property_map<Point>::const_type;
+    using Search_traits = Spatial_sort_traits_adapter_2<Geom_traits,Pmap>;
+    spatial_sort<Parallel_tag>(indices.begin(), indices.end(),
+                               Search_traits(make_property_map(points),geom_traits()));
+
+    internal::Parallel_insertion_2<CDt, true> insertion(*this, points);
+    insertion.insert(points, indices, [&](std::size_t i, Vertex_handle v) { vertices[i] = v; });
+    insertion.insert_constraints(vertices, constraints);
+
+    return number_of_vertices() - n;
+  }
+#endif
+
+public:
+
 
   template <class OutputItFaces, class OutputItBoundaryEdges>
   std::pair<OutputItFaces,OutputItBoundaryEdges>
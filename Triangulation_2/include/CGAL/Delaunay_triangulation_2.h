@@ -17,6 +17,7 @@
 #include <CGAL/license/Triangulation_2.h>
 
 #include <CGAL/Triangulation_2.h>
+#include <CGAL/Triangulation_2/internal/Parallel_insertion_2.h>
 #include <CGAL/iterator.h>
 #include <CGAL/Object.h>
 
@@ -315,6 +316,22 @@ public:
     size_type n = this->number_of_vertices();
 
     std::vector<Point> points (first, last);
+
+#ifdef CGAL_LINKED_WITH_TBB
+    if constexpr (internal::Is_parallel_tds_2<Tds>::value) {
+      std::vector<std::size_t> indices(points.size());
+      std::iota(indices.begin(), indices.end(), std::size_t(0));
+      typedef typename Pointer_property_map<Point>::type Pmap;
+      typedef Spatial_sort_traits_adapter_2<Geom_traits,Pmap> Search_traits;
+      spatial_sort<Parallel_tag>(indices.begin(), indices.end(),
+                                 Search_traits(make_property_map(points),geom_traits()));
+
+      internal::Parallel_insertion_2<Delaunay_triangulation_2>(*this, points)
+        .insert(points, indices, [](std::size_t, Vertex_handle) {});
+      return this->number_of_vertices() - n;
+    }
+#endif
+
     spatial_sort (points.begin(), points.end(), geom_traits());
     Face_handle f;
     for (typename std::vector<Point>::const_iterator p = points.begin(), end = points.end();
@@ -349,6 +366,17 @@ private:
     typedef typename Pointer_property_map<Point>::type Pmap;
     typedef Spatial_sort_traits_adapter_2<Geom_traits,Pmap> Search_traits;
 
+#ifdef CGAL_LINKED_WITH_TBB
+    if constexpr (internal::Is_parallel_tds_2<Tds>::value) {
+      spatial_sort<Parallel_tag>(indices.begin(), indices.end(),
+                                 Search_traits(make_property_map(points),geom_traits()));
+
+      internal::Parallel_insertion_2<Delaunay_triangulation_2>(*this, points)
+        .insert(points, indices, [&](std::size_t i, Vertex_handle v) { v->info() = infos[i]; });
+      return this->number_of_vertices() - n;
+    }
+#endif
+
     spatial_sort(indices.begin(), indices.end(),
                  Search_traits(make_property_map(points),geom_traits()));
 
@@ -0,0 +1,471 @@
+// Copyright (c) 2026 GeometryFactory (France).  All rights reserved.
+//
+// This file is part of CGAL (www.cgal.org)
+//
+// $URL$
+// $Id$
+// SPDX-License-Identifier: GPL-3.0-or-later OR LicenseRef-Commercial
+//
+// Author(s)     : GeometryFactory
+
+#ifndef CGAL_TRIANGULATION_2_INTERNAL_PARALLEL_INSERTION_2_H
+#define CGAL_TRIANGULATION_2_INTERNAL_PARALLEL_INSERTION_2_H
+
+#include <CGAL/license/Triangulation_2.h>
+
+#include <CGAL/tags.h>
+
+#include <type_traits>
+
+#ifdef CGAL_LINKED_WITH_TBB
+# include <CGAL/Bbox_2.h>
+# include <CGAL/Bbox_3.h>
+# include <CGAL/Random.h>
+# include <CGAL/Spatial_lock_grid_3.h>
+
+# include <tbb/blocked_range.h>
+# include <tbb/concurrent_vector.h>
+# include <tbb/enumerable_thread_specific.h>
+# include <tbb/parallel_for.h>
+
+# include <algorithm>
+# include <numeric>
+# include <stack>
+# include <utility>
+# include <vector>
+#endif
+
+namespace CGAL {
+namespace internal {
+
+// `true` if the triangulation data structure `Tds` stores its faces and vertices
+// in concurrent containers, that is if its `Concurrency_tag` is `Parallel_tag`
+template <class Tds, class = void>
+struct Is_parallel_tds_2
+  : public std::false_type
+{ };
+
+template <class Tds>
+struct Is_parallel_tds_2<Tds, std::void_t<typename Tds::Concurrency_tag> >
+  : public std::is_convertible<typename Tds::Concurrency_tag, Parallel_tag>
+{ };
+
+#ifdef CGAL_LINKED_WITH_TBB
+
+// Parallel insertion of points (and of constraints if `Tr` is a constrained Delaunay
+// triangulation) in a 2D (constrained) Delaunay triangulation whose data structure
+// is parallel.
+//
+// As for `Delaunay_triangulation_3`, each thread inserts its points with the
+// Bowyer-Watson algorithm, locking the vertices of every face it reads in a grid of
+// locks covering the input points. When a lock cannot be taken, the locks of the
+// thread are released and the insertion is started again. The few insertions that
+// cannot be done locally (points on constrained edges, constraints passing through
+// vertices or crossing other constraints) are postponed and done sequentially at
+// the end.
+template <class Tr, bool IsConstrained = false>
+class Parallel_insertion_2
+{
+  typedef typename Tr::Point                               Point;
+  typedef typename Tr::Vertex_handle                       Vertex_handle;
+  typedef typename Tr::Face_handle                         Face_handle;
+  typedef typename Tr::Face_circulator                     Face_circulator;
+  typedef typename Tr::Edge                                Edge;
+  typedef typename Tr::Locate_type                         Locate_type;
+
+  typedef Spatial_lock_grid_3<Tag_priority_blocking>       Lock_grid;
+
+  // The 2D grid of `grid_size` x `grid_size` locks is folded into the 3D lock grid,
+  // the low bits of both indices giving the third index.
+  static constexpr int cells_per_axis = 64;
+  static constexpr int fold = 8; // fold * fold == cells_per_axis
+  static constexpr int grid_size = cells_per_axis * fold;
+
+  struct Grid_point
+  {
+    double m_x, m_y, m_z;
+    double x() const { return m_x; }
+    double y() const { return m_y; }
+    double z() const { return m_z; }
+  };
+
+  enum Status { DONE, LOCK_FAILED, POSTPONED };
+
+  Tr& m_tr;
+  Lock_grid m_lock_grid;
+  double m_xmin, m_ymin, m_x_resolution, m_y_resolution;
+
+  static int cw(int i) { return Tr::cw(i); }
+  static int ccw(int i) { return Tr::ccw(i); }
+
+public:
+  // the grid of locks covers the bounding box of `points`
+  Parallel_insertion_2(Tr& tr, const std::vector<Point>& points)
+    : m_tr(tr),
+      m_lock_grid(Bbox_3(0, 0, 0, cells_per_axis, cells_per_axis, cells_per_axis), cells_per_axis)
+  {
+    Bbox_2 bbox;
+    for(const Point& p : points)
+      bbox += Bbox_2(CGAL::to_double(p.x()), CGAL::to_double(p.y()),
+                     CGAL::to_double(p.x()), CGAL::to_double(p.y()));
+    m_xmin = bbox.xmin();
+    m_ymin = bbox.ymin();
+    double dx = bbox.xmax() - bbox.xmin(), dy = bbox.ymax() - bbox.ymin();
+    m_x_resolution = grid_size / (dx > 0 ? dx : 1.);
+    m_y_resolution = grid_size / (dy > 0 ? dy : 1.);
+  }
+
+  // Inserts the points `points[indices[k]]`. `indices` should be spatially sorted.
+  // `on_vertex(index, v)` is called once the vertex `v` of `points[index]` is created,
+  // while `v` is still locked.
+  template <class OnVertex>
+  void insert(const std::vector<Point>& points,
+              const std::vector<std::size_t>& indices,
+              const OnVertex& on_vertex)
+  {
+    const std::size_t nb_points = indices.size();
+
+    // Insert 100 points sequentially (or more, until the triangulation has dimension 2)
+    std::size_t i = 0;
+    const std::size_t nb_points_seq = (std::min)(nb_points, std::size_t(100));
+    Face_handle hint_face;
+    Vertex_handle hint;
+    while(i < nb_points_seq || (m_tr.dimension() < 2 && i < nb_points))
+    {
+      Vertex_handle v = m_tr.insert(points[indices[i]], hint_face);
+      if(v != Vertex_handle())
+      {
+        on_vertex(indices[i], v);
+        hint = v;
+        hint_face = v->face();
+      }
+      ++i;
+    }
+    if(i == nb_points)
+      return;
+
+    tbb::concurrent_vector<std::size_t> postponed;
+    tbb::enumerable_thread_specific<Vertex_handle> tls_hint(hint);
+    tbb::enumerable_thread_specific<Random> tls_random(Random(0));
+    tbb::parallel_for(tbb::blocked_range<std::size_t>(i, nb_points),
+                      [&](const tbb::blocked_range<std::size_t>& r)
+    {
+      Vertex_handle& hint = tls_hint.local();
+      Random& random = tls_random.local();
+      std::vector<Face_handle> faces;
+      std::vector<Edge> edges;
+      for(std::size_t k = r.begin(); k != r.end(); ++k)
+      {
+        const std::size_t index = indices[k];
+        for(;;)
+        {
+          Vertex_handle v;
+          Status status = try_insert(points[index], hint, random, faces, edges, v);
+          if(status == DONE)
+            on_vertex(index, v);
+          unlock_all();
+
+          if(status == DONE)
+            hint = v;
+          else if(status == POSTPONED)
+            postponed.push_back(index);
+          else
+            continue;
+          break;
+        }
+      }
+    });
+
+    std::sort(postponed.begin(), postponed.end());
+    hint_face = Face_handle();
+    for(std::size_t index : postponed)
+    {
+      Vertex_handle v = m_tr.insert(points[index], hint_face);
+      if(v != Vertex_handle())
+      {
+        on_vertex(index, v);
+        hint_face = v->face();
+      }
+    }
+  }
+
+  // Inserts the constraints `[vertices[c.first], vertices[c.second]]` for all `c` in `constraints`.
+  void insert_constraints(const std::vector<Vertex_handle>& vertices,
+                          const std::vector<std::pair<std::size_t, std::size_t> >& constraints)
+  {
+    if(m_tr.dimension() < 2)
+    {
+      for(const std::pair<std::size_t, std::size_t>& c : constraints)
+        if(vertices[c.first] != vertices[c.second])
+          m_tr.insert_constraint(vertices[c.first], vertices[c.second]);
+      return;
+    }
+
+    tbb::concurrent_vector<std::size_t> postponed;
+    tbb::parallel_for(tbb::blocked_range<std::size_t>(0, constraints.size()),
+                      [&](const tbb::blocked_range<std::size_t>& r)
+    {
+      for(std::size_t k = r.begin(); k != r.end(); ++k)
+      {
+        for(;;)
+        {
+          Status status = try_insert_constraint(vertices[constraints[k].first],
+                                                vertices[constraints[k].second]);
+          unlock_all();
+
+          if(status == POSTPONED)
+            postponed.push_back(k);
+          else if(status == LOCK_FAILED)
+            continue;
+          break;
+        }
+      }
+    });
+
+    std::sort(postponed.begin(), postponed.end());
+    for(std::size_t k : postponed)
+      m_tr.insert_constraint(vertices[constraints[k].first], vertices[constraints[k].second]);
+  }
+
+private:
+  Grid_point grid_point(const Point& p) const
+  {
+    int ix = static_cast<int>((CGAL::to_double(p.x()) - m_xmin) * m_x_resolution);
+    int iy = static_cast<int>((CGAL::to_double(p.y()) - m_ymin) * m_y_resolution);
+    ix = (std::max)(0, (std::min)(ix, grid_size - 1));
+    iy = (std::max)(0, (std::min)(iy, grid_size - 1));
+    return Grid_point{ ix / fold + 0.5, iy / fold + 0.5, (ix % fold) * fold + (iy % fold) + 0.5 };
+  }
+
+  bool try_lock(const Point& p)
+  {
+    return m_lock_grid.try_lock(grid_point(p));
+  }
+
+  bool try_lock(Vertex_handle v)
+  {
+    // the infinite vertex shares the lock of the corner of the grid
+    if(m_tr.is_infinite(v))
+      return m_lock_grid.try_lock(Grid_point{ 0.5, 0.5, 0.5 });
+    return try_lock(v->point());
+  }
+
+  bool try_lock(Face_handle f)
+  {
+    return try_lock(f->vertex(0)) && try_lock(f->vertex(1)) && try_lock(f->vertex(2));
+  }
+
+  void unlock_all()
+  {
+    m_lock_grid.unlock_all_points_locked_by_this_thread();
+  }
+
+  // Visibility walk from a face incident to `hint` to the face containing `p`.
+  // The vertices of all the faces visited are locked.
+  bool locate(const Point& p, Vertex_handle hint, Random& random,
+              Face_handle& f, Locate_type& lt, int& li)
+  {
+    // the faces incident to `hint` cannot change while `hint` is locked
+    f = hint->face();
+    if(m_tr.is_infinite(f))
+      f = f->neighbor(f->index(m_tr.infinite_vertex()));
+    if(!try_lock(f))
+      return false;
+
+    Face_handle previous;
+    for(bool moved = true; moved; )
+    {
+      moved = false;
+      const int first = random.get_int(0, 3);
+      for(int k = 0; k < 3; ++k)
+      {
+        const int i = (first + k) % 3;
+        Face_handle n = f->neighbor(i);
+        if(n == previous)
+          continue;
+        if(m_tr.orientation(f->vertex(ccw(i))->point(), f->vertex(cw(i))->point(), p) == RIGHT_TURN)
+        {
+          if(!try_lock(n))
+            return false;
+          previous = f;
+          f = n;
+          if(m_tr.is_infinite(f))
+          {
+            lt = Tr::OUTSIDE_CONVEX_HULL;
+            li = f->index(m_tr.infinite_vertex());
+            return true;
+          }
+          moved = true;
+          break;
+        }
+      }
+    }
+
+    // `p` is in the closed face `f`
+    int nb_collinear = 0;
+    for(int i = 0; i < 3; ++i)
+    {
+      if(m_tr.orientation(f->vertex(ccw(i))->point(), f->vertex(cw(i))->point(), p) == COLLINEAR)
+      {
+        li = (nb_collinear == 0) ? i : 3 - li - i;
+        ++nb_collinear;
+      }
+    }
+    lt = (nb_collinear == 0) ? Tr::FACE : (nb_collinear == 1) ? Tr::EDGE : Tr::VERTEX;
+    return true;
+  }
+
+  // Collects the faces in conflict with `p` and the boundary of their union,
+  // ordered as expected by `star_hole()`.
+  bool find_conflicts(const Point& p, Face_handle fh,
+                      std::vector<Face_handle>& faces, std::vector<Edge>& edges)
+  {
+    faces.clear();
+    edges.clear();
+    faces.push_back(fh);
+
+    std::stack<std::pair<Face_handle, int> > stack;
+    for(int i = 0; i < 3; ++i)
+    {
+      stack.push(std::make_pair(fh, i));
+      while(!stack.empty())
+      {
+        const Face_handle f = stack.top().first;
+        const int j = stack.top().second;
+        stack.pop();
+        const Face_handle fn = f->neighbor(j);
+        if(!try_lock(fn))
+          return false;
+        if(is_constrained(f, j) || !m_tr.test_conflict(p, fn))
+        {
+          edges.push_back(Edge(fn, fn->index(f)));
+        }
+        else
+        {
+          faces.push_back(fn);
+          const int jn = fn->index(f);
+          stack.push(std::make_pair(fn, cw(jn)));
+          stack.push(std::make_pair(fn, ccw(jn)));
+        }
+      }
+    }
+    return true;
+  }
+
+  static bool is_constrained(Face_handle f, int i)
+  {
+    if constexpr(IsConstrained)
+      return f->is_constrained(i);
+    else
+      return false;
+  }
+
+  Status try_insert(const Point& p, Vertex_handle hint, Random& random,
+                    std::vector<Face_handle>& faces, std::vector<Edge>& edges,
+                    Vertex_handle& v)
+  {
+    if(!try_lock(hint) || !try_lock(p))
+      return LOCK_FAILED;
+
+    Face_handle f;
+    Locate_type lt;
+    int li;
+    if(!locate(p, hint, random, f, lt, li))
+      return LOCK_FAILED;
+
+    if(lt == Tr::VERTEX)
+    {
+      v = f->vertex(li);
+      return DONE;
+    }
+
+    // splitting a constrained edge is left to the sequential code
+    if(lt == Tr::EDGE && is_constrained(f, li))
+      return POSTPONED;
+
+    if(!find_conflicts(p, f, faces, edges))
+      return LOCK_FAILED;
+
+    v = m_tr.star_hole(p, edges.begin(), edges.end(), faces.begin(), faces.end());
+    return DONE;
+  }
+
+  // Locks the faces intersected by `[va, vb]` and their neighbors, which are the
+  // faces read and modified by `insert_constraint(va, vb)`.
+  Status try_insert_constraint(Vertex_handle va, Vertex_handle vb)
+  {
+    if(va == vb)
+      return DONE;
+    if(!try_lock(va) || !try_lock(vb))
+      return LOCK_FAILED;
+
+    const Point& a = va->point();
+    const Point& b = vb->point();
+
+    Face_handle f;
+    bool is_edge = false;
+    Face_circulator fc = m_tr.incident_faces(va), done(fc);
+    do
+    {
+      if(!try_lock(fc))
+        return LOCK_FAILED;
+      const int i = fc->index(va);
+      const Vertex_handle u = fc->vertex(ccw(i)), w = fc->vertex(cw(i));
+      if(u == vb)
+        is_edge = true;
+      else if(!m_tr.is_infinite(u) && m_tr.orientation(a, b, u->point()) == COLLINEAR &&
+              m_tr.collinear_between(a, u->point(), b))
+        return POSTPONED;
+      if(m_tr.is_infinite(fc))
+        continue;
+      if(m_tr.orientation(a, b, u->point()) == RIGHT_TURN &&
+         m_tr.orientation(a, b, w->point()) == LEFT_TURN)
+        f = fc;
+    }
+    while(++fc != done);
+
+    if(!is_edge)
+    {
+      if(f == Face_handle())
+        return POSTPONED;
+      int i = f->index(va);
+      Vertex_handle u = f->vertex(ccw(i)), w = f->vertex(cw(i));
+      for(;;)
+      {
+        if(f->is_constrained(i))
+          return POSTPONED;
+        const Face_handle n = f->neighbor(i);
+        if(!try_lock(n) ||
+           !try_lock(n->neighbor(0)) || !try_lock(n->neighbor(1)) || !try_lock(n->neighbor(2)))
+          return LOCK_FAILED;
+        const Vertex_handle z = n->vertex(n->index(f));
+        if(z == vb)
+          break;
+        const Orientation o = m_tr.orientation(a, b, z->point());
+        if(o == COLLINEAR)
+          return POSTPONED;
+        if(o == LEFT_TURN)
+        {
+          i = n->index(w);
+          w = z;
+        }
+        else
+        {
+          i = n->index(u);
+          u = z;
+        }
+        f = n;
+      }
+    }
+
+    m_tr.insert_constraint(va, vb);
+    return DONE;
+  }
+};
+
+#endif // CGAL_LINKED_WITH_TBB
+
+} // namespace internal
+} // namespace CGAL
+
+#endif // CGAL_TRIANGULATION_2_INTERNAL_PARALLEL_INSERTION_2_H
@@ -0,0 +1,179 @@
+#include <CGAL/Exact_predicates_inexact_constructions_kernel.h>
+#include <CGAL/Delaunay_triangulation_2.h>
+#include <CGAL/Constrained_Delaunay_triangulation_2.h>
+#include <CGAL/Triangulation_vertex_base_with_info_2.h>
+#include <CGAL/point_generators_2.h>
+#include <CGAL/Random.h>
+
+#include <algorithm>
+#include <cassert>
+#include <cstdlib>
+#include <iostream>
+#include <utility>
+#include <vector>
+
+typedef CGAL::Exact_predicates_inexact_constructions_kernel K;
+typedef K::Point_2                                          Point;
+
+#ifdef CGAL_LINKED_WITH_TBB
+typedef CGAL::Parallel_tag                                  Concurrency_tag;
+#else
+typedef CGAL::Sequential_tag                                Concurrency_tag;
+#endif
+
+typedef CGAL::Triangulation_vertex_base_with_info_2<std::size_t, K> Vb;
+typedef CGAL::Triangulation_data_structure_2<
+          Vb, CGAL::Triangulation_face_base_2<K>, Concurrency_tag> Tds;
+typedef CGAL::Delaunay_triangulation_2<K, Tds>              DT;
+typedef CGAL::Delaunay_triangulation_2<K>                   Sequential_DT;
+
+typedef CGAL::Triangulation_data_structure_2<
+          CGAL::Triangulation_vertex_base_2<K>,
+          CGAL::Constrained_triangulation_face_base_2<K>,
+          Concurrency_tag>                                  CTds;
+typedef CGAL::Constrained_Delaunay_triangulation_2<
+          K, CTds, CGAL::Exact_predicates_tag>              CDT;
+typedef CGAL::Constrained_Delaunay_triangulation_2<
+          K, CGAL::Default, CGAL::Exact_predicates_tag>     Sequential_CDT;
+
+// the edges of a triangulation as sorted pairs of points
+template <typename Tr>
+std::vector<std::pair<Point, Point> > edges(const Tr& tr)
+{
+  std::vector<std::pair<Point, Point> > res;
+  for(typename Tr::Finite_edges_iterator eit = tr.finite_edges_begin(); eit != tr.finite_edges_end(); ++eit)
+  {
+    Point p = eit->first->vertex(Tr::cw(eit->second))->point();
+    Point q = eit->first->vertex(Tr::ccw(eit->second))->point();
+    res.push_back(p < q ? std::make_pair(p, q) : std::make_pair(q, p));
+  }
+  std::sort(res.begin(), res.end());
+  return res;
+}
+
+template <typename Tr>
+std::vector<std::pair<Point, Point> > constrained_edges(const Tr& tr)
+{
+  std::vector<std::pair<Point, Point> > res;
+  for(const typename Tr::Edge& e : tr.constrained_edges())
+  {
+    Point p = e.first->vertex(Tr::cw(e.second))->point();
+    Point q = e.first->vertex(Tr::ccw(e.second))->point();
+    res.push_back(p < q ? std::make_pair(p, q) : std::make_pair(q, p));
+  }
+  std::sort(res.begin(), res.end());
+  return res;
+}
+
+void test_delaunay(const std::vector<Point>& points)
+{
+  Sequential_DT sdt;
+  sdt.insert(points.begin(), points.end());
+
+  DT dt;
+  std::ptrdiff_t nb = dt.insert(points.begin(), points.end());
+  std::cout << "  " << nb << " vertices" << std::endl;
+  assert(dt.is_valid());
+  assert(dt.number_of_vertices() == sdt.number_of_vertices());
+  assert(std::size_t(nb) == dt.number_of_vertices());
+  assert(edges(dt) == edges(sdt));
+
+  // insertion in a non-empty triangulation, with info
+  std::vector<std::pair<Point, std::size_t> > points_with_info;
+  for(std::size_t i = 0; i < points.size(); ++i)
+    points_with_info.emplace_back(Point(points[i].x() + 0.5, points[i].y()), i);
+  dt.insert(points_with_info.begin(), points_with_info.end());
+  assert(dt.is_valid());
+  for(const std::pair<Point, std::size_t>& p : points_with_info)
+  {
+    DT::Vertex_handle v = dt.nearest_vertex(p.first);
+    assert(v->point() == p.first);
+    assert(points[v->info()].x() + 0.5 == p.first.x());
+  }
+}
+
+void test_constrained_delaunay(const std::vector<Point>& points)
+{
+  // constraints: short disjoint segments between consecutive points
+  std::vector<std::pair<std::size_t, std::size_t> > constraints;
+  for(std::size_t i = 0; i + 1 < points.size(); i += 2)
+    constraints.emplace_back(i, i + 1);
+
+  // ... and a few long segments crossing them
+  std::vector<Point> cst_points(points);
+  std::vector<std::pair<std::size_t, std::size_t> > cst_indices(constraints);
+  for(int i = 0; i < 4; ++i)
+  {
+    cst_points.emplace_back(-1.1 + 0.1 * i, -1);
+    cst_points.emplace_back(1 - 0.1 * i, 1.1);
+    cst_indices.emplace_back(cst_points.size() - 2, cst_points.size() - 1);
+  }
+
+  Sequential_CDT scdt;
+  scdt.insert_constraints(cst_points.begin(), cst_points.end(), cst_indices.begin(), cst_indices.end());
+
+  CDT cdt;
+  cdt.insert_constraints(cst_points.begin(), cst_points.end(), cst_indices.begin(), cst_indices.end());
+  std::cout << "  " << cdt.number_of_vertices() << " vertices, "
+            << constrained_edges(cdt).size() << " constrained edges" << std::endl;
+  assert(cdt.is_valid());
+  assert(cdt.number_of_vertices() == scdt.number_of_vertices());
+  assert(constrained_edges(cdt).size() == constrained_edges(scdt).size());
+
+  // no intersection between constraints: the result is the same
+  CDT cdt2;
+  std::vector<std::pair<Point, Point> > segments;
+  for(const std::pair<std::size_t, std::size_t>& c : constraints)
+    segments.emplace_back(points[c.first], points[c.second]);
+  cdt2.insert_constraints(segments.begin(), segments.end());
+  Sequential_CDT scdt2;
+  scdt2.insert_constraints(segments.begin(), segments.end());
+  assert(cdt2.is_valid());
+  assert(edges(cdt2) == edges(scdt2));
+  assert(constrained_edges(cdt2) == constrained_edges(scdt2));
+
+  // points inserted in a constrained triangulation, some of them on constraints
+  std::vector<Point> more_points;
+  CGAL::Random rnd(2);
+  for(std::size_t i = 0; i < points.size(); ++i)
+    more_points.emplace_back(rnd.get_double(-1, 1), rnd.get_double(-1, 1));
+  for(std::size_t i = 0; i < 10; ++i)
+    more_points.push_back(CGAL::midpoint(segments[i].first, segments[i].second));
+  cdt2.insert(more_points.begin(), more_points.end());
+  scdt2.insert(more_points.begin(), more_points.end());
+  assert(cdt2.is_valid());
+  assert(cdt2.number_of_vertices() == scdt2.number_of_vertices());
+  assert(constrained_edges(cdt2).size() == constrained_edges(scdt2).size());
+}
+
+int main()
+{
+  CGAL::Random rnd(0);
+
+  std::cout << "Random points in a disk" << std::endl;
+  std::vector<Point> points;
+  CGAL::Random_points_in_disc_2<Point> gen(1., rnd);
+  std::copy_n(gen, 20000, std::back_inserter(points));
+  test_delaunay(points);
+
+  std::cout << "Points on a grid" << std::endl;
+  std::vector<Point> grid;
+  for(int i = 0; i < 100; ++i)
+    for(int j = 0; j < 100; ++j)
+      grid.emplace_back(-1 + 0.02 * i, -1 + 0.02 * j);
+  std::vector<Point> shuffled_grid(grid);
+  CGAL::cpp98::random_shuffle(shuffled_grid.begin(), shuffled_grid.end(), rnd);
+  DT dt;
+  dt.insert(shuffled_grid.begin(), shuffled_grid.end());
+  assert(dt.is_valid());
+  assert(dt.number_of_vertices() == grid.size());
+
+  std::cout << "Constrained Delaunay triangulation" << std::endl;
+  std::vector<Point> jittered_grid;
+  for(const Point& p : grid)
+    jittered_grid.emplace_back(p.x() + rnd.get_double(0, 0.005), p.y() + rnd.get_double(0, 0.005));
+  test_constrained_delaunay(jittered_grid);
+
+  std::cout << "done" << std::endl;
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,73 @@
+// Compares the location of a set of query points one by one, using the
+// previous result as a hint, with the batch `locate()` of `Triangulation_3`.
+
+#include <CGAL/Exact_predicates_inexact_constructions_kernel.h>
+#include <CGAL/Delaunay_triangulation_3.h>
+#include <CGAL/point_generators_3.h>
+#include <CGAL/Real_timer.h>
+
+#include <algorithm>
+#include <cstdlib>
+#include <iostream>
+#include <iterator>
+#include <vector>
+
+typedef CGAL::Exact_predicates_inexact_constructions_kernel  K;
+typedef K::Point_3                                           Point;
+
+template <class DT>
+void bench(const char* name,
+           const std::vector<Point>& points,
+           const std::vector<Point>& queries)
+{
+  typedef typename DT::Cell_handle Cell_handle;
+
+  DT dt(points.begin(), points.end());
+
+  CGAL::Real_timer timer;
+  timer.start();
+  std::vector<Cell_handle> loop_cells;
+  loop_cells.reserve(queries.size());
+  Cell_handle hint;
+  for(const Point& q : queries)
+    loop_cells.push_back(hint = dt.locate(q, hint));
+  timer.stop();
+  std::cout << name << " loop:  " << timer.time() << " sec" << std::endl;
+
+  timer.reset();
+  timer.start();
+  std::vector<Cell_handle> batch_cells;
+  batch_cells.reserve(queries.size());
+  dt.locate(queries.begin(), queries.end(), std::back_inserter(batch_cells));
+  timer.stop();
+  std::cout << name << " batch: " << timer.time() << " sec" << std::endl;
+}
+
+int main(int argc, char* argv[])
+{
+  const std::size_t nb_points = (argc > 1) ? std::atoi(argv[1]) : 100000;
+  const std::size_t nb_queries = (argc > 2) ? std::atoi(argv[2]) : 10 * nb_points;
+
+  CGAL::Random rng(0);
+  std::vector<Point> points, queries;
+  points.reserve(nb_points);
+  queries.reserve(nb_queries);
+  CGAL::Random_points_in_cube_3<Point> gp(1., rng);
+  std::copy_n(gp, nb_points, std::back_inserter(points));
+  CGAL::Random_points_in_cube_3<Point> gq(1., rng);
+  std::copy_n(gq, nb_queries, std::back_inserter(queries));
+
+  std::cout << nb_points << " points, " << nb_queries << " queries" << std::endl;
+
+  bench<CGAL::Delaunay_triangulation_3<K> >("Sequential", points, queries);
+
+#ifdef CGAL_LINKED_WITH_TBB
+  typedef CGAL::Triangulation_data_structure_3<
+    CGAL::Triangulation_vertex_base_3<K>,
+    CGAL::Delaunay_triangulation_cell_base_3<K>,
+    CGAL::Parallel_tag>                                      Parallel_tds;
+  bench<CGAL::Delaunay_triangulation_3<K, Parallel_tds> >("Parallel", points, queries);
+#endif
+
+  return 0;
+}
@@ -249,6 +249,49 @@ is returned.
 */
 Vertex_handle move(Vertex_handle v, const Point & p);
 
+/*!
+Same as `move_if_no_collision(v, p)`.
+
+This function is concurrency-safe if the triangulation is concurrency-safe.
+It will first try to lock all the cells incident to `v` and the conflict zone of `p`.
+If it succeeds, `*could_lock_zone` is true, otherwise it is false (and `v` is not moved).
+In any case, the locked cells are not unlocked by the function, leaving this choice to the user.
+
+This function will try to move `v` only if the move does not
+decrease the dimension: the return value is only meaningful if `*could_lock_zone` is `true`,
+and is the default-constructed handle if `v` wasn't moved since it would decrease the dimension.
+
+\pre Vertex `v` must be finite.
+\pre `dt`.`dimension()` \f$ =3\f$.
+*/
+Vertex_handle move_if_no_collision(Vertex_handle v, const Point & p, bool *could_lock_zone);
+
+/*!
+Same as `move(v, p)`, concurrency-safe in the same way as `move_if_no_collision(v, p, could_lock_zone)`.
+
+\pre Vertex `v` must be finite.
+\pre `dt`.`dimension()` \f$ =3\f$.
+*/
+Vertex_handle move(Vertex_handle v, const Point & p, bool *could_lock_zone);
+
+/*!
+Moves each vertex `v` of the pairs `(v, p)` of the range `[first, beyond)` to `p`, as `move(v, p)`,
+and puts in `res` the vertices at the new positions, in the order of the range.
+If parallelism is enabled, the vertices will be moved in parallel. The moves that would decrease
+the dimension are done sequentially afterwards.
+
+When no new position coincides with the position of another vertex, the vertices are
+not changed, only their positions are. Otherwise, the result is the same as moving
+the vertices one by one, in some order.
+
+\pre (i) all vertices of the range are finite vertices of the triangulation; and (ii) no vertices are repeated in the range.
+
+\tparam InputIterator must be an input iterator with value type `std::pair<Vertex_handle, Point>`.
+\tparam OutputIterator must be an output iterator with value type `Vertex_handle`.
+*/
+template < typename InputIterator, typename OutputIterator >
+OutputIterator move(InputIterator first, InputIterator beyond, OutputIterator res);
+
 /// @}
 
 /*! \name Removal
@@ -319,7 +362,8 @@ This function has exactly the same result and the same preconditions as `remove(
 The difference is in the implementation and efficiency. This version does not re-triangulate the hole after each
 point removal but only after removing all vertices. This is more efficient if (and only if) the removed points
 are organized in a small number of connected components of the Delaunay triangulation.
-Another difference is that there is no parallel version of this function.
+If parallelism is enabled, this function is the same as `remove(first, beyond)`:
+the vertices are removed one by one in parallel.
 
 \tparam InputIterator must be an input iterator with value type `Vertex_handle`.
 */
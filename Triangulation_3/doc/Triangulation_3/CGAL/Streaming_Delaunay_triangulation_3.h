@@ -0,0 +1,155 @@
+namespace CGAL {
+
+/*!
+\ingroup PkgTriangulation3TriangulationClasses
+
+The class `Streaming_Delaunay_triangulation_3` computes the Delaunay
+tetrahedralization of a point set that does not fit in memory, by
+streaming its points in and its tetrahedra out.
+
+The bounding box of the points is divided into a regular grid of
+\f$ 2^{depth} \times 2^{depth} \times 2^{depth}\f$ cells. The points are
+inserted one by one, interleaved with finalization events: finalizing a grid
+cell tells that no more point will be inserted in it. A tetrahedron is final
+as soon as its circumscribing ball lies in finalized grid cells, as it is then
+a tetrahedron of the Delaunay tetrahedralization of the whole point set. The
+final tetrahedra are written to an output iterator and removed from memory, as
+well as the vertices that are no longer used, so that only the tetrahedra of
+the front between the finalized and unfinalized space are kept in memory.
+
+To keep this front small, the points should be sorted along a space filling
+curve on the grid cells, and each grid cell finalized just after its last
+point, as done by `stream_Delaunay_triangulation_3()`.
+
+\tparam Gt is the geometric traits class and must be a model of `DelaunayTriangulationTraits_3`.
+
+\sa `CGAL::Delaunay_triangulation_3`
+\sa `CGAL::stream_Delaunay_triangulation_3()`
+*/
+template< typename Gt >
+class Streaming_Delaunay_triangulation_3 {
+public:
+
+/// \name Types
+/// @{
+
+/*!
+The point type.
+*/
+typedef Gt::Point_3 Point;
+
+/*!
+A final tetrahedron, given by the ids of its four vertices, in positive orientation.
+*/
+typedef std::array<std::size_t, 4> Tetrahedron;
+
+/// @}
+
+/// \name Creation
+/// @{
+
+/*!
+creates an empty triangulation of the points of `bbox`, with a grid of
+\f$ 2^{depth}\f$ cells along each axis.
+\pre `bbox` is not flat, and `0 <= depth <= 7`.
+*/
+Streaming_Delaunay_triangulation_3(const Bbox_3& bbox, int depth = 4, const Gt& gt = Gt());
+
+/// @}
+
+/// \name Access Functions
+/// @{
+
+/*!
+returns the bounding box of the grid.
+*/
+const Bbox_3& bbox() const;
+
+/*!
+returns the depth of the grid.
+*/
+int depth() const;
+
+/*!
+returns the number of cells of the grid.
+*/
+std::size_t number_of_grid_cells() const;
+
+/*!
+returns the index of the grid cell containing `p`.
+\pre `p` lies in `bbox()`.
+*/
+std::size_t grid_cell(const Point& p) const;
+
+/*!
+returns whether the grid cell `g` has been finalized.
+*/
+bool is_finalized(std::size_t g) const;
+
+/*!
+returns the number of vertices in memory.
+*/
+std::size_t number_of_vertices() const;
+
+/*!
+returns the number of cells in memory, including the infinite ones.
+*/
+std::size_t number_of_cells() const;
+
+/// @}
+
+/// \name Insertion and Finalization
+/// @{
+
+/*!
+inserts the point `p`, whose id is `id`, and writes the tetrahedra that
+become final to `out`. If `p` has already been inserted, the tetrahedra
+incident to it refer to the id of its first insertion.
+\tparam OutputIterator an output iterator with value type `Tetrahedron`.
+\pre The grid cell of `p` is not finalized.
+*/
+template <class OutputIterator>
+OutputIterator insert(const Point& p, std::size_t id, OutputIterator out);
+
+/*!
+finalizes the grid cell `g`, meaning that no point will be inserted in it
+anymore, and writes the tetrahedra that become final to `out`.
+\tparam OutputIterator an output iterator with value type `Tetrahedron`.
+\pre `g` is not finalized.
+*/
+template <class OutputIterator>
+OutputIterator finalize(std::size_t g, OutputIterator out);
+
+/*!
+finalizes all the grid cells that are not yet finalized, which writes
+the remaining tetrahedra to `out`.
+\tparam OutputIterator an output iterator with value type `Tetrahedron`.
+*/
+template <class OutputIterator>
+OutputIterator finalize_all(OutputIterator out);
+
+/// @}
+
+}; /* end Streaming_Delaunay_triangulation_3 */
+
+/*!
+\ingroup PkgTriangulation3TriangulationClasses
+
+computes the Delaunay tetrahedralization of `points` with a
+`Streaming_Delaunay_triangulation_3` and writes its finite tetrahedra,
+as arrays of four indices in `points`, to `out`.
+
+The grid cells are ordered along a Hilbert curve, the points are sorted
+by grid cell and along a Hilbert curve in each grid cell, and each grid cell
+is finalized after its last point. The tetrahedra incident to a duplicated
+point refer to the index of one of its occurrences.
+
+\tparam PointRange a model of `ConstRange` with a \cgal point type as value type.
+\tparam OutputIterator an output iterator with value type `std::array<std::size_t, 4>`.
+\pre `0 <= depth <= 7`.
+*/
+template <class PointRange, class OutputIterator>
+OutputIterator stream_Delaunay_triangulation_3(const PointRange& points, OutputIterator out,
+                                               int depth = 4);
+
+} /* end namespace CGAL */
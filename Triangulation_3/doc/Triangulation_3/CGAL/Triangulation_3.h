@@ -722,6 +722,23 @@ Cell_handle
 locate(const Point & query, Vertex_handle hint,
        bool *could_lock_zone = nullptr) const;
 
+/*!
+Locates the points of the range `[first, beyond)` and writes, for each of them
+and in the order of the range, the cell returned by `locate()` into `res`.
+The queries are sorted along a space filling curve, so that the cell
+found for a query is used as the starting place for the search of the next one.
+The triangulation is not modified. If the triangulation is concurrency-safe
+(that is, `Concurrency_tag` is `Parallel_tag`), the queries are located in parallel.
+
+\tparam InputIterator must be an input iterator with value type `Point`.
+\tparam OutputIterator must be an output iterator accepting `Cell_handle`.
+
+\return the past-the-end iterator of the output.
+*/
+template <class InputIterator, class OutputIterator>
+OutputIterator
+locate(InputIterator first, InputIterator beyond, OutputIterator res) const;
+
 /*!
 Same as `locate()` but uses inexact predicates.
 This function returns a handle on a cell that is a good approximation of the exact
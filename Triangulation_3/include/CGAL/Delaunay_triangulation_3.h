@@ -714,6 +714,13 @@ public:
   template < typename InputIterator >
   size_type remove_cluster(InputIterator first, InputIterator beyond)
   {
+#ifdef CGAL_LINKED_WITH_TBB
+    // The vertices are removed one by one in parallel: the zones
+    // to lock would be too large if the cluster was removed at once
+    if(this->is_parallel())
+      return remove(first, beyond);
+#endif // CGAL_LINKED_WITH_TBB
+
     Self tmp;
     Vertex_remover<Self> remover(tmp);
     return Tr_Base::remove(first, beyond, remover);
@@ -722,6 +729,74 @@ public:
   // MOVE
   Vertex_handle move_if_no_collision(Vertex_handle v, const Point& p);
   Vertex_handle move(Vertex_handle v, const Point& p);
+  // Concurrency-safe
+  // See Triangulation_3::move_if_no_collision for more information
+  Vertex_handle move_if_no_collision(Vertex_handle v, const Point& p,
+                                     bool *could_lock_zone);
+  Vertex_handle move(Vertex_handle v, const Point& p, bool *could_lock_zone);
+
+  // Moves each vertex `first->first` to `first->second`, and outputs
+  // the vertices at the new positions in `res`, in the order of the input
+  template < typename InputIterator, typename OutputIterator >
+  OutputIterator move(InputIterator first, InputIterator beyond, OutputIterator res)
+  {
+    std::vector<std::pair<Vertex_handle, Point> > moves(first, beyond);
+    std::vector<Vertex_handle> moved(moves.size());
+
+#ifdef CGAL_TRIANGULATION_3_PROFILING
+    WallClockTimer t;
+#endif
+
+    // Parallel
+#ifdef CGAL_LINKED_WITH_TBB
+    if(this->is_parallel() && dimension() == 3)
+    {
+      // Sort the moves along the new positions, so that the moves handled
+      // by a given thread are close to each other
+      std::vector<Point> points;
+      points.reserve(moves.size());
+      std::vector<std::size_t> indices;
+      indices.reserve(moves.size());
+      for(std::size_t i = 0; i < moves.size(); ++i)
+      {
+        points.push_back(moves[i].second);
+        indices.push_back(i);
+      }
+
+      typedef typename Pointer_property_map<Point>::type Pmap;
+      typedef Spatial_sort_traits_adapter_3<Geom_traits,Pmap> Search_traits;
+      spatial_sort<Concurrency_tag>(indices.begin(), indices.end(),
+                                    Search_traits(make_property_map(points),geom_traits()));
+
+      tbb::concurrent_vector<std::size_t> moves_to_do_sequentially;
+      tbb::parallel_for(tbb::blocked_range<size_t>(0, indices.size()),
+                        Move_point<Self>(*this, moves, indices, moved,
+                                         moves_to_do_sequentially));
+
+      // Do the rest sequentially
+      for(typename tbb::concurrent_vector<std::size_t>::const_iterator
+              it = moves_to_do_sequentially.begin(),
+              it_end = moves_to_do_sequentially.end()
+          ; it != it_end
+          ; ++it)
+      {
+        moved[*it] = move(moves[*it].first, moves[*it].second);
+      }
+    }
+    // Sequential
+    else
+#endif // CGAL_LINKED_WITH_TBB
+    {
+      for(std::size_t i = 0; i < moves.size(); ++i)
+        moved[i] = move(moves[i].first, moves[i].second);
+    }
+
+#ifdef CGAL_TRIANGULATION_3_PROFILING
+    double elapsed = t.elapsed();
+    std::cerr << "Points moved in " << elapsed << " seconds." << std::endl;
+#endif
+    return std::copy(moved.begin(), moved.end(), res);
+  }
 
   // return new cells(internal)
   template <class OutputItCells>
@@ -1054,6 +1129,54 @@ protected:
       }
     }
   };
+
+  // Functor for parallel move(begin, end, res) function
+  template <typename DT>
+  class Move_point
+  {
+    typedef typename DT::Point                          Point;
+    typedef typename DT::Vertex_handle                  Vertex_handle;
+
+    DT& m_dt;
+    const std::vector<std::pair<Vertex_handle, Point> >& m_moves;
+    const std::vector<std::size_t>& m_indices;
+    std::vector<Vertex_handle>& m_moved;
+    tbb::concurrent_vector<std::size_t>& m_moves_to_do_sequentially;
+
+  public:
+    // Constructor
+    Move_point(DT& dt,
+               const std::vector<std::pair<Vertex_handle, Point> >& moves,
+               const std::vector<std::size_t>& indices,
+               std::vector<Vertex_handle>& moved,
+               tbb::concurrent_vector<std::size_t>& moves_to_do_sequentially)
+    : m_dt(dt), m_moves(moves), m_indices(indices), m_moved(moved),
+      m_moves_to_do_sequentially(moves_to_do_sequentially)
+    {}
+
+    // operator()
+    void operator()(const tbb::blocked_range<size_t>& r) const
+    {
+      for(size_t i_idx = r.begin() ; i_idx != r.end() ; ++i_idx)
+      {
+        std::size_t i_move = m_indices[i_idx];
+        bool could_lock_zone;
+        Vertex_handle moved;
+        do
+        {
+          moved = m_dt.move(m_moves[i_move].first, m_moves[i_move].second,
+                            &could_lock_zone);
+          m_dt.unlock_all_elements();
+        }
+        while(!could_lock_zone);
+
+        if(moved == Vertex_handle())
+          m_moves_to_do_sequentially.push_back(i_move);
+        else
+          m_moved[i_move] = moved;
+      }
+    }
+  };
 #endif // CGAL_LINKED_WITH_TBB
 
   template < class DelaunayTriangulation_3 >
@@ -1279,6 +1402,12 @@ public:
     return tmp.insert(p, lt, c, li, lj);
   }
 
+  Vertex_handle insert(const Point& p, Locate_type lt, Cell_handle c, int li, int lj,
+                       bool *could_lock_zone)
+  {
+    return tmp.insert(p, lt, c, li, lj, could_lock_zone);
+  }
+
   Vertex_handle insert(const Point& p, Cell_handle c)
   {
     return tmp.insert(p, c);
@@ -1329,6 +1458,34 @@ move_if_no_collision(Vertex_handle v, const Point& p)
         return res;
 }
 
+template < class Gt, class Tds, class Lds >
+typename Delaunay_triangulation_3<Gt,Tds,Default,Lds>::Vertex_handle
+Delaunay_triangulation_3<Gt,Tds,Default,Lds>::
+move_if_no_collision(Vertex_handle v, const Point& p, bool *could_lock_zone)
+{
+  Self tmp;
+  Vertex_remover<Self> remover(tmp);
+  Vertex_inserter<Self> inserter(*this);
+  return Tr_Base::move_if_no_collision(v,p,remover,inserter,could_lock_zone);
+}
+
+template < class Gt, class Tds, class Lds >
+typename Delaunay_triangulation_3<Gt,Tds,Default,Lds>::Vertex_handle
+Delaunay_triangulation_3<Gt,Tds,Default,Lds>::
+move(Vertex_handle v, const Point& p, bool *could_lock_zone)
+{
+  Vertex_handle w = move_if_no_collision(v, p, could_lock_zone);
+  if(*could_lock_zone && w != Vertex_handle() && w != v)
+  {
+    // The zone around v is still locked, and its removal does not
+    // decrease the dimension
+    CGAL_assertion_code(bool removed =)
+    remove(v, could_lock_zone);
+    CGAL_assertion(removed && *could_lock_zone);
+  }
+  return w;
+}
+
 template <class Gt, class Tds, class Lds >
 typename Delaunay_triangulation_3<Gt,Tds,Default,Lds>::Vertex_handle
 Delaunay_triangulation_3<Gt,Tds,Default,Lds>::
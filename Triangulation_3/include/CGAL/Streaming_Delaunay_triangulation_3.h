@@ -0,0 +1,719 @@
+// Copyright (c) 2026 GeometryFactory (France).  All rights reserved.
+//
+// This file is part of CGAL (www.cgal.org)
+//
+// $URL$
+// $Id$
+// SPDX-License-Identifier: GPL-3.0-or-later OR LicenseRef-Commercial
+//
+// Author(s)     : GeometryFactory
+
+#ifndef CGAL_STREAMING_DELAUNAY_TRIANGULATION_3_H
+#define CGAL_STREAMING_DELAUNAY_TRIANGULATION_3_H
+
+#include <CGAL/license/Triangulation_3.h>
+
+#include <CGAL/Delaunay_triangulation_3.h>
+#include <CGAL/Delaunay_triangulation_cell_base_3.h>
+#include <CGAL/Triangulation_cell_base_with_info_3.h>
+#include <CGAL/Triangulation_vertex_base_with_info_3.h>
+
+#include <CGAL/array.h>
+#include <CGAL/Bbox_3.h>
+#include <CGAL/FPU.h>
+#include <CGAL/Interval_nt.h>
+#include <CGAL/Random.h>
+#include <CGAL/Simple_cartesian.h>
+#include <CGAL/Spatial_sort_traits_adapter_3.h>
+#include <CGAL/hilbert_sort.h>
+#include <CGAL/property_map.h>
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <limits>
+#include <numeric>
+#include <vector>
+
+namespace CGAL {
+
+/*!
+  Streaming construction of the Delaunay tetrahedralization of a point set
+  which does not fit in memory.
+
+  The bounding box of the points is divided into a regular grid of
+  `2^depth x 2^depth x 2^depth` cells.  The points are inserted one by one,
+  interleaved with finalization events: finalizing a grid cell tells that no
+  more point will be inserted in it.  A tetrahedron is final as soon as its
+  circumscribing ball lies in finalized grid cells, as it is then a
+  tetrahedron of the Delaunay tetrahedralization of the whole point set.  The
+  final tetrahedra are written to the output and removed from memory, as well
+  as the vertices that are no longer used, so that only the tetrahedra of the
+  front between the finalized and unfinalized space are kept in memory.
+
+  The points should be sorted along a space filling curve and each grid cell
+  finalized just after its last point, see `stream_Delaunay_triangulation_3()`.
+*/
+template <class Gt>
+class Streaming_Delaunay_triangulation_3
+{
+  struct Vertex_info
+  {
+    std::size_t id = (std::numeric_limits<std::size_t>::max)();
+    // number of the cells in memory incident to the vertex
+    std::size_t nb_cells = 0;
+  };
+
+  struct Cell_info
+  {
+    // unfinalized grid cell intersecting the circumscribing ball,
+    // and position of the cell in the list of the cells of this witness
+    std::uint32_t witness = 0;
+    std::uint32_t position = 0;
+    bool finalized = false;
+    // center and radius of a ball containing the circumscribing ball
+    // of a finite cell, computed at its first update (negative radius before)
+    std::array<double, 4> ball = {{ 0, 0, 0, -1 }};
+  };
+
+  typedef Triangulation_vertex_base_with_info_3<Vertex_info, Gt>     Vb;
+  typedef Delaunay_triangulation_cell_base_3<Gt>                     Dcb;
+  typedef Triangulation_cell_base_with_info_3<Cell_info, Gt, Dcb>    Cb;
+  typedef Triangulation_data_structure_3<Vb, Cb>                     Tds;
+
+public:
+  typedef Gt                                          Geom_traits;
+  typedef Delaunay_triangulation_3<Gt, Tds>           Triangulation;
+  typedef typename Gt::Point_3                        Point;
+
+  // The vertices of a final tetrahedron, given by the ids of their points,
+  // in positive orientation.
+  typedef std::array<std::size_t, 4>                  Tetrahedron;
+
+private:
+  typedef typename Triangulation::Vertex_handle       Vertex_handle;
+  typedef typename Triangulation::Cell_handle         Cell_handle;
+  typedef typename Triangulation::Facet               Facet;
+
+  typedef Interval_nt<false>                          I;
+
+  static constexpr std::size_t none = (std::numeric_limits<std::size_t>::max)();
+
+public:
+  /// Creates an empty triangulation of the points of `bbox`, with a grid of
+  /// `2^depth` cells along each axis.
+  Streaming_Delaunay_triangulation_3(const Bbox_3& bbox, int depth = 4,
+                                     const Gt& gt = Gt())
+    : tr_(gt), bbox_(bbox), depth_(depth), resolution_(std::size_t(1) << depth),
+      unfinalized_(depth + 1), waiting_(resolution_ * resolution_ * resolution_),
+      hint_(), rng_(0)
+  {
+    // the grid cells have their own waiting lists and counters, that is about 40 bytes
+    // per grid cell, which is already 80MB at the maximal depth
+    CGAL_precondition(depth >= 0 && depth <= 7);
+    CGAL_precondition(bbox.xmin() < bbox.xmax() && bbox.ymin() < bbox.ymax() && bbox.zmin() < bbox.zmax());
+
+    for(int l=0; l<=depth_; ++l)
+    {
+      const std::size_t n = std::size_t(1) << l;
+      unfinalized_[l].assign(n * n * n, std::size_t(1) << (3 * (depth_ - l)));
+    }
+
+    // The grid cell of a point is computed in double, so the boxes of the grid
+    // cells are slightly enlarged for the tests of the final tetrahedra.
+    const double m = (std::max)({ std::abs(bbox.xmin()), std::abs(bbox.xmax()),
+                                  std::abs(bbox.ymin()), std::abs(bbox.ymax()),
+                                  std::abs(bbox.zmin()), std::abs(bbox.zmax()) });
+    for(int i=0; i<3; ++i)
+    {
+      cell_size_[i] = (bbox_.max(i) - bbox_.min(i)) / resolution_;
+      margin_[i] = 1e-6 * cell_size_[i] + 1e-12 * m;
+    }
+  }
+
+  Streaming_Delaunay_triangulation_3(const Streaming_Delaunay_triangulation_3&) = delete;
+  Streaming_Delaunay_triangulation_3& operator=(const Streaming_Delaunay_triangulation_3&) = delete;
+
+  // ACCESS
+
+  const Bbox_3& bbox() const { return bbox_; }
+  int depth() const { return depth_; }
+  std::size_t number_of_grid_cells() const { return waiting_.size(); }
+
+  /// Returns the grid cell of `p`, which must lie in the bounding box.
+  std::size_t grid_cell(const Point& p) const
+  {
+    const double c[3] = { to_double(p.x()), to_double(p.y()), to_double(p.z()) };
+    std::size_t g[3];
+    for(int i=0; i<3; ++i)
+    {
+      CGAL_precondition(c[i] >= bbox_.min(i) && c[i] <= bbox_.max(i));
+      g[i] = grid_coordinate(c[i], i);
+    }
+    return g[0] + resolution_ * (g[1] + resolution_ * g[2]);
+  }
+
+  bool is_finalized(std::size_t g) const
+  {
+    CGAL_precondition(g < number_of_grid_cells());
+    return unfinalized_[depth_][g] == 0;
+  }
+
+  /// Returns the number of vertices in memory.
+  std::size_t number_of_vertices() const { return tr_.number_of_vertices(); }
+
+  /// Returns the number of cells in memory, including the infinite ones.
+  std::size_t number_of_cells() const { return tr_.tds().number_of_cells(); }
+
+  // INSERTION AND FINALIZATION
+
+  /// Inserts the point `p`, whose id is `id`, in an unfinalized grid cell,
+  /// and writes the tetrahedra that become final to `out`.
+  /// If `p` has already been inserted, the tetrahedra incident to it refer
+  /// to the id of its first insertion.
+  template <class OutputIterator>
+  OutputIterator insert(const Point& p, std::size_t id, OutputIterator out)
+  {
+    CGAL_precondition(!is_finalized(grid_cell(p)));
+
+    if(tr_.dimension() < 3)
+    {
+      Vertex_handle v = tr_.insert(p, hint_);
+      if(v->info().id == none)
+        v->info().id = id;
+      hint_ = v->cell();
+      if(tr_.dimension() == 3)
+        out = start_front(out);
+      return out;
+    }
+
+    int li;
+    Cell_handle c = conflicting_cell(p, li);
+    if(li >= 0)
+      return out;
+
+    cells_.clear();
+    facets_.clear();
+    tr_.find_conflicts(p, c, std::back_inserter(facets_), std::back_inserter(cells_));
+    for(Cell_handle ch : cells_)
+    {
+      detach(ch);
+      for(int i=0; i<4; ++i)
+        --ch->vertex(i)->info().nb_cells;
+    }
+
+    // The new cells are found from the cells outside the hole.
+    const Facet f = facets_.front();
+    for(Facet& bf : facets_)
+    {
+      Cell_handle n = bf.first->neighbor(bf.second);
+      bf = Facet(n, n->index(bf.first));
+    }
+
+    Vertex_handle v = tr_.insert_in_hole(p, cells_.begin(), cells_.end(), f.first, f.second);
+    v->info().id = id;
+    hint_ = v->cell();
+
+    // The closed region in which a point is in conflict with a new cell
+    // contains `p`, so that the grid cell of `p` is a witness of the new cells.
+    const std::size_t g = grid_cell(p);
+    for(const Facet& bf : facets_)
+    {
+      Cell_handle ch = bf.first->neighbor(bf.second);
+      for(int i=0; i<4; ++i)
+        ++ch->vertex(i)->info().nb_cells;
+      attach(ch, g);
+    }
+    return out;
+  }
+
+  /// Finalizes the grid cell `g`: no point will be inserted in it anymore.
+  /// The tetrahedra that become final are written to `out`.
+  template <class OutputIterator>
+  OutputIterator finalize(std::size_t g, OutputIterator out)
+  {
+    CGAL_precondition(!is_finalized(g));
+
+    std::size_t x = g % resolution_, y = (g / resolution_) % resolution_, z = g / (resolution_ * resolution_);
+    for(int l=depth_; l>=0; --l, x /= 2, y /= 2, z /= 2)
+      --unfinalized_[l][node_index(l, x, y, z)];
+
+    std::vector<Cell_handle> cells;
+    cells.swap(waiting_[g]);
+    for(Cell_handle c : cells)
+      out = update_cell(c, out);
+    return out;
+  }
+
+  /// Finalizes all the grid cells which are not yet finalized.
+  template <class OutputIterator>
+  OutputIterator finalize_all(OutputIterator out)
+  {
+    for(std::size_t g=0; g<number_of_grid_cells(); ++g)
+      if(!is_finalized(g))
+        out = finalize(g, out);
+    return out;
+  }
+
+private:
+  std::size_t node_index(int l, std::size_t x, std::size_t y, std::size_t z) const
+  {
+    const std::size_t n = std::size_t(1) << l;
+    return x + n * (y + n * z);
+  }
+
+  // The first cells: all of them are tested, as some grid cells
+  // may have been finalized before the triangulation has dimension 3.
+  template <class OutputIterator>
+  OutputIterator start_front(OutputIterator out)
+  {
+    std::vector<Cell_handle> cells;
+    for(Cell_handle c : tr_.tds().cell_handles())
+      cells.push_back(c);
+    for(Cell_handle c : cells)
+      for(int i=0; i<4; ++i)
+        ++c->vertex(i)->info().nb_cells;
+    for(Cell_handle c : cells)
+      if(tr_.tds().cells().is_used(c))
+        out = update_cell(c, out);
+    return out;
+  }
+
+  // The unfinalized cells are in the list of their witness, from which
+  // the cells removed by an insertion are detached.
+  void attach(Cell_handle c, std::size_t w)
+  {
+    c->info().witness = std::uint32_t(w);
+    c->info().position = std::uint32_t(waiting_[w].size());
+    waiting_[w].push_back(c);
+  }
+
+  void detach(Cell_handle c)
+  {
+    std::vector<Cell_handle>& cells = waiting_[c->info().witness];
+    Cell_handle last = cells.back();
+    cells[c->info().position] = last;
+    last->info().position = c->info().position;
+    cells.pop_back();
+  }
+
+  // Either finds a new witness of `c` or finalizes it.
+  template <class OutputIterator>
+  OutputIterator update_cell(Cell_handle c, OutputIterator out)
+  {
+    const std::size_t w = witness(c);
+    if(w != none)
+    {
+      attach(c, w);
+      return out;
+    }
+
+    c->info().finalized = true;
+    if(!tr_.is_infinite(c))
+      *out++ = CGAL::make_array(c->vertex(0)->info().id, c->vertex(1)->info().id,
+                                c->vertex(2)->info().id, c->vertex(3)->info().id);
+    release(c);
+    return out;
+  }
+
+  // Removes from memory the final cells which are only adjacent to final
+  // cells, starting from `c`: no point will be in conflict with them, nor
+  // with their neighbors, so that the conflict zones never reach them.
+  void release(Cell_handle c)
+  {
+    std::vector<Cell_handle> stack(1, c);
+    while(!stack.empty())
+    {
+      c = stack.back();
+      stack.pop_back();
+      if(!tr_.tds().cells().is_used(c) || !c->info().finalized)
+        continue;
+
+      bool releasable = true;
+      for(int i=0; i<4; ++i)
+        if(c->neighbor(i) != Cell_handle() && !c->neighbor(i)->info().finalized)
+          releasable = false;
+      if(!releasable)
+        continue;
+
+      if(hint_ == c)
+        hint_ = Cell_handle();
+      for(int i=0; i<4; ++i)
+      {
+        Cell_handle n = c->neighbor(i);
+        if(n == Cell_handle())
+          continue;
+        n->set_neighbor(n->index(c), Cell_handle());
+        stack.push_back(n);
+        if(hint_ == Cell_handle())
+          hint_ = n;
+      }
+      for(int i=0; i<4; ++i)
+      {
+        Vertex_handle v = c->vertex(i);
+        if(!tr_.is_infinite(v) && --v->info().nb_cells == 0)
+          tr_.tds().delete_vertex(v);
+      }
+      tr_.tds().delete_cell(c);
+    }
+  }
+
+  // Tells whether `c` is in conflict with `p` or has a vertex at `p`, whose
+  // index is then `li` (the symbolic perturbation does not apply to duplicates).
+  bool is_conflicting(Cell_handle c, const Point& p, int& li) const
+  {
+    typename Gt::Compare_xyz_3 compare_xyz = tr_.geom_traits().compare_xyz_3_object();
+    for(li=0; li<4; ++li)
+      if(!tr_.is_infinite(c->vertex(li)) && compare_xyz(c->vertex(li)->point(), p) == EQUAL)
+        return true;
+    li = -1;
+    return tr_.side_of_sphere(c, p, true) == ON_BOUNDED_SIDE;
+  }
+
+  // Returns a cell in conflict with `p`, or a cell with a vertex at `p`,
+  // walking from the hint in the cells in memory.
+  // A point that is not in conflict with a cell is not in conflict with the
+  // cells which are not incident to a vertex at the same place either, so
+  // that a duplicate is found before any other conflicting cell.
+  Cell_handle conflicting_cell(const Point& p, int& li)
+  {
+    typename Gt::Orientation_3 orientation = tr_.geom_traits().orientation_3_object();
+
+    Cell_handle c = hint_;
+    if(c == Cell_handle())
+      c = tr_.tds().cells_begin();
+
+    Cell_handle previous;
+    for(std::size_t n = tr_.tds().number_of_cells(); n != 0; --n)
+    {
+      if(is_conflicting(c, p, li))
+        return c;
+
+      Cell_handle next;
+      int inf;
+      if(c->has_vertex(tr_.infinite_vertex(), inf))
+      {
+        // `p` is not beyond the convex hull facet of `c`
+        next = c->neighbor(inf);
+      }
+      else
+      {
+        const int first = rng_.get_int(0, 4);
+        for(int j=0; j<4 && next == Cell_handle(); ++j)
+        {
+          const int i = (first + j) & 3;
+          Cell_handle n = c->neighbor(i);
+          if(n == Cell_handle() || n == previous)
+            continue;
+          const Point* pts[4] = { &(c->vertex(0)->point()), &(c->vertex(1)->point()),
+                                  &(c->vertex(2)->point()), &(c->vertex(3)->point()) };
+          pts[i] = &p;
+          if(orientation(*pts[0], *pts[1], *pts[2], *pts[3]) == NEGATIVE)
+            next = n;
+        }
+      }
+      if(next == Cell_handle())
+        break;
+      previous = c;
+      c = next;
+    }
+
+    // The walk is blocked by the cells removed from memory, or `p` is on the
+    // boundary of the cell reached: the conflict zone is searched in all
+    // the cells in memory.
+    for(auto it = tr_.tds().cells_begin(); it != tr_.tds().cells_end(); ++it)
+      if(!it->info().finalized && is_conflicting(it, p, li))
+        return it;
+
+    CGAL_error_msg("no cell in conflict with the point");
+    return Cell_handle();
+  }
+
+  static I interval(const typename Gt::FT& x)
+  {
+    return I(to_interval(x));
+  }
+
+  // bounds along `axis` of the box of the node `x` of the level `l` of the octree
+  std::array<double, 2> node_box(int l, std::size_t x, int axis) const
+  {
+    const double w = cell_size_[axis] * double(std::size_t(1) << (depth_ - l));
+    return {{ bbox_.min(axis) + x * w - margin_[axis],
+              bbox_.min(axis) + (x + 1) * w + margin_[axis] }};
+  }
+
+  // Returns an unfinalized grid cell whose box may intersect the closed
+  // region in which a point is in conflict with `c`, or `none`.
+  // The region is a ball for a finite cell, and a half-space bounded
+  // by the plane of the convex hull facet for an infinite cell.
+  std::size_t witness(Cell_handle c) const
+  {
+    int inf;
+    if(c->has_vertex(tr_.infinite_vertex(), inf))
+    {
+      Protect_FPU_rounding<true> protect;
+
+      // the facet, oriented as in `Delaunay_triangulation_3::side_of_sphere()`
+      static const int facet[4][3] = { {2, 1, 3}, {2, 3, 0}, {1, 0, 3}, {0, 1, 2} };
+      const Point& a = c->vertex(facet[inf][0])->point();
+      const Point& b = c->vertex(facet[inf][1])->point();
+      const Point& d = c->vertex(facet[inf][2])->point();
+      const I ax = interval(a.x()), ay = interval(a.y()), az = interval(a.z());
+      const I bx = interval(b.x()) - ax, by = interval(b.y()) - ay, bz = interval(b.z()) - az;
+      const I dx = interval(d.x()) - ax, dy = interval(d.y()) - ay, dz = interval(d.z()) - az;
+      const I nx = by * dz - bz * dy, ny = bz * dx - bx * dz, nz = bx * dy - by * dx;
+      const I na = nx * ax + ny * ay + nz * az;
+
+      const std::size_t lo[3] = { 0, 0, 0 };
+      const std::size_t hi[3] = { resolution_ - 1, resolution_ - 1, resolution_ - 1 };
+      return find_witness(lo, hi, [&](int l, std::size_t x, std::size_t y, std::size_t z)
+      {
+        const std::array<double, 2> bx = node_box(l, x, 0), by = node_box(l, y, 1), bz = node_box(l, z, 2);
+        const I f = nx * I(bx[0], bx[1]) + ny * I(by[0], by[1]) + nz * I(bz[0], bz[1]) - na;
+        return f.sup() >= 0;
+      });
+    }
+
+    std::array<double, 4>& ball = c->info().ball;
+    if(ball[3] < 0)
+      ball = bounding_ball(c);
+
+    // the grid cells intersecting the bounding box of the ball
+    std::size_t lo[3], hi[3];
+    for(int i=0; i<3; ++i)
+    {
+      lo[i] = grid_coordinate(ball[i] - ball[3] - margin_[i], i);
+      hi[i] = grid_coordinate(ball[i] + ball[3] + margin_[i], i);
+    }
+
+    // The radius of the ball is enlarged enough to cover the rounding errors
+    // of the distance, which are small compared to the margin of the boxes.
+    const double r2 = square(ball[3]);
+    return find_witness(lo, hi, [&](int l, std::size_t x, std::size_t y, std::size_t z)
+    {
+      const std::size_t xyz[3] = { x, y, z };
+      double dist2 = 0;
+      for(int i=0; i<3; ++i)
+      {
+        const std::array<double, 2> box = node_box(l, xyz[i], i);
+        if(ball[i] < box[0])
+          dist2 += square(box[0] - ball[i]);
+        else if(ball[i] > box[1])
+          dist2 += square(ball[i] - box[1]);
+      }
+      return dist2 <= r2;
+    });
+  }
+
+  // Returns a ball containing the circumscribing ball of the finite cell `c`,
+  // computed with interval arithmetic.
+  std::array<double, 4> bounding_ball(Cell_handle c) const
+  {
+    Protect_FPU_rounding<true> protect;
+
+    const Point& a = c->vertex(0)->point();
+    const Point& b = c->vertex(1)->point();
+    const Point& d = c->vertex(2)->point();
+    const Point& e = c->vertex(3)->point();
+    const I ax = interval(a.x()), ay = interval(a.y()), az = interval(a.z());
+    const I bx = interval(b.x()) - ax, by = interval(b.y()) - ay, bz = interval(b.z()) - az;
+    const I dx = interval(d.x()) - ax, dy = interval(d.y()) - ay, dz = interval(d.z()) - az;
+    const I ex = interval(e.x()) - ax, ey = interval(e.y()) - ay, ez = interval(e.z()) - az;
+    const I b2 = square(bx) + square(by) + square(bz);
+    const I d2 = square(dx) + square(dy) + square(dz);
+    const I e2 = square(ex) + square(ey) + square(ez);
+    // circumcenter relative to `a`
+    const I de_x = dy * ez - dz * ey, de_y = dz * ex - dx * ez, de_z = dx * ey - dy * ex;
+    const I eb_x = ey * bz - ez * by, eb_y = ez * bx - ex * bz, eb_z = ex * by - ey * bx;
+    const I bd_x = by * dz - bz * dy, bd_y = bz * dx - bx * dz, bd_z = bx * dy - by * dx;
+    const I den = 2 * (bx * de_x + by * de_y + bz * de_z);
+    const I ox = (b2 * de_x + d2 * eb_x + e2 * bd_x) / den;
+    const I oy = (b2 * de_y + d2 * eb_y + e2 * bd_y) / den;
+    const I oz = (b2 * de_z + d2 * eb_z + e2 * bd_z) / den;
+    const I r2 = square(ox) + square(oy) + square(oz);
+    const I center[3] = { ax + ox, ay + oy, az + oz };
+
+    std::array<double, 4> ball;
+    double r = std::sqrt(r2.sup());
+    for(int i=0; i<3; ++i)
+    {
+      ball[i] = 0.5 * (center[i].inf() + center[i].sup());
+      r += center[i].sup() - center[i].inf();
+    }
+    ball[3] = r * (1 + 1e-10);
+    if(!(ball[3] < std::numeric_limits<double>::infinity()))
+      ball = {{ 0, 0, 0, std::numeric_limits<double>::infinity() }};
+    return ball;
+  }
+
+  // coordinate along `axis` of the grid cell containing `t`, which is clamped to the grid
+  std::size_t grid_coordinate(double t, int axis) const
+  {
+    const double g = std::floor((t - bbox_.min(axis)) / cell_size_[axis]);
+    if(!(g > 0))
+      return 0;
+    if(!(g < double(resolution_)))
+      return resolution_ - 1;
+    return std::size_t(g);
+  }
+
+  // Returns an unfinalized grid cell in the range `[lo, hi]` that `may_intersect`,
+  // or `none`. The grid cells of a small range are tested one by one,
+  // otherwise the octree of the grid is searched.
+  template <class Predicate>
+  std::size_t find_witness(const std::size_t lo[3], const std::size_t hi[3],
+                           const Predicate& may_intersect) const
+  {
+    const std::size_t n = (hi[0] - lo[0] + 1) * (hi[1] - lo[1] + 1) * (hi[2] - lo[2] + 1);
+    if(n > 64)
+      return search_witness(lo, hi, may_intersect, 0, 0, 0, 0);
+
+    for(std::size_t z=lo[2]; z<=hi[2]; ++z)
+      for(std::size_t y=lo[1]; y<=hi[1]; ++y)
+        for(std::size_t x=lo[0]; x<=hi[0]; ++x)
+        {
+          const std::size_t g = node_index(depth_, x, y, z);
+          if(unfinalized_[depth_][g] != 0 && (n == 1 || may_intersect(depth_, x, y, z)))
+            return g;
+        }
+    return none;
+  }
+
+  // Depth-first search of an unfinalized grid cell in the range `[lo, hi]`,
+  // in the nodes of the octree of the grid that `may_intersect`.
+  // The nodes that contain the range are not tested.
+  template <class Predicate>
+  std::size_t search_witness(const std::size_t lo[3], const std::size_t hi[3],
+                             const Predicate& may_intersect,
+                             int l, std::size_t x, std::size_t y, std::size_t z) const
+  {
+    if(unfinalized_[l][node_index(l, x, y, z)] == 0)
+      return none;
+    const int shift = depth_ - l;
+    const std::size_t xyz[3] = { x, y, z };
+    bool contains_range = true;
+    for(int i=0; i<3; ++i)
+    {
+      const std::size_t first = xyz[i] << shift, last = ((xyz[i] + 1) << shift) - 1;
+      if(last < lo[i] || first > hi[i])
+        return none;
+      if(first > lo[i] || last < hi[i])
+        contains_range = false;
+    }
+    if(!contains_range && !may_intersect(l, x, y, z))
+      return none;
+    if(l == depth_)
+      return node_index(l, x, y, z);
+    for(int i=0; i<8; ++i)
+    {
+      const std::size_t w = search_witness(lo, hi, may_intersect, l + 1,
+                                           2 * x + (i & 1), 2 * y + ((i >> 1) & 1), 2 * z + (i >> 2));
+      if(w != none)
+        return w;
+    }
+    return none;
+  }
+
+  Triangulation tr_;
+  Bbox_3 bbox_;
+  int depth_;
+  std::size_t resolution_;
+  double cell_size_[3];
+  double margin_[3];
+
+  // number of unfinalized grid cells in each node of each level of the octree
+  std::vector<std::vector<std::size_t> > unfinalized_;
+  // cells in memory, by witness
+  std::vector<std::vector<Cell_handle> > waiting_;
+
+  Cell_handle hint_;
+  Random rng_;
+
+  // buffers of the insertion
+  std::vector<Cell_handle> cells_;
+  std::vector<Facet> facets_;
+};
+
+/*!
+  Computes the Delaunay tetrahedralization of `points` with a
+  `Streaming_Delaunay_triangulation_3`, and writes its finite tetrahedra, as
+  arrays of four indices in `points`, to `out`.
+
+  The points are sorted along a Hilbert curve on the cells of the grid of
+  the streaming triangulation, and along a Hilbert curve in each grid cell;
+  each grid cell is finalized after its last point.  The out-of-core
+  construction of large data sets can follow the same scheme, in a first
+  pass counting the points of each grid cell.
+*/
+template <class PointRange, class OutputIterator>
+OutputIterator stream_Delaunay_triangulation_3(const PointRange& points, OutputIterator out,
+                                               int depth = 4)
+{
+  typedef typename std::iterator_traits<typename PointRange::const_iterator>::value_type Point;
+  typedef typename Kernel_traits<Point>::Kernel                 Gt;
+  typedef Streaming_Delaunay_triangulation_3<Gt>                Streaming;
+
+  const std::vector<Point> pts(points.begin(), points.end());
+  if(pts.empty())
+    return out;
+
+  Bbox_3 bbox = bbox_3(pts.begin(), pts.end());
+  // the grid needs a bounding box that is not flat
+  const double eps = 1e-6 * (std::max)({ bbox.xmax() - bbox.xmin(), bbox.ymax() - bbox.ymin(),
+                                         bbox.zmax() - bbox.zmin(), 1. });
+  bbox = Bbox_3(bbox.xmin() - eps, bbox.ymin() - eps, bbox.zmin() - eps,
+                bbox.xmax() + eps, bbox.ymax() + eps, bbox.zmax() + eps);
+  Streaming streaming(bbox, depth);
+
+  // order of the grid cells along a Hilbert curve
+  typedef Simple_cartesian<double>::Point_3                     Grid_point;
+  const std::size_t r = std::size_t(1) << depth;
+  std::vector<Grid_point> centers;
+  centers.reserve(streaming.number_of_grid_cells());
+  for(std::size_t g=0; g<streaming.number_of_grid_cells(); ++g)
+    centers.emplace_back(double(g % r), double((g / r) % r), double(g / (r * r)));
+  std::vector<std::size_t> cells(centers.size());
+  std::iota(cells.begin(), cells.end(), std::size_t(0));
+  typedef typename Pointer_property_map<Grid_point>::type       Grid_pmap;
+  hilbert_sort(cells.begin(), cells.end(),
+               Spatial_sort_traits_adapter_3<Simple_cartesian<double>, Grid_pmap>(make_property_map(centers)),
+               Hilbert_sort_middle_policy());
+  std::vector<std::size_t> rank(cells.size());
+  for(std::size_t i=0; i<cells.size(); ++i)
+    rank[cells[i]] = i;
+
+  // points sorted by grid cell, then along a Hilbert curve in each grid cell
+  std::vector<std::size_t> grid_cell(pts.size()), count(cells.size(), 0);
+  for(std::size_t i=0; i<pts.size(); ++i)
+    ++count[grid_cell[i] = streaming.grid_cell(pts[i])];
+  std::vector<std::size_t> indices(pts.size());
+  std::iota(indices.begin(), indices.end(), std::size_t(0));
+  std::sort(indices.begin(), indices.end(), [&](std::size_t i, std::size_t j)
+            { return rank[grid_cell[i]] < rank[grid_cell[j]]; });
+  typedef typename Pointer_property_map<Point>::const_type      Pmap;
+  Spatial_sort_traits_adapter_3<Gt, Pmap> traits(make_property_map(pts));
+  for(auto begin = indices.begin(); begin != indices.end(); )
+  {
+    auto end = begin + count[grid_cell[*begin]];
+    hilbert_sort(begin, end, traits);
+    begin = end;
+  }
+
+  for(std::size_t g=0; g<cells.size(); ++g)
+    if(count[g] == 0)
+      out = streaming.finalize(g, out);
+  for(std::size_t i : indices)
+  {
+    out = streaming.insert(pts[i], i, out);
+    if(--count[grid_cell[i]] == 0)
+      out = streaming.finalize(grid_cell[i], out);
+  }
+  return out;
+}
+
+} // namespace CGAL
+
+#endif // CGAL_STREAMING_DELAUNAY_TRIANGULATION_3_H
@@ -66,6 +66,8 @@
 
 #ifdef CGAL_LINKED_WITH_TBB
 # include <tbb/scalable_allocator.h>
+# include <tbb/parallel_for.h>
+# include <tbb/blocked_range.h>
 #endif
 
 #include <iostream>
@@ -76,6 +78,9 @@
 #include <utility>
 #include <stack>
 #include <array>
+#include <numeric>
+#include <type_traits>
+#include <vector>
 
 #define CGAL_TRIANGULATION_3_USE_THE_4_POINTS_CONSTRUCTOR
 
@@ -1046,6 +1051,61 @@ public:
                   could_lock_zone);
   }
 
+  // Locates a range of points: the cells are output in the order of the range.
+  // The queries are sorted along a space filling curve, so that the cell found
+  // for a query is a good starting place for the search of the next one.
+  // The triangulation is not modified: with `Parallel_tag`, blocks of
+  // consecutive queries are located in parallel, without locking.
+  template <class InputIterator, class OutputIterator>
+  OutputIterator locate(InputIterator first, InputIterator beyond, OutputIterator res,
+                        std::enable_if_t<
+                          std::is_convertible<
+                            typename std::iterator_traits<InputIterator>::value_type,
+                            Point>::value>* = nullptr) const
+  {
+    const std::vector<Point> points(first, beyond);
+    std::vector<std::size_t> indices(points.size());
+    std::iota(indices.begin(), indices.end(), std::size_t(0));
+
+    // Spatial sorting can only be applied to bare points
+    typedef typename Geom_traits::Point_3 Bare_point;
+    Construct_point_3 cp = geom_traits().construct_point_3_object();
+    std::vector<Bare_point> bare_points;
+    bare_points.reserve(points.size());
+    for(const Point& p : points)
+      bare_points.push_back(cp(p));
+
+    typedef typename Pointer_property_map<Bare_point>::type Pmap;
+    typedef Spatial_sort_traits_adapter_3<Geom_traits, Pmap> Search_traits;
+    spatial_sort<Concurrency_tag>(indices.begin(), indices.end(),
+                                  Search_traits(make_property_map(bare_points), geom_traits()));
+
+    std::vector<Cell_handle> cells(points.size());
+    auto locate_sorted = [&](std::size_t begin, std::size_t end)
+    {
+      Cell_handle hint;
+      for(std::size_t i = begin; i < end; ++i)
+        hint = cells[indices[i]] = locate(points[indices[i]], hint);
+    };
+
+#ifdef CGAL_LINKED_WITH_TBB
+    if(std::is_convertible<Concurrency_tag, Parallel_tag>::value)
+    {
+      tbb::parallel_for(tbb::blocked_range<std::size_t>(0, indices.size(), 1000),
+                        [&](const tbb::blocked_range<std::size_t>& r)
+                        {
+                          locate_sorted(r.begin(), r.end());
+                        });
+    }
+    else
+#endif // CGAL_LINKED_WITH_TBB
+    {
+      locate_sorted(0, indices.size());
+    }
+
+    return std::copy(cells.begin(), cells.end(), res);
+  }
+
   // PREDICATES ON POINTS ``TEMPLATED'' by the geom traits
   Bounded_side side_of_tetrahedron(const Point& p,
                                    const Point& p0, const Point& p1,
@@ -1554,6 +1614,18 @@ protected:
                                      VertexRemover& remover,
                                      VertexInserter& inserter);
 
+  // Concurrency-safe version
+  // Pre-condition: dimension = 3
+  // The return value is only meaningful if *could_lock_zone = true:
+  // * returns the vertex at `p` (`v`, or the vertex `v` collided with)
+  // * returns a default-constructed handle if the vertex wasn't moved since
+  //   its removal would decrease the dimension => needs to be done sequentially
+  template < class VertexRemover, class VertexInserter >
+  Vertex_handle move_if_no_collision(Vertex_handle v, const Point& p,
+                                     VertexRemover& remover,
+                                     VertexInserter& inserter,
+                                     bool *could_lock_zone);
+
   template < class VertexRemover, class VertexInserter >
   Vertex_handle move(Vertex_handle v, const Point& p,
                      VertexRemover& remover, VertexInserter& inserter);
@@ -5744,6 +5816,93 @@ move_if_no_collision(Vertex_handle v, const Point& p,
   return v;
 } // end of Vertex_handle
 
+template < class Gt, class Tds, class Lds >
+template < class VertexRemover, class VertexInserter >
+typename Triangulation_3<Gt,Tds,Lds>::Vertex_handle
+Triangulation_3<Gt,Tds,Lds>::
+move_if_no_collision(Vertex_handle v, const Point& p,
+                     VertexRemover& remover, VertexInserter& inserter,
+                     bool *could_lock_zone)
+{
+  // N.B.: as for the concurrent removal, the dimension is never decreased
+  //       here: such moves are left to the sequential version
+  CGAL_assertion(remover.hidden_points_begin() == remover.hidden_points_end());
+  CGAL_precondition(!is_infinite(v));
+  CGAL_precondition(dimension() == 3);
+
+  // Lock the star of v (and the cells around it), which is retriangulated
+  // after the insertion of p
+  std::vector<Cell_handle> hole;
+  hole.reserve(64);
+  std::vector<Vertex_handle> adj_vertices;
+  adj_vertices.reserve(64);
+  bool dim_down = test_dim_down_using_incident_cells_3(v, hole, adj_vertices,
+                                                       could_lock_zone);
+  if(!*could_lock_zone || dim_down)
+    return Vertex_handle();
+
+  if(v->point() == p)
+    return v;
+
+  if(!this->try_lock_point(p))
+  {
+    *could_lock_zone = false;
+    return Vertex_handle();
+  }
+
+  Locate_type lt;
+  int li, lj;
+  Cell_handle loc = locate(p, lt, li, lj, v->cell(), could_lock_zone);
+  if(!*could_lock_zone)
+    return Vertex_handle();
+
+  if(lt == VERTEX)
+    return loc->vertex(li);
+
+  // This is insert must be from Delaunay (or the particular triangle.)
+  // not Triangulation_3 !
+  Vertex_handle inserted = inserter.insert(p, lt, loc, li, lj, could_lock_zone);
+  if(!*could_lock_zone)
+    return Vertex_handle();
+
+  // The star of v has changed, but all its vertices are locked
+  // (they were either already adjacent to v, or in the conflict zone of p)
+  hole.clear();
+  adj_vertices.clear();
+  adjacent_vertices_and_cells_3(v, std::back_inserter(adj_vertices), hole);
+
+  Vertex_triple_Facet_map outer_map = create_hole_outer_map(v, hole);
+
+  for(auto ch: hole)
+  {
+    remover.add_hidden_points(ch);
+  }
+
+  const auto ret = fill_auxiliary_triangulation_with_vertices_around_v(remover.tmp, v, adj_vertices);
+  const auto& vmap = ret.vmap;
+  const bool inf = ret.vertex_is_incident_to_infinity;
+
+  const Vertex_triple_Facet_map inner_map = create_triangulation_inner_map(remover.tmp, vmap, inf);
+
+  copy_triangulation_into_hole(vmap, std::move(outer_map), inner_map, Emptyset_iterator{});
+
+  // fixing pointer
+  std::vector<Cell_handle> cells_pt;
+  cells_pt.reserve(64);
+  incident_cells(inserted, std::back_inserter(cells_pt));
+  for(std::size_t i=0, size = cells_pt.size(); i<size; i++)
+  {
+    Cell_handle c = cells_pt[i];
+    c->set_vertex(c->index(inserted), v);
+  }
+
+  v->set_point(p);
+  v->set_cell(inserted->cell());
+  tds().delete_vertex(inserted);
+  tds().delete_cells(hole.begin(), hole.end());
+  return v;
+}
+
 template < class Gt, class Tds, class Lds >
 template < class VertexRemover, class VertexInserter >
 typename Triangulation_3<Gt,Tds,Lds>::Vertex_handle
@@ -620,6 +620,23 @@ _test_cls_triangulation_3(const Triangulation &)
   assert(c == ccc);
   ccc = Ti.locate(Point(100,100,0),c->vertex(0));
 
+  // testing the locate of a range.
+  {
+    std::vector<Point> queries;
+    queries.push_back(Point(50,40,1));
+    queries.push_back(Point(100,100,0));
+    queries.push_back(Point(500,500,500));
+    queries.push_back(Point(0,0,0));
+    queries.push_back(Point(50,0,1));
+    std::vector<Cell_handle> cells;
+    Ti.locate(queries.begin(), queries.end(), std::back_inserter(cells));
+    assert(cells.size() == queries.size());
+    for(std::size_t k=0; k<queries.size(); ++k) {
+      int lk, lm;
+      assert(Ti.side_of_cell(queries[k], cells[k], lt, lk, lm) != CGAL::ON_UNBOUNDED_SIDE);
+    }
+  }
+
   Point p22(50,50,0);
   v0=Ti.insert_in_edge(p22,Ti.locate(Point(50,40,1)),i1,i2);
   assert(Ti.is_valid());
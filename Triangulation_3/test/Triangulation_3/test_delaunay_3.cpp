@@ -45,6 +45,17 @@ int main()
 
   _test_cls_delaunay_3( Cls_with_Delaunay_Cb() );
 
+  // Compact TDS, storing 32-bit indices.
+  typedef CGAL::Triangulation_data_structure_3<
+    CGAL::Triangulation_vertex_base_3<EPIC, CGAL::Triangulation_ds_compact_vertex_base_3<> >,
+    CGAL::Delaunay_triangulation_cell_base_3<EPIC,
+      CGAL::Triangulation_cell_base_3<EPIC, CGAL::Triangulation_ds_compact_cell_base_3<> > > >
+                                                    Tds_compact;
+  typedef CGAL::Delaunay_triangulation_3<
+    EPIC, Tds_compact>                              Cls_compact;
+
+  _test_cls_delaunay_3( Cls_compact() );
+
 #ifdef CGAL_LINKED_WITH_TBB
   typedef CGAL::Spatial_lock_grid_3<
     CGAL::Tag_priority_blocking>                      Lock_ds;
@@ -0,0 +1,158 @@
+#include <CGAL/Exact_predicates_inexact_constructions_kernel.h>
+#include <CGAL/Delaunay_triangulation_3.h>
+#include <CGAL/Triangulation_vertex_base_with_info_3.h>
+#include <CGAL/point_generators_3.h>
+#include <CGAL/Random.h>
+
+#include <algorithm>
+#include <cassert>
+#include <cstdlib>
+#include <iostream>
+#include <iterator>
+#include <utility>
+#include <vector>
+
+typedef CGAL::Exact_predicates_inexact_constructions_kernel K;
+typedef K::Point_3                                          Point;
+
+typedef CGAL::Triangulation_vertex_base_with_info_3<std::size_t, K> Vb;
+typedef CGAL::Delaunay_triangulation_cell_base_3<K>                 Cb;
+
+#ifdef CGAL_LINKED_WITH_TBB
+typedef CGAL::Triangulation_data_structure_3<Vb, Cb, CGAL::Parallel_tag> Tds;
+typedef CGAL::Spatial_lock_grid_3<CGAL::Tag_priority_blocking>           Lock_ds;
+#else
+typedef CGAL::Triangulation_data_structure_3<Vb, Cb>                     Tds;
+typedef CGAL::Default                                                    Lock_ds;
+#endif
+
+typedef CGAL::Delaunay_triangulation_3<K, Tds, CGAL::Default, Lock_ds> DT;
+typedef CGAL::Delaunay_triangulation_3<K>                                Sequential_DT;
+
+// the finite cells of a triangulation as sorted quadruples of points
+template <typename Tr>
+std::vector<std::vector<Point> > cells(const Tr& tr)
+{
+  std::vector<std::vector<Point> > res;
+  for(typename Tr::Cell_handle c : tr.finite_cell_handles())
+  {
+    std::vector<Point> cell;
+    for(int i=0; i<4; ++i)
+      cell.push_back(c->vertex(i)->point());
+    std::sort(cell.begin(), cell.end());
+    res.push_back(cell);
+  }
+  std::sort(res.begin(), res.end());
+  return res;
+}
+
+template <typename Tr>
+void assert_same_triangulation(const Tr& tr, const std::vector<Point>& points)
+{
+  Sequential_DT ref(points.begin(), points.end());
+  assert(tr.is_valid());
+  assert(tr.number_of_vertices() == ref.number_of_vertices());
+  assert(cells(tr) == cells(ref));
+}
+
+std::vector<Point> vertex_points(const DT& dt)
+{
+  std::vector<Point> res;
+  for(const Point& p : dt.points())
+    res.push_back(p);
+  return res;
+}
+
+int main()
+{
+  CGAL::Random rnd(0);
+
+  std::vector<Point> points;
+  CGAL::Random_points_in_cube_3<Point> gen(1., rnd);
+  std::copy_n(gen, 20000, std::back_inserter(points));
+
+#ifdef CGAL_LINKED_WITH_TBB
+  Lock_ds locking_ds(CGAL::Bbox_3(-1.2, -1.2, -1.2, 1.2, 1.2, 1.2), 50);
+  DT dt(&locking_ds);
+#else
+  DT dt;
+#endif
+
+  std::vector<std::pair<Point, std::size_t> > points_with_info;
+  for(std::size_t i=0; i<points.size(); ++i)
+    points_with_info.emplace_back(points[i], i);
+  dt.insert(points_with_info.begin(), points_with_info.end());
+  assert(dt.number_of_vertices() == points.size());
+
+  std::cout << "Small displacements of all the vertices" << std::endl;
+  for(int step=0; step<3; ++step)
+  {
+    std::vector<std::pair<DT::Vertex_handle, Point> > moves;
+    for(DT::Vertex_handle v : dt.finite_vertex_handles())
+    {
+      const Point& p = v->point();
+      Point q(p.x() + rnd.get_double(-0.01, 0.01),
+              p.y() + rnd.get_double(-0.01, 0.01),
+              p.z() + rnd.get_double(-0.01, 0.01));
+      moves.emplace_back(v, q);
+      points[v->info()] = q;
+    }
+
+    std::vector<DT::Vertex_handle> moved;
+    dt.move(moves.begin(), moves.end(), std::back_inserter(moved));
+    assert(moved.size() == moves.size());
+    for(std::size_t i=0; i<moves.size(); ++i)
+    {
+      // no collision: the vertices are kept
+      assert(moved[i] == moves[i].first);
+      assert(moved[i]->point() == moves[i].second);
+    }
+    assert_same_triangulation(dt, points);
+  }
+
+  std::cout << "Large displacements and collisions" << std::endl;
+  {
+    std::vector<DT::Vertex_handle> vertices;
+    for(DT::Vertex_handle v : dt.finite_vertex_handles())
+      vertices.push_back(v);
+
+    // the first 1000 vertices jump far away, the next 10 on the position
+    // of vertices that do not move
+    std::vector<std::pair<DT::Vertex_handle, Point> > moves;
+    for(std::size_t i=0; i<1000; ++i)
+      moves.emplace_back(vertices[i], *gen++);
+    for(std::size_t i=1000; i<1010; ++i)
+      moves.emplace_back(vertices[i], vertices[i + 1000]->point());
+
+    std::vector<DT::Vertex_handle> moved;
+    dt.move(moves.begin(), moves.end(), std::back_inserter(moved));
+    for(std::size_t i=0; i<1000; ++i)
+      assert(moved[i] == moves[i].first);
+    for(std::size_t i=1000; i<1010; ++i)
+      assert(moved[i] == vertices[i + 1000]);
+
+    assert(dt.number_of_vertices() == points.size() - 10);
+    assert_same_triangulation(dt, vertex_points(dt));
+  }
+
+  std::cout << "Removal of a cluster" << std::endl;
+  {
+    std::vector<DT::Vertex_handle> cluster;
+    std::vector<Point> remaining;
+    for(DT::Vertex_handle v : dt.finite_vertex_handles())
+    {
+      if(CGAL::squared_distance(v->point(), Point(CGAL::ORIGIN)) < 0.25)
+        cluster.push_back(v);
+      else
+        remaining.push_back(v->point());
+    }
+
+    std::size_t nb_removed = dt.remove_cluster(cluster.begin(), cluster.end());
+    std::cout << "  " << nb_removed << " vertices removed" << std::endl;
+    assert(nb_removed == cluster.size());
+    assert_same_triangulation(dt, remaining);
+  }
+
+  std::cout << "done" << std::endl;
+  return EXIT_SUCCESS;
+}
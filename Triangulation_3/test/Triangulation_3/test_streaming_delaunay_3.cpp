@@ -0,0 +1,132 @@
+#include <CGAL/Exact_predicates_inexact_constructions_kernel.h>
+#include <CGAL/Delaunay_triangulation_3.h>
+#include <CGAL/Streaming_Delaunay_triangulation_3.h>
+#include <CGAL/Triangulation_vertex_base_with_info_3.h>
+#include <CGAL/point_generators_3.h>
+
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <iostream>
+#include <iterator>
+#include <map>
+#include <vector>
+
+typedef CGAL::Exact_predicates_inexact_constructions_kernel      K;
+typedef K::Point_3                                               Point;
+typedef std::array<std::size_t, 4>                               Tetrahedron;
+
+typedef CGAL::Triangulation_vertex_base_with_info_3<std::size_t, K> Vb;
+typedef CGAL::Triangulation_data_structure_3<Vb, CGAL::Delaunay_triangulation_cell_base_3<K> > Tds;
+typedef CGAL::Delaunay_triangulation_3<K, Tds>                   DT;
+
+// the tetrahedra as sorted arrays of indices, a duplicated point being
+// replaced by its first occurrence
+std::vector<Tetrahedron> normalize(std::vector<Tetrahedron> tets, const std::vector<Point>& points)
+{
+  std::map<Point, std::size_t> first;
+  for(std::size_t i=0; i<points.size(); ++i)
+    first.emplace(points[i], i);
+  for(Tetrahedron& t : tets)
+  {
+    for(std::size_t& i : t)
+      i = first[points[i]];
+    std::sort(t.begin(), t.end());
+  }
+  std::sort(tets.begin(), tets.end());
+  return tets;
+}
+
+void test(const std::vector<Point>& points, int depth)
+{
+  std::vector<Tetrahedron> streamed;
+  CGAL::stream_Delaunay_triangulation_3(points, std::back_inserter(streamed), depth);
+
+  std::vector<std::pair<Point, std::size_t> > indexed;
+  for(std::size_t i=0; i<points.size(); ++i)
+    indexed.emplace_back(points[i], i);
+  DT dt(indexed.begin(), indexed.end());
+  assert(dt.is_valid());
+
+  std::vector<Tetrahedron> expected;
+  for(DT::Cell_handle c : dt.finite_cell_handles())
+    expected.push_back(CGAL::make_array(c->vertex(0)->info(), c->vertex(1)->info(),
+                                        c->vertex(2)->info(), c->vertex(3)->info()));
+
+  std::cout << points.size() << " points, depth " << depth << ": "
+            << streamed.size() << " tetrahedra" << std::endl;
+  assert(streamed.size() == expected.size());
+  assert(normalize(streamed, points) == normalize(expected, points));
+
+  // the tetrahedra are positively oriented
+  for(const Tetrahedron& t : streamed)
+    assert(CGAL::orientation(points[t[0]], points[t[1]], points[t[2]], points[t[3]]) == CGAL::POSITIVE);
+}
+
+void test_front(const std::vector<Point>& points)
+{
+  // points inserted by slices of the grid, along z
+  typedef CGAL::Streaming_Delaunay_triangulation_3<K> Streaming;
+  Streaming streaming(CGAL::Bbox_3(-1, -1, -1, 1, 1, 1), 3);
+
+  std::vector<std::size_t> indices(points.size());
+  for(std::size_t i=0; i<indices.size(); ++i)
+    indices[i] = i;
+  std::sort(indices.begin(), indices.end(),
+            [&](std::size_t i, std::size_t j) { return points[i].z() < points[j].z(); });
+
+  std::vector<Tetrahedron> streamed;
+  std::size_t max_cells = 0;
+  std::size_t slice = 0;
+  const std::size_t r = 8;
+  for(std::size_t i : indices)
+  {
+    const std::size_t z = streaming.grid_cell(points[i]) / (r * r);
+    for(; slice < z; ++slice)
+      for(std::size_t g = slice * r * r; g < (slice + 1) * r * r; ++g)
+        streaming.finalize(g, std::back_inserter(streamed));
+    streaming.insert(points[i], i, std::back_inserter(streamed));
+    max_cells = (std::max)(max_cells, streaming.number_of_cells());
+  }
+  streaming.finalize_all(std::back_inserter(streamed));
+
+  CGAL::Delaunay_triangulation_3<K> dt(points.begin(), points.end());
+  std::cout << "at most " << max_cells << " cells in memory, "
+            << dt.number_of_finite_cells() << " tetrahedra" << std::endl;
+  assert(streamed.size() == dt.number_of_finite_cells());
+  assert(max_cells < dt.number_of_cells());
+  assert(streaming.number_of_vertices() == 0);
+}
+
+int main()
+{
+  CGAL::Random rng(0);
+  std::vector<Point> points;
+  CGAL::Random_points_in_cube_3<Point> cube(1, rng);
+  std::copy_n(cube, 20000, std::back_inserter(points));
+  test(points, 3);
+  test(points, 5);
+  test_front(points);
+
+  // points on a sphere: large circumscribing balls
+  std::vector<Point> sphere_points;
+  CGAL::Random_points_on_sphere_3<Point> sphere(1, rng);
+  std::copy_n(sphere, 2000, std::back_inserter(sphere_points));
+  test(sphere_points, 4);
+
+  // degenerate grid, with duplicated points
+  std::vector<Point> grid_points;
+  for(int i=0; i<8; ++i)
+    for(int j=0; j<8; ++j)
+      for(int k=0; k<8; ++k)
+        grid_points.emplace_back(i, j, k);
+  grid_points.insert(grid_points.end(), grid_points.begin(), grid_points.begin() + 100);
+  test(grid_points, 3);
+
+  // few points
+  std::vector<Point> few_points(points.begin(), points.begin() + 5);
+  test(few_points, 2);
+
+  std::cout << "done" << std::endl;
+  return 0;
+}